@@ -12,6 +12,8 @@ class WorldScreen;
 class WorldCallback final {
 public:
 	WorldCallback(WorldScreen* screen);
+	// a callback without a screen, it can only answer the queries on this core
+	WorldCallback(CharacterCore* core);
 	~WorldCallback();
 
 	// bind the functions to an existing lua state.
@@ -4,6 +4,7 @@
 #include "Controller/MouseController.h"
 #include "Controller/KeyboardController.h"
 #include "Controller/GamepadController.h"
+#include "Controller/InputSnapshot.h"
 
 class InputController final : public MouseController, public KeyboardController, public GamepadController {
 public:
@@ -11,6 +12,8 @@ public:
 	~InputController();
 
 	void update(const sf::Time& frameTime) override;
+	// takes the key snapshots of this frame, must be called after the window events are polled.
+	void updateKeys();
 
 	bool isKeyActive(Key key) const;
 	bool isKeyJustPressed(Key key) const;
@@ -29,12 +32,9 @@ public:
 	bool isJustUp() const;
 
 private:
-	void init();
-
-	std::map<Key, bool> m_keyboardKeyActiveMap;
-	std::map<Key, bool> m_keyboardKeyJustPressedMap;
-	std::map<Key, bool> m_gamepadKeyActiveMap;
-	std::map<Key, bool> m_gamepadKeyJustPressedMap;
+	// the key states of this frame, taken once per frame in updateKeys
+	InputSnapshot m_keyboardSnapshot;
+	InputSnapshot m_gamepadSnapshot;
 
 	bool checkKeyActive(Key key) const;
 	bool checkKeyJustPressed(Key key) const;
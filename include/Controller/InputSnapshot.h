@@ -0,0 +1,26 @@
+#pragma once
+
+#include "global.h"
+#include "Enums/Key.h"
+
+#include <array>
+
+// The per frame state of all keys of one input device, with edge detection.
+class InputSnapshot final {
+public:
+	InputSnapshot();
+
+	// sets the state of this key for the current frame. Called once per key and frame.
+	void update(Key key, bool isPressed);
+	void clear();
+
+	bool isActive(Key key) const;
+	// returns whether the key is pressed in this frame, but was not in the last one
+	bool isJustPressed(Key key) const;
+
+	static const std::size_t KEY_COUNT = static_cast<std::size_t>(Key::MAX);
+
+private:
+	std::array<bool, KEY_COUNT> m_active;
+	std::array<bool, KEY_COUNT> m_justPressed;
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "global.h"
 #include "Controller/BaseController.h"
+#include "Controller/KeyboardState.h"
 
 class KeyboardController : public virtual BaseController {
 public:
@@ -16,12 +17,16 @@ public:
 	void cropReadText(int maxLength);
 	void readUnicode(sf::Uint32 character);
 	void setLastPressedKey(sf::Keyboard::Key key);
+	// updates the keyboard state with key press, key release and focus events of the window.
+	void handleKeyboardEvent(const sf::Event& e);
 
 	// returns the sf::Keyboard::Key that was pressed in the last frame. If none, returns sf::Keyboard::Unknown
 	sf::Keyboard::Key getLastPressedKey() const;
 
 protected:
 	bool isKeyboardKeyPressed(Key key) const;
+	// takes the snapshot of the keyboard state, after the events of this frame are handled.
+	void updateKeyboardState();
 
 private:
 	const std::map<Key, sf::Keyboard::Key>* m_mainKeyMap;
@@ -29,6 +34,9 @@ private:
 
 	bool isKeyboardKeyPressed(sf::Keyboard::Key key) const;
 
+	// the keyboard is not polled, its state is built from the window events
+	KeyboardState m_keyboardState;
+
 	bool m_isReadText = false;
 
 	// the text read by the input controller while isReadText is true
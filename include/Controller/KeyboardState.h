@@ -0,0 +1,26 @@
+#pragma once
+
+#include "global.h"
+
+#include <bitset>
+
+// The state of the physical keyboard keys, built from the key events of the window.
+// A key that is pressed and released again between two snapshots still counts as pressed for one frame.
+class KeyboardState final {
+public:
+	// handles KeyPressed, KeyReleased and LostFocus events, all other events are ignored.
+	void handleEvent(const sf::Event& e);
+	// takes the state for the current frame. Called once per frame, before the keys are queried.
+	void snapshot();
+	// releases all keys, used when the window loses focus as no release events arrive anymore.
+	void clear();
+
+	// returns whether the key was pressed in the current snapshot
+	bool isPressed(sf::Keyboard::Key key) const;
+
+private:
+	std::bitset<sf::Keyboard::KeyCount> m_pressed;
+	// keys that were pressed since the last snapshot
+	std::bitset<sf::Keyboard::KeyCount> m_pressedSinceSnapshot;
+	std::bitset<sf::Keyboard::KeyCount> m_snapshot;
+};
\ No newline at end of file
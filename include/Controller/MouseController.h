@@ -26,6 +26,8 @@ public:
 	bool isMouseClickedLeft() const;
 	bool isMouseClickedRight() const;
 
+	// is the cursor visible and inside the window?
+	bool isMouseInsideView() const;
 	bool isMouseWheelScrolledDown() const;
 	bool isMouseWheelScrolledUp() const;
 
@@ -8,6 +8,7 @@
 #include "GUI/BitmapText.h"
 #include "Structs/CutsceneData.h"
 #include "Cutscene/CutsceneLoader.h"
+#include "Cutscene/CutsceneStreamer.h"
 
 // a cutscene, displayed in a cutscene screen
 class Cutscene final {
@@ -26,6 +27,11 @@ private:
 	CutsceneData m_data;
 	BitmapText m_cutsceneText;
 	std::vector<sf::Sprite> m_cutsceneImages;
+	// the texts of each step, read from the database up front
+	std::vector<std::vector<std::string>> m_texts;
+
+	CutsceneStreamer* m_streamer = nullptr;
+	std::map<std::string, sf::Texture*> m_textures;
 
 	sf::Time m_currentTextTime = sf::Time::Zero;
 	sf::Time m_fadeTime;
@@ -42,6 +48,13 @@ private:
 
 	void setNextStep();
 	void setNextText();
+	// returns the texture of this image, uploading it if needed. Returns nullptr if the image can't be loaded.
+	sf::Texture* getTexture(const std::string& imagePath);
+	sf::Texture* createTexture(const std::string& imagePath, const sf::Image& image);
+	// uploads at most one decoded image of the next step per frame, so switching steps doesn't need to upload
+	void prepareNextStep();
+	// deletes the textures that are not shown in the current or the next step
+	void releaseTextures();
 
 	// seen from bottom left
 	static const sf::Vector2f TEXT_OFFSET;
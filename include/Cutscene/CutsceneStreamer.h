@@ -0,0 +1,86 @@
+#pragma once
+
+#include "global.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+typedef std::function<bool(const std::string&, sf::Image&)> ImageDecoder;
+
+// Decodes the images of a cutscene on a background thread, a few steps ahead of the current step.
+// Prefetching stops while the decoded images exceed the memory budget, images are freed once no step
+// in the prefetch window needs them anymore. The images of the current step are always decoded.
+class CutsceneStreamer final {
+public:
+	// the image paths of each step, in order. The decoder defaults to loading the image from the resource folder.
+	CutsceneStreamer(const std::vector<std::vector<std::string>>& stepImages, const ImageDecoder& decoder = ImageDecoder(),
+		size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+	~CutsceneStreamer();
+
+	// moves the prefetch window to this step and frees the images that are not needed anymore.
+	void setCurrentStep(int step);
+	// returns the image if it is decoded, else nullptr. Never blocks.
+	const sf::Image* getImage(const std::string& path) const;
+	// returns the image, decoding it on the calling thread if it is not decoded yet.
+	// returns nullptr if it can't be decoded.
+	const sf::Image* waitForImage(const std::string& path);
+	// waits until all images of this step are decoded. Used before the playback starts, not counted as a block.
+	void waitForStep(int step);
+	// waits until the background thread has decoded all images of the prefetch window it is allowed to by the memory budget.
+	void waitForPrefetch();
+	bool isStepDecoded(int step) const;
+
+	// how often waitForImage had to wait for an image that was not decoded yet
+	int getBlockCount() const;
+	size_t getMemoryUsage() const;
+	size_t getMaxMemoryUsage() const;
+
+	static const int PREFETCH_STEPS;
+	static const size_t DEFAULT_MEMORY_BUDGET;
+
+private:
+	CutsceneStreamer(const CutsceneStreamer&) = delete;
+	CutsceneStreamer& operator=(const CutsceneStreamer&) = delete;
+
+	enum class ImageState {
+		Waiting,
+		Decoding,
+		Decoded,
+		Failed
+	};
+
+	struct StreamedImage final {
+		// the steps showing this image, ascending
+		std::vector<int> steps;
+		ImageState state = ImageState::Waiting;
+		sf::Image* image = nullptr;
+	};
+
+	void run();
+	const sf::Image* acquireImage(const std::string& path, bool isCountingBlocks);
+	// returns the next image to decode or nullptr. The mutex must be locked.
+	StreamedImage* takeImage(std::string& path);
+	// whether a step in the prefetch window shows this image
+	bool isNeeded(const StreamedImage& image) const;
+	void decode(const std::string& path, StreamedImage& image, std::unique_lock<std::mutex>& lock);
+	static size_t getSize(const sf::Image& image);
+
+private:
+	std::vector<std::vector<std::string>> m_stepImages;
+	std::map<std::string, StreamedImage> m_images;
+	ImageDecoder m_decoder;
+	size_t m_memoryBudget;
+	size_t m_memoryUsage = 0;
+	size_t m_maxMemoryUsage = 0;
+	int m_currentStep = 0;
+	int m_blockCount = 0;
+	bool m_isRunning = true;
+	// whether the background thread may still find images to decode in the prefetch window
+	bool m_isPrefetching = true;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::thread m_thread;
+};
\ No newline at end of file
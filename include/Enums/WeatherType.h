@@ -0,0 +1,10 @@
+#pragma once
+
+// the weather is stored by its name in saves and maps, see WeatherSystem::getWeatherType
+enum class WeatherType {
+	VOID,
+	Rain,
+	Snow,
+	Wind,
+	MAX
+};
\ No newline at end of file
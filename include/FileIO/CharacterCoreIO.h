@@ -10,6 +10,7 @@ protected:
 	std::string hashFile(const std::string& input) const;
 protected:
 	// savegame attributes
+	const char* SAVE_GAME_HEADER = "# savegame.header.2";
 	const char* TIME_PLAYED = "time.played";
 	const char* SAVE_GAME_NAME = "savegame.name";
 	const char* DATE_SAVED = "savegame.date";
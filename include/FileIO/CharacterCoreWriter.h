@@ -18,6 +18,8 @@ private:
 	std::string writeAndHash(const std::string& in, const CharacterCoreData& data) const;
 
 private:
+	// a comment line at the start of the save, holding what the save game window shows
+	std::string writeHeader(const CharacterCoreData& data) const;
 
 	std::string writeTimePlayed(const CharacterCoreData& data) const;
 	std::string writeSaveGameName(const CharacterCoreData& data) const;
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "global.h"
+
+// pure static class to list the resource files in the subfolders of a resource folder, e.g. all levels
+class ResourceFolder final {
+private:
+	ResourceFolder() {}
+public:
+	// returns the sorted paths of the files in the subfolders of this folder that start and end like this,
+	// e.g. "res/level" and ".tmx" lists "res/level/x/x.tmx"
+	static std::vector<std::string> findFiles(const std::string& folder, const std::string& ending, const std::string& start = "");
+	// returns the sorted names of the files directly in this folder, without looking into its subfolders
+	static std::vector<std::string> listFiles(const std::string& folder);
+
+	static bool startsWith(const std::string& value, const std::string& start);
+	static bool endsWith(const std::string& value, const std::string& ending);
+
+private:
+	// returns the names of the subfolders or of the files in this folder, in the order of the file system.
+	// hidden subfolders are skipped.
+	static std::vector<std::string> listEntries(const std::string& folder, bool isFolders);
+};
\ No newline at end of file
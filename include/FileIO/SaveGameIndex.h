@@ -0,0 +1,75 @@
+#pragma once
+
+#include "global.h"
+#include "FileIO/CharacterCoreIO.h"
+
+// the attributes of a savegame shown in the save game window
+struct SaveGameHeader final {
+	std::string filename;
+	std::string saveGameName;
+	// the current level if the save is in a level, else the current map
+	std::string location;
+	std::time_t dateSaved = 0;
+	sf::Time timePlayed = sf::Time::Zero;
+	// checked against the whole save when the header is read, it is not part of the header line
+	bool hashValid = false;
+
+	// the state of the file when the header was read, the key of the index.
+	// the hash line tells saves apart that were written within the same second with the same size.
+	long long fileSize = -1;
+	long long modifiedTime = -1;
+	std::string fileHash;
+};
+
+// Lists savegames without parsing them. Every save starts with a header line holding the attributes of the
+// save game window. A new or changed save is read once to check its hash like the character core reader does.
+// The headers are cached in an index file, keyed by file size, modification time and hash line,
+// so only the first lines of unchanged saves are read. Legacy saves without header are parsed like before, without their location.
+class SaveGameIndex final : public CharacterCoreIO {
+public:
+	explicit SaveGameIndex(const std::string& indexFilename);
+
+	// fills the headers of these saves and updates the index file if a save changed. Unreadable saves are skipped.
+	void listSaves(const std::vector<std::string>& filenames, std::vector<SaveGameHeader>& headers);
+	// reads the header from the beginning of a save and checks the hash of the save, returns false for legacy saves.
+	bool readHeader(const std::string& filename, SaveGameHeader& header);
+
+	// collects the paths of the .sav files in this folder
+	static void findSaves(const std::string& folder, std::vector<std::string>& filenames);
+	// the header fields, as written to saves and to the index
+	static std::string writeHeaderFields(const SaveGameHeader& header);
+	static bool readHeaderFields(const std::string& fields, SaveGameHeader& header);
+
+	// statistics of the last listing
+	int getCachedCount() const { return m_cachedCount; }
+	int getHeaderCount() const { return m_headerCount; }
+	int getParsedCount() const { return m_parsedCount; }
+	long long getBytesRead() const { return m_bytesRead; }
+
+	static const std::string INDEX_FILENAME;
+	// the first line of the index, an index of another version is rebuilt
+	static const std::string INDEX_VERSION;
+	// the header line has to start within this many bytes
+	static const int HEADER_BLOCK_SIZE;
+
+private:
+	void loadIndex();
+	void saveIndex() const;
+	bool parseSave(const std::string& filename, SaveGameHeader& header);
+	// reads the hash line from the beginning of a save
+	bool readFileHash(const std::string& filename, std::string& fileHash);
+	// whether the hash line matches the rest of the save
+	bool isHashValid(const std::string& text) const;
+	// returns the second line of the save, which holds the hash
+	static std::string getHashLine(const std::string& text);
+	static bool getFileState(const std::string& filename, long long& size, long long& modifiedTime);
+
+private:
+	std::string m_indexFilename;
+	std::map<std::string, SaveGameHeader> m_index;
+
+	int m_cachedCount = 0;
+	int m_headerCount = 0;
+	int m_parsedCount = 0;
+	long long m_bytesRead = 0;
+};
\ No newline at end of file
@@ -53,6 +53,9 @@ public:
 	sf::FloatRect getLocalBounds() const;
 	sf::FloatRect getBounds() const;
 
+	// appends the transformed glyph quads with this alpha, so that many texts of the same font can be drawn at once
+	void appendVertices(sf::VertexArray& vertices, sf::Uint8 alpha) const;
+
 private:
 	void init();	// Set vertexArray data
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
@@ -10,6 +10,7 @@
 #include "GUI/SelectableWindow.h"
 #include "GUI/BitmapText.h"
 
+class InventorySlotGrid;
 class LevelInterface;
 class MapInterface;
 class MerchantInterface;
@@ -57,6 +58,8 @@ private:
 	void reloadGold();
 
 	void clearAllSlots();
+	// reloads the items of the current tab into the slot grid
+	void reloadItems();
 	void calculateSlotPositions() const;
 	static bool isSlotInvisible(const InventorySlot* slot);
 
@@ -72,19 +75,13 @@ private:
 
 	sf::Sprite m_goldSprite;
 
-	std::map<std::string, InventorySlot*> m_equipmentItems;
-	std::map<std::string, InventorySlot*> m_consumableItems;
-	std::map<std::string, InventorySlot*> m_documentItems;
-	std::map<std::string, InventorySlot*> m_questItems;
-	std::map<std::string, InventorySlot*> m_keyItems;
-	std::map<std::string, InventorySlot*> m_miscItems;
-	ButtonGroup* m_buttonGroup = nullptr;
+	// only the items of the current tab are in the grid
+	InventorySlotGrid* m_slotGrid = nullptr;
 
 	ItemType m_currentTab;
 	// first is the id, the second is VOID when it is no equiment slot and an Item Type when it is an equipment slot
 	std::pair<std::string, ItemType> m_selectedSlotId;
 	void selectTab(ItemType type);
-	void reloadButtonGroup(bool keepSelectedButton = true);
 	// item type shall be VOID for not-equipment-slots
 	void selectSlot(const std::string& selectedSlotId, ItemType type);
 	void deselectCurrentSlot();
@@ -146,5 +143,6 @@ private:
 
 	static const float INVENTORY_WIDTH;
 
-	std::map<ItemType, std::map<std::string, InventorySlot*>*> m_typeMap;
+	// maps the item types to the tab they are shown in
+	std::map<ItemType, ItemType> m_typeMap;
 };
\ No newline at end of file
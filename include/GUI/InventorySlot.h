@@ -14,6 +14,8 @@ public:
 	void select() override;
 	void notifySelection() override;
 
+	// rebinds this slot to another item, used by slot grids that recycle their slots
+	void setItem(const std::string& itemID, int amount);
 	void setAmount(int amount);
 	void setPosition(const sf::Vector2f& pos) override;
 	void setSelectedByButtonGroup(bool isSelected);
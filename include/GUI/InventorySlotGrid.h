@@ -0,0 +1,81 @@
+#pragma once
+
+#include "global.h"
+
+class ButtonGroup;
+class InventorySlot;
+class SelectableWindow;
+
+struct SlotGridEntry final {
+	std::string itemID;
+	int amount;
+};
+
+// A scrollable grid of inventory slots. The items are kept in a compact model, sorted by their id,
+// but only the visible rows and a small margin around them are live slots. These are rebound to other
+// items when the grid scrolls, so updating and rendering the grid doesn't depend on the number of items.
+// The slot of the selected item is never rebound. It is taken out of the live slots while the item is scrolled
+// out of view, so a slot that is dragged around keeps its item.
+class InventorySlotGrid final {
+public:
+	InventorySlotGrid(int columns, int visibleRows, float margin, SelectableWindow* window);
+	~InventorySlotGrid();
+
+	// replaces all items of the model
+	void setItems(std::vector<SlotGridEntry>& items);
+	// sets the amount of an item, adds it to the model if it is new
+	void setItem(const std::string& itemID, int amount);
+	void removeItem(const std::string& itemID);
+	void clear();
+
+	int getItemCount() const;
+	int getRowCount() const;
+
+	// binds the live slots to the rows around this scroll offset and places them, starting at origin.
+	void calculateSlotPositions(const sf::Vector2f& origin, float scrollOffset);
+
+	// the live slot of this item or the slot of the selected item, nullptr if the item is not in a live row and not selected
+	InventorySlot* getSlot(const std::string& itemID) const;
+	// the button group holds the bound live slots, in model order
+	ButtonGroup* getButtonGroup() const;
+	// the selected item keeps its selection when its slot is rebound
+	void setSelectedItemID(const std::string& itemID);
+
+	void render(sf::RenderTarget& target);
+	void renderAfterForeground(sf::RenderTarget& target);
+
+	// the rows above and below the visible rows that are kept alive
+	static const int MARGIN_ROWS;
+
+private:
+	InventorySlotGrid(const InventorySlotGrid&) = delete;
+	InventorySlotGrid& operator=(const InventorySlotGrid&) = delete;
+
+	int findItem(const std::string& itemID) const;
+	// binds the live slots to the items starting at this model index. Only rebinds if the bound items changed or it is forced.
+	void bind(int firstIndex, bool isForced);
+	void reloadButtonGroup(int selectedIndex);
+	// takes the slot of the selected item out of the live slots if it is not in these bound items, or puts it back.
+	// returns whether the live slots changed.
+	bool pinSelectedSlot(int firstIndex, int count);
+	// gives the pinned slot back to the live slots, to be rebound
+	void releasePinnedSlot();
+	sf::Vector2f getSlotPosition(int index, const sf::Vector2f& origin, float scrollOffset) const;
+
+private:
+	std::vector<SlotGridEntry> m_items;
+	std::vector<InventorySlot*> m_slots;
+	// the slot of the selected item while it is not in a live row
+	InventorySlot* m_pinnedSlot = nullptr;
+	ButtonGroup* m_buttonGroup = nullptr;
+	SelectableWindow* m_window;
+	std::string m_selectedItemID;
+
+	int m_columns;
+	int m_visibleRows;
+	float m_margin;
+
+	// the model index bound to the first live slot and the number of bound slots
+	int m_firstIndex = 0;
+	int m_boundCount = 0;
+};
\ No newline at end of file
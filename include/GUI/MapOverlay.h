@@ -107,6 +107,8 @@ public:
 	void reloadMarkers();
 
 	void notifyLevelOverlayReload();
+	// tiles of the current map have been explored, the fog of war of this rect is updated the next time the overlay is visible
+	void notifyFogOfWarRevealed(const sf::IntRect& dirtyRect);
 	void notifyJumpToQuest(const std::string& questId, const std::vector<QuestMarkerData>& data);
 
 	// return whether map has been set
@@ -114,6 +116,8 @@ public:
 
 	static std::string getMapSpriteFilename(const std::string& mapID);
 	static std::string getMapIconFilename(const std::string& mapID);
+	// the scale of a map of this size in the overlay
+	static float getScale(const sf::Vector2f& mapSize);
 
 private:
 	void reloadWaypoints();
@@ -121,10 +125,13 @@ private:
 
 	void setMapIndex(int index);
 	void updateFogOfWar(MapOverlayData* map);
+	void updateFogOfWarDirtyRects(MapOverlayData* map);
 	MapOverlayData* createMapOverlayData(const std::string& id, const sf::Vector2i& size, const sf::Sprite& sprite) const;
-	void renderLevelOverlay(float scale);
-	void drawOverlayTexture(sf::Image& image, const sf::Vector2f& pos, int posX, int posY);
-	float getScale(const sf::Vector2f& mapSize) const;
+	// the walkable tiles of the level, baked or rendered here
+	void loadLevelMinimap(float scale);
+	// the icons of the level objects, drawn over its minimap
+	void reloadLevelOverlayIcons(float scale);
+	void addOverlayIcon(const sf::Vector2f& pos, int posX, int posY);
 	void reloadLevelOverlay();
 	void reloadButtonGroup();
 
@@ -137,6 +144,7 @@ private:
 	static const float LEFT;
 	static const float MAX_HEIGHT;
 	static const float MAX_WIDTH;
+	static const int MAX_DIRTY_RECTS;
 
 private:
 	WorldScreen* m_screen;
@@ -145,12 +153,14 @@ private:
 	std::vector<MapOverlayData*> m_maps;
 
 	sf::Sprite m_mainCharMarker;
-	sf::Image m_levelOverlayIcons;
+	sf::VertexArray m_levelOverlayIcons;
 	sf::Sprite m_levelOverlaySprite;
 	sf::Texture m_levelOverlayTexture;
 
 	std::vector<WaypointMarker*> m_waypoints;
 	std::vector<MapQuestMarker*> m_questMarkers;
+	// explored rects of the current map that are not yet applied to its fog of war
+	std::vector<sf::IntRect> m_fogOfWarDirtyRects;
 	JoystickButtonGroup* m_buttonGroup = nullptr;
 
 	int m_currentMap = -1;
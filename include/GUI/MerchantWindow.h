@@ -7,10 +7,10 @@
 #include "GUI/SlicedSprite.h"
 #include "GUI/SelectableWindow.h"
 
+class InventorySlotGrid;
 class MerchantInterface;
 class ScrollBar;
 class ScrollHelper;
-class ButtonGroup;
 
 // the merchant window, operating on a merchant interface
 class MerchantWindow final : public SelectableWindow {
@@ -32,10 +32,8 @@ private:
 
 	// reloads the merchant items, depending on the core
 	void reload();
-	void reloadButtonGroup();
-	void clearAllSlots();
 	void completeTrade();
-	// reorganizes the positions of the 'm_items' map
+	// reorganizes the positions of the live slots of the grid
 	void calculateSlotPositions();
 
 	BitmapText m_title;
@@ -49,7 +47,7 @@ private:
 	void deselectCurrentSlot();
 	InventorySlot* getSelectedSlot();
 
-	std::map<std::string, InventorySlot*> m_items;
+	InventorySlotGrid* m_slotGrid = nullptr;
 	MerchantItemDescriptionWindow* m_descriptionWindow = nullptr;
 
 	void showDescription(const Item* item);
@@ -60,7 +58,6 @@ protected:
 	void updateButtonActions();
 
 private:
-	ButtonGroup* m_buttonGroup = nullptr;
 	static bool isSlotInvisible(const InventorySlot* slot);
 
 	static const int SLOT_COUNT_X;
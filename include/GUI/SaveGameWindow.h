@@ -5,13 +5,14 @@
 
 #include "GUI/BitmapText.h"
 #include "GUI/ScrollWindow.h"
+#include "FileIO/SaveGameIndex.h"
 
 // a save game entry in a save game window
 class SaveGameEntry final : public ScrollEntry {
 public:
 	SaveGameEntry();
 
-	bool load(const std::string& filename);
+	void load(const SaveGameHeader& header);
 	
 	void render(sf::RenderTarget& renderTarget) override;
 	void setPosition(const sf::Vector2f& pos) override;
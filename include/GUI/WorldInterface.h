@@ -41,6 +41,8 @@ public:
 	virtual void reloadMapWaypoints();
 	// reload the level overlay
 	virtual void reloadLevelOverlay();
+	// tiles in this rect of the current map have been explored. forward to the map overlay
+	void notifyFogOfWarRevealed(const sf::IntRect& dirtyRect) const;
 	// opens the map overlay and jumps to a quest marker
 	void jumpToQuestMarker(const std::string& questId, const std::vector<QuestMarkerData>& data);
 	// opens the quest log and jumps to a quest
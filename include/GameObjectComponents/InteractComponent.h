@@ -22,10 +22,19 @@ public:
 	void setFocused(bool focused);
 	void setInteractable(bool interactable);
 
-	float getDistanceToMainChar() const;
+	// the id in the interaction index of the main character, -1 if it's not registered yet
+	void setInteractionID(int id);
+	int getInteractionID() const;
+	sf::Vector2f getInteractPosition() const;
+	float getInteractRange() const;
 	bool isInteractable() const;
 
 private:
+	// registers this object in the interaction index of the main character, or updates it there
+	void updateInteraction();
+
+private:
+	int m_interactionID = -1;
 	bool m_isInteractable;
 	bool m_isFocused;
 	float m_interactRange;
@@ -4,12 +4,15 @@
 #include "GameObjectComponents/GameObjectComponent.h"
 #include "Particles/ParticleSystem.h"
 
+class RenderPass;
+
 struct ParticleComponentData final {
 	int particleCount = 0;
 	float emitRate = 0;
 	std::string texturePath;
 	bool isAdditiveBlendMode = false;
-	sf::RenderTexture* particleTexture = nullptr;
+	// if set, the particles are drawn into this pass instead of directly to the screen
+	RenderPass* particlePass = nullptr;
 	particles::SizeGenerator* sizeGen = nullptr;
 	particles::ColorGenerator* colorGen = nullptr;
 	particles::ParticleGenerator* velGen = nullptr;
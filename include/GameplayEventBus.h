@@ -0,0 +1,67 @@
+#pragma once
+
+#include "global.h"
+
+enum class GameplayEventType {
+	VOID,
+	EnemyKilled,
+	ItemAdded,
+	GoldChanged,
+	LevelFinished,
+	Death,
+	MAX
+};
+
+struct GameplayEvent final {
+	GameplayEventType type = GameplayEventType::VOID;
+	// the enemy ID of a killed enemy, the amount of an added item, the gold of the character after a gold change
+	int value = 0;
+	// the item ID of an added item, the level ID of a finished level or a death
+	std::string id;
+};
+
+typedef std::function<void(const GameplayEvent&)> GameplayEventCallback;
+
+// Typed gameplay events for achievements, statistics and tests.
+// Subscribers are kept in one table per event type, so publishing an event nobody listens to costs a single branch.
+class GameplayEventBus final {
+public:
+	GameplayEventBus();
+
+	// returns the subscription ID. Subscriptions made while an event is published only get the following events.
+	int subscribe(GameplayEventType type, const GameplayEventCallback& callback);
+	// ends a subscription. This is safe to call from within a callback.
+	void unsubscribe(int subscription);
+
+	void publish(GameplayEventType type, int value) {
+		if (m_subscriberCount[static_cast<int>(type)] == 0) return;
+		dispatch(type, value, EMPTY_ID);
+	}
+	void publish(GameplayEventType type, const std::string& id, int value = 0) {
+		if (m_subscriberCount[static_cast<int>(type)] == 0) return;
+		dispatch(type, value, id);
+	}
+	bool hasSubscribers(GameplayEventType type) const;
+
+private:
+	struct Subscription final {
+		int id;
+		bool isRemoved;
+		GameplayEventCallback callback;
+	};
+
+	void dispatch(GameplayEventType type, int value, const std::string& id);
+	// removes the ended subscriptions and adds the ones made during a dispatch
+	void compact();
+
+private:
+	std::vector<Subscription> m_subscriptions[static_cast<int>(GameplayEventType::MAX)];
+	int m_subscriberCount[static_cast<int>(GameplayEventType::MAX)];
+	// the event type of each subscription ID, VOID if it has ended
+	std::vector<GameplayEventType> m_subscriptionTypes;
+	std::vector<std::pair<GameplayEventType, Subscription>> m_pendingSubscriptions;
+	int m_dispatchDepth = 0;
+	bool m_isDirty = false;
+
+	static const std::string EMPTY_ID;
+};
\ No newline at end of file
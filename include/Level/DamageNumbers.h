@@ -10,34 +10,67 @@ enum class DamageNumberType {
 };
 
 class BitmapText;
+class GameObject;
 
 struct DamageNumberData final {
-	bool active;
-	float startPosition;
-	float time;
-	BitmapText* text;
+	bool active = false;
+	// the object the number belongs to, only compared, never dereferenced
+	const GameObject* target = nullptr;
+	DamageNumberType type = DamageNumberType::Damage;
+	// numbers can be merged while they are young, strings and critical numbers can't
+	bool isMergeable = false;
+	int value = 0;
+	std::string str;
+	int characterSize = 0;
+	sf::Color color;
+	// x is the center of the text, y its top
+	sf::Vector2f position;
+	float startPosition = 0.f;
+	float time = 0.f;
+	sf::Uint8 alpha = 255;
+	// the text is only rebuilt on render, after it has been changed
+	bool isTextDirty = false;
+	BitmapText* text = nullptr;
 };
 
+// The floating combat text of a whole level screen. The numbers live in a fixed ring buffer,
+// the oldest one is reused when it is full, and all of them are drawn with one vertex array per font.
+// Numbers of the same target and type that arrive shortly after each other are summed up in one number.
 class DamageNumbers final {
 public:
-	DamageNumbers(bool isAlly);
+	DamageNumbers();
 	~DamageNumbers();
 
 	void update(const sf::Time& frameTime);
 	void render(sf::RenderTarget& target);
 
-	void emitNumber(int value, const sf::Vector2f& position, DamageNumberType type, bool critical);
-	void emitString(std::string str, const sf::Vector2f& position, DamageNumberType type);
+	void emitNumber(const GameObject* target, int value, const sf::Vector2f& position, DamageNumberType type, bool isAlly, bool critical);
+	void emitString(const GameObject* target, const std::string& str, const sf::Vector2f& position, DamageNumberType type, bool isAlly);
+
+	const std::vector<DamageNumberData>& getNumbers() const;
+	int getActiveCount() const;
 
-private:
 	static const int MAX_NUMBERS;
-	static const float START_OFFSET;
-	static const float DISTANCE;
+	// numbers emitted after this many in the same frame are dropped
+	static const int MAX_EMITS_PER_FRAME;
+	// the time in seconds in which a number takes up new numbers of its target
+	static const float MERGE_TIME;
 	static const float TIME;
 
-	float offset;
+private:
+	DamageNumberData* emit(const GameObject* target, const std::string& str, const sf::Vector2f& position, DamageNumberType type, bool isAlly);
+	DamageNumberData* findMergeable(const GameObject* target, DamageNumberType type);
+	sf::VertexArray& getBatch(const sf::Texture* texture);
+
+	static const float START_OFFSET;
+	static const float DISTANCE;
 
 	std::vector<DamageNumberData> m_data;
-	int m_nextIndex;
-	bool m_isAlly;
+	int m_nextIndex = 0;
+	int m_emitCount = 0;
+
+	// the stacking offsets of the targets that got numbers this frame
+	std::vector<std::pair<const GameObject*, float>> m_offsets;
+
+	std::vector<std::pair<const sf::Texture*, sf::VertexArray>> m_batches;
 };
\ No newline at end of file
@@ -39,6 +39,8 @@ public:
 	void loadAnimation(int skinNr) override;
 	void onHit(Spell* spell) override;
 
+	// the tile is moved here, before the mobs on it are moved along
+	void updateFirst(const sf::Time& frameTime) override;
 	void update(const sf::Time& frameTime) override;
 	void render(sf::RenderTarget& target) override;
 	void renderAfterForeground(sf::RenderTarget& target) override;
@@ -49,7 +51,6 @@ public:
 	bool isSwitchable() const override;
 
 	// those methods are overridden to resolve the MI diamond of death:
-	void updateFirst(const sf::Time& frameTime) override { LevelMovableTile::updateFirst(frameTime); }
 	void setState(GameObjectState state) override { LevelMovableTile::setState(state); }
 	GameObjectType getConfiguredType() const override { return LevelMovableTile::getConfiguredType(); }
 	LevelDynamicTileID getDynamicTileID() const override { return LevelDynamicTileID::Moving; }
@@ -63,13 +64,17 @@ private:
 	void updateRelativeVelocity(const sf::Time& frameTime) override;
 	std::string getSpritePath() const override;
 	void setFrozen(bool frozen, bool permanent = false);
+	// advances the frozen time and the motion
+	void advance(sf::Time time);
 	bool m_isFrozen;
 	bool m_isPermanentlyFrozen;
 	bool m_isFreezable;
 	bool m_isActive;
-	sf::Vector2f m_currentVelocity;
-	sf::Time m_distanceTime;
-	sf::Time m_timeUntilTurn;
+	sf::Vector2f m_forwardVelocity;
+	BackAndForthMotion m_motion;
+	// the position where the motion started, the tile is always at the motion offset from it
+	sf::Vector2f m_origin;
+	bool m_isOriginSet = false;
 	sf::Time m_frozenTime;
 
 	static const sf::Time FROZEN_TIME;
@@ -7,6 +7,7 @@
 #include "Particles/ParticleSystem.h"
 
 class ParticleComponent;
+class RenderPass;
 
 // available skins:
 // 1: fire
@@ -40,7 +41,7 @@ private:
 	std::string m_color;
 	ParticleComponent* m_pc;
 	particles::AimedVelocityGenerator* m_velGen = nullptr;
-	sf::RenderTexture* getParticleTexture();
+	RenderPass* getParticlePass();
 	
 
 	void loadFlameParticles();
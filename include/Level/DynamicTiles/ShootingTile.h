@@ -22,6 +22,8 @@ private:
 	std::string getSpritePath() const override;
 	void loadSpells();
 	void executeSpells();
+	// advances the timers by at most the time until the next of them runs out, the spells are only cast if isCasting
+	void updateTimers(const sf::Time& time, bool isCasting);
 	void setInitialState(bool on) override;
 
 private:
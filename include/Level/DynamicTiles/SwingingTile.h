@@ -3,6 +3,7 @@
 #include "global.h"
 #include "Level/LevelDynamicTile.h"
 #include "Level/DynamicTiles/LeverDependentTile.h"
+#include "Level/DynamicTiles/TileSimulation.h"
 
 enum class SwingingTileMode {
 	Round,
@@ -30,7 +31,6 @@ private:
 	sf::Vector2f getHeadPosition() const;
 
 private:
-	void animatePendulum(const sf::Time& frametime);
 	void animateRound(const sf::Time& frametime);
 
 private:
@@ -38,7 +38,7 @@ private:
 	int m_speed;
 	bool m_isInactive = false;
 	bool m_isClockwise = true;
-	float m_pendulumVelocity = 0.f;
+	PendulumMotion m_pendulum;
 	float m_length;
 	SwingingTileMode m_mode;
 	sf::Texture* m_texture = nullptr;
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "global.h"
+
+// The clock of a dynamic tile with a deterministic motion. Near the main character the tile is advanced every frame,
+// far from it only every OFFSCREEN_TICK_TIME, by all the time it missed. It catches up as soon as it comes near again.
+class SimulationClock final {
+public:
+	// returns the time to advance the tile by in this frame, zero if it is not ticked
+	sf::Time tick(const sf::Time& frameTime, bool isFar);
+
+	static const sf::Time OFFSCREEN_TICK_TIME;
+
+private:
+	sf::Time m_missedTime;
+};
+
+// The motion of a moving tile: forth for its distance time, back for its distance time and so on.
+// It is a function of the time moved, so advancing it once by a long time ends where advancing it every frame does.
+class BackAndForthMotion final {
+public:
+	void setDistanceTime(const sf::Time& distanceTime);
+	// advances the motion and returns how far the tile moved, in seconds of its forward velocity
+	float advance(const sf::Time& time);
+	bool isBack() const;
+	// how far the tile is from where the motion started, in seconds of its forward velocity
+	float getOffset() const;
+
+private:
+
+	sf::Time m_distanceTime;
+	// within a round trip
+	sf::Time m_time;
+};
+
+// The motion of a pendulum, integrated with a fixed step so that it comes out the same for any frame times.
+class PendulumMotion final {
+public:
+	// the rotation in degrees, the acceleration is the speed over the length
+	void init(float rotation, float acceleration);
+	// advances the motion and returns the rotation in degrees
+	float advance(const sf::Time& time);
+
+	static const sf::Time STEP_TIME;
+
+private:
+	float m_rad = 0.f;
+	float m_velocity = 0.f;
+	float m_acceleration = 0.f;
+	// not integrated yet
+	sf::Time m_time;
+};
\ No newline at end of file
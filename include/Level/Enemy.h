@@ -45,6 +45,8 @@ public:
 	void onRightClick() override;
 	void onMouseOver() override;
 	void update(const sf::Time& frameTime) override;
+	// the read-only part of the enemy's AI, run for all enemies before they are updated. Thread safe.
+	void think();
 
 	void onHit(Spell* spell) override;
 	void setFeared(const sf::Time& fearedTime) override;
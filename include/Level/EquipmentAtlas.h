@@ -0,0 +1,55 @@
+#pragma once
+
+#include "global.h"
+#include "World/Animation.h"
+#include "Enums/GameObjectState.h"
+
+class AnimatedGameObject;
+
+// one layer of the composed main character: a sprite sheet and its frames per state.
+struct EquipmentAtlasLayer final {
+	sf::Image spriteSheet;
+	std::map<GameObjectState, std::vector<sf::IntRect>> frames;
+	// position of the layer's frames inside the composed frame
+	sf::Vector2i offset;
+};
+
+// Bakes the level main character and its equipment into one texture, so they can be drawn as a single sprite.
+// The first layer is the base: each of its frames gets a composed frame. The other layers are drawn on top, in order,
+// with their frame of the same state and index, as their animations run in sync with the base animation.
+class EquipmentAtlas final {
+public:
+	EquipmentAtlas() {}
+	~EquipmentAtlas();
+
+	// creates a layer from the animations of this object. The sprite sheet is copied back from the graphics card.
+	static EquipmentAtlasLayer createLayer(const AnimatedGameObject& object, const sf::Vector2i& offset);
+
+	// composes the atlas image from these layers. This only works on images, no graphics context is needed.
+	void bake(const std::vector<EquipmentAtlasLayer>& layers, const sf::Vector2i& frameSize);
+	// uploads the atlas image and creates a composed animation for each of these base animations.
+	// returns false if nothing has been baked.
+	bool load(const std::map<GameObjectState, const Animation*>& baseAnimations);
+	void clear();
+
+	// returns the composed animation for this base animation or nullptr if there is none.
+	const Animation* getAnimation(const Animation* baseAnimation) const;
+	// returns the composed frames of this state inside the atlas image.
+	const std::vector<sf::IntRect>& getFrames(GameObjectState state) const;
+	const sf::Image& getImage() const;
+	bool isLoaded() const;
+
+	// the atlas grows in rows of this many frames.
+	static const int MAX_COLUMNS;
+
+private:
+	EquipmentAtlas(const EquipmentAtlas&) = delete;
+	EquipmentAtlas& operator=(const EquipmentAtlas&) = delete;
+
+	void clearAnimations();
+
+	sf::Image m_image;
+	sf::Texture m_texture;
+	std::map<GameObjectState, std::vector<sf::IntRect>> m_frames;
+	std::map<const Animation*, Animation*> m_animations;
+};
\ No newline at end of file
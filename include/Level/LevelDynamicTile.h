@@ -3,6 +3,7 @@
 #include "global.h"
 #include "World/AnimatedGameObject.h"
 #include "Structs/LevelDynamicTileData.h"
+#include "Level/DynamicTiles/TileSimulation.h"
 
 class Spell;
 class LevelMovableGameObject;
@@ -46,6 +47,11 @@ public:
 protected:
 	virtual std::string getSpritePath() const { return ""; }
 	virtual std::string getSoundPath() const { return ""; }
+	// returns the time to advance a tile with a deterministic motion by in this frame.
+	// Far from the main character, it is only advanced every few frames (see SimulationClock).
+	sf::Time getSimulationTime(const sf::Time& frameTime);
+	// whether the tile is more than a screen away from the main character, so it can't be seen before it is advanced again
+	bool isFarFromMainCharacter() const;
 	// dynamic tile textures have a border (border width in pixel)
 	const int BORDER = 1;
 	const Level* m_level;
@@ -60,4 +66,5 @@ protected:
 
 private:
 	sf::Vector2f m_positionOffset = sf::Vector2f(0.f, 0.f);
+	SimulationClock m_simulationClock;
 };
\ No newline at end of file
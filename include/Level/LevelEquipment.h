@@ -23,6 +23,7 @@ public:
 	void loadComponents(const ItemEquipmentLightBean* light, const ItemEquipmentParticleBean* particles);
 	
 	void update(const sf::Time& frameTime) override;
+	void render(sf::RenderTarget& renderTarget) override;
 	
 	GameObjectType getConfiguredType() const override;
 	ItemType getItemType() const;
@@ -30,6 +31,12 @@ public:
 	void setPosition(const sf::Vector2f& position) override;
 	void lockAnimation(bool lock);
 
+	// returns the top left position of the equipment frames for this main character
+	static sf::Vector2f calculateFramePosition(const LevelMainCharacter& mainChar);
+
+	// width and height of an equipment frame
+	static const int EQ_SIZE;
+
 private:
 	LevelMainCharacter* m_mainChar;
 	bool m_hasTexture = false;
@@ -49,6 +56,4 @@ private:
 
 	bool m_isLocked = false;
 	bool m_isParticleClimbHidden = false;
-
-	static const int EQ_SIZE;
 };
\ No newline at end of file
@@ -6,10 +6,12 @@
 #include "CharacterCore.h"
 #include "World/MainCharacter.h"
 #include "TargetManager.h"
+#include "Level/EquipmentAtlas.h"
 
 class ParticleComponent;
 class AutoscrollerCamera;
 class GamepadAimCursor;
+class LevelEquipment;
 
 // Cendric in a level
 class LevelMainCharacter final : public LevelMovableGameObject, public MainCharacter {
@@ -22,7 +24,7 @@ public:
 	void update(const sf::Time& frameTime) override;
 	void onHit(Spell* spell) override;
 
-	void render(sf::RenderTarget& target) override { LevelMovableGameObject::render(target); }
+	void render(sf::RenderTarget& target) override;
 	void setPosition(const sf::Vector2f& pos) override { LevelMovableGameObject::setPosition(pos); }
 	void updateFirst(const sf::Time& frameTime) override { LevelMovableGameObject::updateFirst(frameTime); }
 	void renderAfterForeground(sf::RenderTarget& target) override { LevelMovableGameObject::renderAfterForeground(target); }
@@ -34,6 +36,8 @@ public:
 	AttackingBehavior* createAttackingBehavior(bool asAlly = false) override;
 
 	void reloadEquipment();
+	// composes the main character and this equipment into one sprite per animation frame
+	void bakeEquipment(const std::vector<LevelEquipment*>& equipment);
 	void reloadAttributes();
 	void reloadWeapon();
 	void clearOwnSpells();
@@ -61,11 +65,15 @@ public:
 	bool isAlly() const override;
 	bool isReady() const override;
 	bool isClimbing() const;
+	// whether the equipment is drawn as part of the composed sprite
+	bool isEquipmentComposed() const;
 	sf::Vector2f getSpellPosition() const;
 
 	// ranges from 0 to 4 and helps render the main char invisibile for certain enemies / reduce the aggro range
 	int getInvisibilityLevel() const;
+	// the color tints the main character together with its equipment
 	void setSpriteColor(const sf::Color& color, const sf::Time& time) override;
+	const sf::Color& getEquipmentColor() const;
 
 	GameObjectType getConfiguredType() const override;
 	TargetManager& getTargetManager() const;
@@ -88,6 +96,8 @@ private:
 	void loadComponents();
 	void updateDamagedOverlay();
 	void updateAutoscroller();
+	// returns false if there is no composed animation for the current animation
+	bool updateComposedSprite();
 	static int getSpellFromKey(Key key);
 
 private:
@@ -105,6 +115,9 @@ private:
 	sf::Time m_fadingTime = sf::seconds(2.f);
 	sf::Time m_particleTime = sf::seconds(2.f);
 	sf::Time m_equipmentColoredTime = sf::Time::Zero;
+	sf::Color m_equipmentColor = COLOR_WHITE;
+	EquipmentAtlas m_equipmentAtlas;
+	AnimatedSprite m_composedSprite;
 	bool m_needsAnimationReset = false;
 	bool m_isInputLock = false;
 	AutoscrollerCamera* m_autoscroller = nullptr;
@@ -13,6 +13,6 @@ class LevelMainCharacterLoader final {
 public:
 	// loads the main character and adds it directly to the screen
 	static LevelMainCharacter* loadMainCharacter(Screen* screen, Level* level);
-	// loads level equipment adds it directly to the screen
+	// loads level equipment adds it directly to the screen and bakes it into the main character's composed sprite
 	static void loadEquipment(Screen* screen);
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "global.h"
+
+struct WorldData;
+class CharacterCore;
+
+// a minimap baked by the minimap baker
+struct LevelMinimap final {
+	std::string imagePath;
+	sf::Vector2u size;
+	// the checksum of the collidable tiles it was rendered from
+	sf::Uint32 tilesChecksum = 0;
+	// the checksum of its pixels
+	sf::Uint32 imageChecksum = 0;
+};
+
+// The table of the minimaps of all levels, as the map overlay shows them: the walkable tiles on black, without any markers.
+// The minimap baker renders them ahead and writes this table. A baked minimap is only used as long as the collidable tiles
+// of the level have the checksum it was baked from, levels whose layers depend on the game state are rendered at runtime.
+class LevelMinimaps final {
+public:
+	// reads and writes the table as text, one line per minimap.
+	bool read(std::istream& stream);
+	void write(std::ostream& stream) const;
+	bool load(const std::string& filename);
+	bool save(const std::string& filename) const;
+
+	void addMinimap(const std::string& levelID, const LevelMinimap& minimap);
+	void clear();
+
+	// returns the baked minimap of this level or nullptr if there is none for its current collidable tiles
+	const LevelMinimap* getMinimap(const WorldData& data) const;
+	// returns whether this level has a baked minimap in the table that matches the freshly baked one and its image, logs the difference otherwise
+	bool checkMinimap(const std::string& levelID, const LevelMinimap& minimap) const;
+	const std::map<std::string, LevelMinimap>& getMinimaps() const;
+
+	// reads a level with this character core like the game does and renders its minimap at the scale of the map overlay.
+	// returns false if the level can't be read. Boss levels are not shown on the map overlay, their minimap stays empty.
+	static bool bake(const std::string& levelID, const CharacterCore* core, LevelMinimap& minimap, std::vector<sf::Uint8>& pixels);
+	// the level ids of all levels in the resource folder
+	static std::vector<std::string> getLevelIDs();
+	// renders the walkable tiles of this level at this scale into RGBA pixels and returns the size of the image
+	static sf::Vector2u render(const WorldData& data, float scale, std::vector<sf::Uint8>& pixels);
+	static sf::Vector2u getImageSize(const WorldData& data, float scale);
+	static sf::Uint32 getTilesChecksum(const WorldData& data);
+	static sf::Uint32 getChecksum(const sf::Uint8* bytes, size_t count);
+	// the baked minimap of res/level/x/x.tmx is res/level/x/x_minimap.png
+	static std::string getImagePath(const std::string& levelID);
+
+	static const std::string MINIMAPS_PATH;
+
+private:
+	std::map<std::string, LevelMinimap> m_minimaps;
+};
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "World/MovableGameObject.h"
 #include "Structs/AttributeData.h"
 #include "Structs/DamageOverTimeData.h"
+#include "Level/DamageNumbers.h"
+#include "Level/StatusEffectScheduler.h"
 
 class Level;
 class SpellManager;
@@ -11,7 +13,6 @@ class Spell;
 class SpellCreator;
 class MovingBehavior;
 class AttackingBehavior;
-class DamageNumbers;
 
 // a MOB in a level, enemies + main character.
 class LevelMovableGameObject : public virtual MovableGameObject {
@@ -20,8 +21,6 @@ public:
 	virtual ~LevelMovableGameObject();
 
 	void update(const sf::Time& frameTime) override;
-
-	void renderAfterForeground(sf::RenderTarget& target) override;
 	
 	void calculateUnboundedVelocity(const sf::Time& frameTime, sf::Vector2f& nextVel) const override;
 	virtual void onHit(Spell* spell);
@@ -111,14 +110,19 @@ protected:
 
 	SpellManager* m_spellManager = nullptr;
 
+	// the damage numbers of the level screen, mobs without them don't show any numbers
 	DamageNumbers* m_damageNumbers = nullptr;
 
 	// store attributes given by food. if their time runs out, they get removed from the total attributes.
 	std::pair<sf::Time, AttributeData> m_foodAttributes;
-	// a vector to store the attributes given by spells (buffs). if their time runs out, they get removed from the total attributes.
-	std::vector<std::pair<sf::Time, AttributeData>> m_buffAttributes;
-	// active debuffs (dots) with their type, remaining time and dps
-	std::vector<DamageOverTimeData> m_dots;
+	// the attributes given by spells (buffs) by their effect id. if their time runs out, they get removed from the total attributes.
+	std::map<int, AttributeData> m_buffAttributes;
+	// active debuffs (dots) by their effect id, with their type, remaining time and damage per tick
+	std::map<int, DamageOverTimeData> m_dots;
+	// the expiries of the buffs and the ticks of the dots
+	StatusEffectScheduler m_effectScheduler;
+	int m_nextEffectID = 0;
+	static const sf::Time DOT_TICK_TIME;
 	// time stunned
 	sf::Time m_stunnedTime = sf::Time::Zero;
 	// time feared
@@ -132,6 +136,7 @@ protected:
 	void updateAttributes(const sf::Time& frameTime);
 	virtual void updateHealthRegeneration(const sf::Time& frameTime);
 	void updateDamageNumbers(const sf::Time& frameTime);
+	void emitDamageNumber(int value, DamageNumberType type, bool critical);
 	int m_currentDotDamage = 0;
 	sf::Time m_timeSinceDotNumbers = sf::Time::Zero;
 	sf::Time m_timeSinceRegeneration = sf::Time::Zero;
@@ -10,4 +10,7 @@ public:
 
 	void updateAggro() override;
 	sf::Color getConfiguredHealthColor() const override;
+
+protected:
+	LevelMovableGameObject* searchTarget() const override;
 };
\ No newline at end of file
@@ -17,6 +17,9 @@ public:
 
 	sf::Color getConfiguredHealthColor() const override;
 
+protected:
+	LevelMovableGameObject* searchTarget() const override;
+
 private:
 	sf::Time m_timeToLive = sf::Time::Zero;
 	bool m_hasTimeToLive = false;
@@ -11,6 +11,9 @@ public:
 
 	virtual void update(const sf::Time& frameTime) override;
 	virtual void updateAggro() = 0;
+	// searches a new target if the enemy has none. It only reads the level, so all enemies can think in parallel
+	// before they are updated. The update commits the target.
+	void think();
 
 	void setAggroRange(float range);
 
@@ -20,6 +23,12 @@ public:
 
 	virtual sf::Color getConfiguredHealthColor() const = 0;
 
+protected:
+	// returns the nearest target in aggro range or nullptr. Must only read the level.
+	virtual LevelMovableGameObject* searchTarget() const;
+	// returns the target found by think this frame if it is still alive, else searches it now.
+	LevelMovableGameObject* findTarget();
+
 protected:
 	Enemy* m_enemy;
 
@@ -29,4 +38,8 @@ protected:
 	// the target to be destroyed!
 	LevelMovableGameObject* m_currentTarget;
 	std::vector<GameObject*>* m_enemies;
+
+private:
+	LevelMovableGameObject* m_thoughtTarget = nullptr;
+	bool m_hasThought = false;
 };
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "global.h"
+
+struct StatusEffectEvent final {
+	int id;
+	sf::Time due;
+	// the order of scheduling, for events due at the same time
+	int sequence;
+};
+
+// A timer wheel for the expiries and ticks of the buffs and dots of a mob.
+// The events of the current turn of the wheel are kept in buckets by their due time, so an update only looks at the buckets
+// the time has passed. Events of later turns wait in an overflow list that is only looked at when a new turn begins.
+class StatusEffectScheduler final {
+public:
+	StatusEffectScheduler();
+
+	// schedules an event with this id, at a time of the scheduler's clock. Events due already are popped in the current frame.
+	void schedule(int id, const sf::Time& due);
+	// advances the clock and collects the events that are due
+	void update(const sf::Time& frameTime);
+	// pops the earliest event that is due, returns false if there is none left
+	bool popDue(StatusEffectEvent& event);
+
+	const sf::Time& getTime() const;
+	bool isEmpty() const;
+	int getEventCount() const;
+	// the number of events the last update looked at
+	int getTouchedCount() const;
+
+	static const int WHEEL_SIZE;
+	static const sf::Time SLOT_TIME;
+
+private:
+	sf::Int64 getSlot(const sf::Time& time) const;
+	void insertDue(const StatusEffectEvent& event);
+	// moves the events of this turn from the overflow list into the buckets
+	void beginTurn(sf::Int64 turn);
+
+	std::vector<std::vector<StatusEffectEvent>> m_buckets;
+	std::vector<StatusEffectEvent> m_overflow;
+	sf::Int64 m_turn = 0;
+	// sorted with the earliest event last
+	std::vector<StatusEffectEvent> m_due;
+
+	sf::Time m_time;
+	int m_sequence = 0;
+	int m_eventCount = 0;
+	int m_touchedCount = 0;
+};
\ No newline at end of file
@@ -3,21 +3,118 @@
 #include "global.h"
 #include "Enums/LogLevel.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// debug and verbose messages are only compiled into debug builds, their arguments are not evaluated otherwise.
+#ifdef DEBUG
+#define LOG_DEBUG(source, message) g_logger->log(LogLevel::Debug, source, message)
+#define LOG_VERBOSE(source, message) g_logger->log(LogLevel::Verbose, source, message)
+#else
+#define LOG_DEBUG(source, message) ((void)0)
+#define LOG_VERBOSE(source, message) ((void)0)
+#endif
+
+// Logs messages asynchronously. Callers only copy their message into a ring buffer,
+// a background thread formats the messages and writes them to the console and, optionally, to a log file.
 class Logger final {
 public:
 	Logger();
+	~Logger();
+
 	void logError(const std::string& source, const std::string& message) const;
 	void logWarning(const std::string& source, const std::string& message) const;
 	void logInfo(const std::string& source, const std::string& message) const;
 	// logs the message with importance level. The source should describe the calling class and/or method.
+	// errors are never dropped or rate limited and are written before this returns.
+	// other messages never block: if the buffer is full, the message is dropped and counted.
 	void log(LogLevel level, const std::string& source, const std::string& message) const;
 	// sets the log level to 'level'. The log will only output messages, that have importance 'level' or higher.
 	// if the log level is set to 'None', the log won't output anything.
 	void setLogLevel(LogLevel level);
 	LogLevel getLogLevel() const;
+	// overrides the log level for messages of this source (channel).
+	void setChannelLogLevel(const std::string& source, LogLevel level);
+	void clearChannelLogLevels();
+
+	// additionally writes the log to this file. If the file grows larger than maxSize bytes,
+	// it is moved to "<path>.1" and a new file is started. An empty path closes the log file.
+	void setLogFile(const std::string& path, std::size_t maxSize = 1024 * 1024);
+	// blocks until all messages logged so far have been written.
+	void flush() const;
+
+	// number of slots in the ring buffer
+	static const std::size_t BUFFER_SIZE = 1024;
+	// longer sources and messages are truncated
+	static const std::size_t MAX_SOURCE_LENGTH = 63;
+	static const std::size_t MAX_MESSAGE_LENGTH = 447;
+	// the same message (source and text) is written at most this often per rate limit interval
+	static const int MAX_REPEATS = 5;
+	static const sf::Time RATE_LIMIT_INTERVAL;
 
 private:
-	LogLevel m_logLevel;
+	struct Entry final {
+		std::atomic<std::size_t> sequence;
+		LogLevel level;
+		char source[MAX_SOURCE_LENGTH + 1];
+		char message[MAX_MESSAGE_LENGTH + 1];
+	};
+
+	struct RepeatInfo final {
+		int count = 0;
+		sf::Time intervalStart;
+	};
+
+	void run();
+	// waits until a message is logged or the logger stops
+	void waitForMessages();
+	void wakeWriter() const;
+	void waitUntilWritten(std::size_t pos) const;
+	// writes all messages in the buffer.
+	void drain();
+	void write(LogLevel level, const std::string& source, const std::string& message);
+	void writeLine(LogLevel level, const std::string& line);
+	// returns false if the message has been written too often in the current interval.
+	bool checkRateLimit(const std::string& source, const std::string& message);
+	void flushRepeats(bool force);
+	bool isEnabled(LogLevel level, const std::string& source) const;
+	void updateMaxLogLevel();
+	void rotateLogFile();
+
+private:
+	std::atomic<LogLevel> m_logLevel;
+	// the highest level of all channels, used to reject messages on the calling thread.
+	std::atomic<LogLevel> m_maxLogLevel;
+
+	std::unique_ptr<Entry[]> m_buffer;
+	mutable std::atomic<std::size_t> m_enqueuePos;
+	std::size_t m_dequeuePos = 0;
+	mutable std::atomic<std::size_t> m_droppedCount;
+	std::atomic<std::size_t> m_writtenPos;
+
+	std::thread m_thread;
+	std::atomic<bool> m_isRunning;
+	// set while the writer thread waits for messages, so only then the callers notify it
+	std::atomic<bool> m_isWaiting;
+	mutable std::mutex m_wakeMutex;
+	mutable std::condition_variable m_wakeCondition;
+
+	// accessed by the setters and the writer thread
+	mutable std::mutex m_mutex;
+	mutable std::condition_variable m_flushCondition;
+	std::map<std::string, LogLevel> m_channelLogLevels;
+	std::ofstream m_logFile;
+	std::string m_logFilePath;
+	std::size_t m_maxLogFileSize = 0;
+	std::size_t m_logFileSize = 0;
+
+	// only accessed by the writer thread
+	sf::Clock m_clock;
+	std::map<std::string, RepeatInfo> m_repeats;
 
 	const std::string RED = "\033[31m";
 	const std::string GREEN = "\033[32m";
@@ -12,6 +12,8 @@ class DialogueWindow;
 class Dialogue final {
 public:
 	void reload(const std::string& id, WorldScreen* screen, DialogueWindow* window);
+	// clears the dialogue for a loader without a screen and window, used to check the scripts
+	void reset(const std::string& id, const std::string& textType);
 	const std::string& getID() const;
 	const std::string& getTextType() const;
 	void addNode(int tag, const DialogueNode& node);
@@ -22,11 +24,13 @@ public:
 	bool isEndable() const;
 	bool hasNode(int tag) const;
 	bool isTradeNode(int nodeTag) const;
+	const std::map<int, DialogueNode>& getNodes() const;
 
 private:
 	WorldScreen* m_screen;
 	DialogueWindow* m_window;
 	DialogueNode* m_currentNode;
 	std::string m_id;
+	std::string m_textType;
 	std::map<int, DialogueNode> m_nodes;
 };
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "global.h"
+#include "Structs/DialogueNode.h"
+#include "Enums/Language.h"
+
+#include <functional>
+
+enum class DialogueQueryType {
+	QuestState,
+	QuestComplete,
+	Condition,
+	QuestCondition,
+	QuestDescription,
+	SpellLearned,
+	SpellEquipped,
+	HasItem,
+	ItemEquipped,
+	ItemAmount,
+	Reputation,
+	Guild
+};
+
+// a question a dialogue script asked about the game state while building its nodes, and the answer it got
+struct DialogueQuery final {
+	DialogueQueryType type;
+	std::string first;
+	std::string second;
+	int number = 0;
+	// the answer, 0 or 1 for the yes / no questions. The guild is answered in the text.
+	int value = 0;
+	std::string text;
+};
+
+// the nodes a dialogue script built and the queries it asked to build them, in order
+struct DialogueGraph final {
+	std::string textType;
+	Language language = Language::VOID;
+	std::vector<DialogueQuery> queries;
+	std::map<int, DialogueNode> nodes;
+	int root = -1;
+};
+
+// returns whether this query still gets the same answer
+typedef std::function<bool(const DialogueQuery&)> DialogueQueryCheck;
+
+// Keeps the node graphs built by the dialogue scripts, so reopening or reloading a dialogue doesn't run its script again.
+// A script only depends on the answers to its queries: if all the queries of a graph still get the same answers,
+// in the order the script asked them, the script would take the same branches and build the same graph again.
+class DialogueGraphCache final {
+public:
+	// returns a graph of this dialogue that is still valid for the game state, or nullptr
+	const DialogueGraph* findGraph(const std::string& dialogueID, const std::string& textType, Language language, const DialogueQueryCheck& check) const;
+	void addGraph(const std::string& dialogueID, const DialogueGraph& graph);
+	void clear();
+	int getGraphCount() const;
+
+	// the number of graphs kept per dialogue, the oldest one is dropped first
+	static const int MAX_GRAPHS;
+
+private:
+	std::map<std::string, std::vector<DialogueGraph>> m_graphs;
+};
\ No newline at end of file
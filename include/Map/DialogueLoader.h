@@ -2,31 +2,45 @@
 
 #include "global.h"
 #include "Map/Dialogue.h"
+#include "Map/DialogueGraphCache.h"
 
 #include "Callbacks/WorldCallback.h"
 
 class WorldScreen;
+class CharacterCore;
 
 // helper class to load lua files for dialogues
 class DialogueLoader final {
 public:
 	DialogueLoader(Dialogue& dialogue, WorldScreen* screen);
+	// a loader that asks its queries on this core, used to check the scripts without a world
+	DialogueLoader(Dialogue& dialogue, CharacterCore* core);
 	~DialogueLoader();
 	void loadDialogue();
 
-	// methods for questions about the current game state
-	bool isQuestState(const std::string& questID, const std::string& state) const { return m_worldCallback->isQuestState(questID, state); }
-	bool isQuestComplete(const std::string& questID) const { return m_worldCallback->isQuestComplete(questID); }
-	bool isConditionFulfilled(const std::string& conditionType, const std::string& condition) const { return m_worldCallback->isConditionFulfilled(conditionType, condition); }
-	bool isQuestConditionFulfilled(const std::string& quest, const std::string& condition) const { return m_worldCallback->isQuestConditionFulfilled(quest, condition); }
-	bool isQuestDescriptionUnlocked(const std::string& quest, int description) const { return m_worldCallback->isQuestDescriptionUnlocked(quest, description); }
-	bool isSpellLearned(int spellID) const { return m_worldCallback->isSpellLearned(spellID); }
-	bool isSpellEquipped(int spellID) const { return m_worldCallback->isSpellEquipped(spellID); }
-	bool hasItem(const std::string& item, int amount) const { return m_worldCallback->hasItem(item, amount); }
-	bool isItemEquipped(const std::string& item) const { return m_worldCallback->isItemEquipped(item); }
-	int getItemAmount(const std::string& item) const { return m_worldCallback->getItemAmount(item); }
-	int getReputation(const std::string& fractionID) const { return m_worldCallback->getReputation(fractionID); }
-	std::string getGuild() const { return m_worldCallback->getGuild(); }
+	// methods for questions about the current game state, the questions and their answers are recorded
+	bool isQuestState(const std::string& questID, const std::string& state);
+	bool isQuestComplete(const std::string& questID);
+	bool isConditionFulfilled(const std::string& conditionType, const std::string& condition);
+	bool isQuestConditionFulfilled(const std::string& quest, const std::string& condition);
+	bool isQuestDescriptionUnlocked(const std::string& quest, int description);
+	bool isSpellLearned(int spellID);
+	bool isSpellEquipped(int spellID);
+	bool hasItem(const std::string& item, int amount);
+	bool isItemEquipped(const std::string& item);
+	int getItemAmount(const std::string& item);
+	int getReputation(const std::string& fractionID);
+	std::string getGuild();
+
+	// the questions the script asked, in order
+	const std::vector<DialogueQuery>& getQueries() const;
+	int getRoot() const;
+	// whether the script ran through and didn't use random numbers, so its nodes only depend on the queries
+	bool isCacheable() const;
+	// answers the query on the current game state
+	static void answer(DialogueQuery& query, const WorldCallback& callback);
+	// returns whether the query still gets the recorded answer
+	static bool isUnchanged(const DialogueQuery& query, const WorldCallback& callback);
 
 	// methods to create a node
 	void createCendricNode(int tag, int nextTag, const std::string& text);
@@ -66,9 +80,14 @@ public:
 	void addNode();
 	void setRoot(int tag);
 
+private:
+	const DialogueQuery& ask(DialogueQueryType type, const std::string& first, const std::string& second = "", int number = 0);
+
 private:
 	int m_root = -1;
 	Dialogue& m_dialogue;
 	WorldCallback* m_worldCallback;
 	DialogueNode* m_currentNode = nullptr;
+	std::vector<DialogueQuery> m_queries;
+	bool m_isCacheable = false;
 };
\ No newline at end of file
@@ -36,6 +36,8 @@ public:
 protected:
 	virtual std::string getSpritePath() const { return ""; }
 	virtual std::string getSoundPath() const { return ""; }
+	// sets whether this tile is collidable and notifies the path finder if that changed
+	void setCollidable(bool isCollidable);
 	// dynamic tile textures have a border (border width in pixel)
 	const int BORDER = 1;
 	bool m_isCollidable = false;
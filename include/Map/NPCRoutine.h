@@ -5,6 +5,7 @@
 #include "TextProvider.h"
 #include "Structs/DialogueNode.h"
 #include "Structs/RoutineStep.h"
+#include "Map/PathFinder.h"
 
 class GameScreen;
 class DialogueWindow;
@@ -23,6 +24,16 @@ public:
 	void setVelocity(float velocity);
 	NPC* getNPC() const;
 
+private:
+	// moves the npc towards the goal of the current going to step, using the path finder if the direct route is blocked.
+	// returns whether the goal has been reached.
+	bool updateGoingTo(const sf::Vector2f& goal, const sf::Time& frameTime);
+	// plans the route to the goal, returns false if the path is still being searched.
+	bool updateRoute(const sf::Vector2f& goal);
+	// converts a path tile to the npc position that centers the npc bounding box on it
+	sf::Vector2f getWaypointPosition(const sf::Vector2i& tile) const;
+	PathFinder* getPathFinder() const;
+
 private:
 	NPC* m_npc;
 	std::string m_id = "";
@@ -31,4 +42,13 @@ private:
 	sf::Time m_remainingStepTime = sf::Time::Zero;
 	int m_currentStepID;
 	float m_velocity = 50.f;
+
+	// the route to the goal of the current going to step
+	std::vector<sf::Vector2f> m_waypoints;
+	int m_currentWaypoint = 0;
+	sf::Vector2f m_routeGoal;
+	bool m_isRouteValid = false;
+	bool m_isPathPending = false;
+	bool m_isFollowingPath = false;
+	uint64_t m_pathKey = 0;
 };
\ No newline at end of file
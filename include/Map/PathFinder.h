@@ -0,0 +1,127 @@
+#pragma once
+
+#include "global.h"
+#include "Structs/MapData.h"
+
+#include <cstdint>
+#include <deque>
+#include <queue>
+
+class GameObject;
+
+enum class PathState {
+	VOID,
+	Pending,
+	Found,
+	NotFound
+};
+
+// a path search result, stored per (start, goal) pair.
+struct PathCacheEntry final {
+	PathState state = PathState::VOID;
+	// jump points from start to goal (tile coordinates). consecutive points are always axis aligned.
+	std::vector<sf::Vector2i> waypoints;
+};
+
+// Finds paths on the collidable grid of a map, using a 4-connected jump point search.
+// Searches are requested asynchronously and processed in update() with a bounded amount of work per frame.
+// Results are cached per (start, goal) tile pair and invalidated when collidable dynamic tiles (doors) change.
+class PathFinder final {
+public:
+	// builds the grid from the collidable tiles, rects and triangles of the map data and the collidable dynamic tiles
+	void load(const MapData& data, const std::vector<GameObject*>* dynamicTiles);
+	void dispose();
+	bool isLoaded() const;
+
+	// processes pending searches, doing at most SEARCH_BUDGET steps of work.
+	void update();
+
+	// requests a path between two world positions. Returns the key to poll the result with.
+	// if the path is already cached, no new search is started.
+	uint64_t requestPath(const sf::Vector2f& start, const sf::Vector2f& goal);
+	// returns VOID if the path of this key is unknown, i.e. it has never been requested or it has been invalidated.
+	PathState getPathState(uint64_t key) const;
+	// returns the waypoints of a found path or nullptr if there is none (yet)
+	const std::vector<sf::Vector2i>* getWaypoints(uint64_t key) const;
+
+	// returns whether the straight route that goes first horizontally, then vertically is free of obstacles.
+	bool isDirectRouteFree(const sf::Vector2f& start, const sf::Vector2f& goal) const;
+	bool isBlocked(const sf::Vector2i& tile) const;
+
+	// a dynamic tile with this bounding box changed its collidable state. invalidates affected cached paths.
+	void notifyCollidableChanged(const sf::FloatRect& boundingBox, bool isCollidable);
+
+	// work done in the last update call. Used for benchmarking.
+	int getLastUpdateWork() const;
+	int getPendingSearchCount() const;
+
+	static sf::Vector2i toTile(const sf::Vector2f& position);
+	static sf::Vector2f toPosition(const sf::Vector2i& tile);
+
+	static const int SEARCH_BUDGET;
+
+private:
+	struct SearchNode final {
+		int f;
+		int index;
+		bool operator>(const SearchNode& other) const { return f > other.f || (f == other.f && index > other.index); }
+	};
+
+	// state of the search in progress. Can be resumed over multiple frames.
+	struct Search final {
+		uint64_t key;
+		int start;
+		int goal;
+		bool isStarted = false;
+	};
+
+	bool isBlocked(int x, int y) const;
+	int index(int x, int y) const { return y * m_size.x + x; }
+	static uint64_t getKey(const sf::Vector2i& start, const sf::Vector2i& goal);
+	int heuristic(int from, int to) const;
+
+	void startSearch(Search& search);
+	// continues the search until it finishes or the budget is used up. Returns true if the search is finished.
+	bool continueSearch(Search& search, int& budget);
+	void finishSearch(Search& search, bool found);
+	void expand(int node, int goal);
+	void addSuccessor(int jumpPoint, int parent, int goal);
+
+	int jumpHorizontal(int x, int y, int dx, int goal);
+	int jumpVertical(int x, int y, int dy, int goal);
+	// whether a horizontal move in direction dx has a forced neighbour on this tile
+	bool isForcedHorizontal(int x, int y, int dx) const;
+	// whether the tiles between fromX (exclusive) and toX (inclusive) of this row are free
+	bool isRowFree(int fromX, int toX, int y) const;
+	// recomputes the horizontal jump points of the rows from top to bottom
+	void updateJumpPoints(int top, int bottom);
+
+	void markCollidable(const sf::FloatRect& boundingBox, int delta);
+	void invalidate(int tile, bool isBlocked);
+	bool crossesTile(const std::vector<sf::Vector2i>& waypoints, const sf::Vector2i& tile) const;
+
+private:
+	bool m_isLoaded = false;
+	sf::Vector2i m_size;
+	std::vector<bool> m_staticBlocked;
+	std::vector<int> m_dynamicBlocked;
+	// per tile the jump point a horizontal move to the right / left finds if it has no goal in this row, -1 if it hits an obstacle.
+	// vertical moves look them up on every step instead of jumping horizontally.
+	std::vector<int> m_jumpRight;
+	std::vector<int> m_jumpLeft;
+
+	std::map<uint64_t, PathCacheEntry> m_cache;
+	std::deque<Search> m_searches;
+
+	// per node search data, reused by all searches. A node is only valid if its stamp matches the current search stamp.
+	std::vector<int> m_gScore;
+	std::vector<int> m_parent;
+	std::vector<unsigned int> m_stamp;
+	unsigned int m_currentStamp = 0;
+	std::priority_queue<SearchNode, std::vector<SearchNode>, std::greater<SearchNode>> m_openList;
+
+	int m_work = 0;
+	int m_lastUpdateWork = 0;
+
+	static const size_t MAX_CACHE_SIZE;
+};
\ No newline at end of file
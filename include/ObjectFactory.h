@@ -6,6 +6,7 @@
 #include "Enums/MapDynamicTileID.h"
 #include "Enums/LevelDynamicTileID.h"
 #include "Steam/CendricAchievements.h"
+#include "GameplayEventBus.h"
 
 class Enemy;
 class Spell;
@@ -38,11 +39,15 @@ public:
 	void registerMapDynamicTile(MapDynamicTileID id, MapDynamicTileConstructor constructor);
 
 	Achievement* createAchievement(AchievementID id);
-	void registerAchievement(AchievementID id, AchievementConstructor constructor);
+	void registerAchievement(AchievementID id, AchievementConstructor constructor,
+		const std::vector<GameplayEventType>& events = std::vector<GameplayEventType>());
+	// the gameplay events this achievement is notified on
+	const std::vector<GameplayEventType>& getAchievementEvents(AchievementID id) const;
 
 private:
 	std::map<EnemyID, EnemyConstructor> enemyRegistry;
 	std::map<LevelDynamicTileID, LevelDynamicTileConstructor> levelDynamicTileRegistry;
 	std::map<MapDynamicTileID, MapDynamicTileConstructor> mapDynamicTileRegistry;
 	std::map<AchievementID, AchievementConstructor> achievementRegistry;
+	std::map<AchievementID, std::vector<GameplayEventType>> achievementEventRegistry;
 };
\ No newline at end of file
@@ -19,11 +19,17 @@
     static Registrar registrar(ID, \
         []() -> Achievement* { return new TYPE();});
 
+// registers an achievement that is notified on these gameplay events until it is unlocked
+#define REGISTER_ACHIEVEMENT_EVENTS(ID, TYPE, ...) \
+    static Registrar registrar(ID, \
+        []() -> Achievement* { return new TYPE();}, { __VA_ARGS__ });
+
 class Registrar final {
 public:
 	Registrar(EnemyID id, EnemyConstructor constructor);
 	Registrar(LevelDynamicTileID id, LevelDynamicTileConstructor constructor);
 	Registrar(MapDynamicTileID id, MapDynamicTileConstructor constructor);
 	Registrar(AchievementID id, AchievementConstructor constructor);
+	Registrar(AchievementID id, AchievementConstructor constructor, const std::vector<GameplayEventType>& events);
 	Registrar(const std::vector<std::pair<AchievementID, AchievementConstructor>>& ids);
 };
\ No newline at end of file
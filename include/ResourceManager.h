@@ -10,6 +10,11 @@
 #include "FileIO/ConfigurationReader.h"
 
 #include "GUI/BitmapFont.h"
+#include "World/TextureAtlas.h"
+#include "World/AnimationLibrary.h"
+#include "Level/LevelMinimaps.h"
+
+#include <mutex>
 
 class Item;
 
@@ -45,9 +50,13 @@ public:
 
 	void deleteLevelResources();
 	void loadLevelResources();
+	// decodes the level textures, so loadLevelResources only has to upload them. Safe to call from worker threads.
+	void decodeLevelResources();
 
 	void deleteMapResources();
 	void loadMapResources();
+	// decodes the map textures, so loadMapResources only has to upload them. Safe to call from worker threads.
+	void decodeMapResources();
 
 	void deleteItemResources();
 
@@ -71,6 +80,9 @@ public:
 
 	// loads a texture found at filename. If the resource type is Unique, the owner must be specified.
 	void loadTexture(const std::string& filename, ResourceType type, void* owner = nullptr);
+	// decodes the image of the texture found at filename without uploading it. The next loadTexture call for this filename
+	// only uploads the decoded image. Safe to call from worker threads.
+	void decodeTexture(const std::string& filename);
 	// loads a soundbuffer found at filename. If the resource type is Unique, the owner must be specified.
 	void loadSoundbuffer(const std::string& filename, ResourceType type, void* owner = nullptr);
 	// loads a font found at filename. If the resource type is Unique, the owner must be specified.
@@ -78,10 +90,25 @@ public:
 	// loads a bitmap font found at filename. If the resource type is Unique, the owner must be specified.
 	void loadBitmapFont(const std::string& filename, ResourceType type, void* owner = nullptr);
 	
-	sf::Texture* getTexture(const std::string& filename) const;
+	sf::Texture* getTexture(const std::string& filename);
+	// returns the texture of a sprite sheet for animations. A sprite sheet packed in the texture atlas has no pixels
+	// until one of its animations misses frames in the atlas, use getTexture to draw it directly.
+	const sf::Texture* getSpriteSheet(const std::string& filename);
 	sf::SoundBuffer* getSoundBuffer(const std::string& filename) const;
 	sf::Font* getFont(const std::string& filename) const;
 	BitmapFont* getBitmapFont(const std::string& filename) const;
+	// maps these frames of a sprite sheet to their place in the texture atlas and returns the atlas page holding them.
+	// if the sprite sheet is not loaded by the resource manager or not all frames are packed, the frames are left unchanged
+	// and the sprite sheet is returned.
+	const sf::Texture* resolveAtlasFrames(const sf::Texture* spriteSheet, std::vector<sf::IntRect>& frames);
+	// returns the animation of this sprite sheet shared by all objects, the builder is only called the first time it is requested.
+	// the animation is deleted when the sprite sheet is released. The name must be unique for the sprite sheet.
+	const Animation* getAnimation(const std::string& spriteSheet, const std::string& name, int skinNr, const AnimationBuilder& builder);
+	// the minimaps of the levels, baked by the minimap baker
+	const LevelMinimaps& getLevelMinimaps() const;
+	// collects the frames of animations that are not in the texture atlas and adds them to the sprite list on exit,
+	// for the next run of the atlas packer. Enabled by starting the game with --collect-sprites.
+	void setCollectingSprites(bool isCollectingSprites);
 	// be aware that this will return nullptr in case of an invalid item.
 	Item* getItem(const std::string& itemID);
 
@@ -92,8 +119,18 @@ public:
 private:
 	void init();
 	void deleteResource(const std::string& filename);
+	// deletes the images of these textures that were decoded but never uploaded, e.g. if loading a world was aborted
+	void deleteDecodedImages(const std::vector<std::string>& filenames);
+	// adds the frames missing in the texture atlas to the sprite list
+	void saveUnpackedFrames() const;
 	// convenience template function, like baws.
 	template<typename T> void loadResource(std::map<std::string, T*>& holder, const std::string& typeName, const std::string& filename, ResourceType type, void* owner = nullptr);
+	template<typename T> bool loadResourceFromFile(T* resource, const std::string& filename, ResourceType type, void* owner);
+	// uses the decoded image of this texture if there is one. Sprite sheets packed in the texture atlas load their
+	// atlas page with the same resource type instead and are only uploaded once something needs their pixels.
+	bool loadResourceFromFile(sf::Texture* texture, const std::string& filename, ResourceType type, void* owner);
+	// uploads a packed sprite sheet that was not uploaded yet
+	void uploadSpriteSheet(sf::Texture* texture);
 
 	// this vector holds the level resources that are currently loaded
 	std::vector<std::string> m_levelResources;
@@ -106,6 +143,25 @@ private:
 	std::map<std::string, BitmapFont*> m_bitmapFonts;
 	std::map<std::string, sf::Font*> m_fonts;
 	std::map<std::string, Item*> m_items;
+	// the file names of the textures above, for the texture atlas lookups of animations
+	std::map<const sf::Texture*, std::string> m_texturePaths;
+	// packed sprite sheets that are not uploaded yet, their animations draw from the atlas pages
+	std::set<const sf::Texture*> m_pendingSpriteSheets;
+	// guards the resources above, worlds are loaded by multiple threads
+	mutable std::recursive_mutex m_mutex;
+
+	// images decoded by decodeTexture, waiting to be uploaded
+	std::map<std::string, sf::Image*> m_decodedImages;
+	std::mutex m_decodedImagesMutex;
+
+	// animations of sprite sheets found in the texture atlas draw from the atlas pages, so they share a texture
+	TextureAtlas m_textureAtlas;
+	// the animations shared by objects with the same sprite sheet
+	AnimationLibrary m_animationLibrary;
+	LevelMinimaps m_levelMinimaps;
+	// frames of animations that are not in the texture atlas. Collected if enabled and added to the sprite list.
+	std::map<std::string, std::vector<sf::IntRect>> m_unpackedFrames;
+	bool m_isCollectingSprites = false;
 
 	// a pool with sound buffers
 	std::vector<sf::Sound> m_soundPool;
@@ -5,6 +5,9 @@
 #include "Level/LevelMainCharacter.h"
 #include "WorldScreen.h"
 #include "Level/LevelInterface.h"
+#include "Level/DamageNumbers.h"
+#include "World/RenderPass.h"
+#include "World/JobSystem.h"
 
 #include "GUI/ButtonGroup.h"
 #include "GUI/YesOrNoForm.h"
@@ -12,6 +15,8 @@
 class Stopwatch;
 
 class LevelScreen final : public WorldScreen {
+	// compares the enemy updates with and without workers
+	friend class JobSystemTest;
 public:
 	LevelScreen(const std::string& levelID, CharacterCore* core);
 	
@@ -44,12 +49,14 @@ public:
 	const Level* getWorld() const override;
 	const LevelData* getWorldData() const override;
 
-	// extra render textures for particles using special blend
-	sf::RenderTexture& getParticleFGRenderTexture();
-	sf::RenderTexture& getParticleBGRenderTexture();
-	sf::RenderTexture& getParticleEQRenderTexture();
-
-	void setEquipmentColor(const sf::Color& color);
+	// extra render passes for particles using special blend
+	RenderPass& getParticleFGPass();
+	RenderPass& getParticleBGPass();
+	RenderPass& getParticleEQPass();
+	// all offscreen passes of the level, in the order they are composited
+	const std::vector<const RenderPass*>& getRenderPasses() const;
+	// the floating combat text of all mobs in this level
+	DamageNumbers* getDamageNumbers();
 
 	// the part of the world that can be loaded safely async.
 	void loadAsync() override;
@@ -80,13 +87,21 @@ private:
 
 	ScreenOverlay* m_gamePausedOverlay = nullptr;
 
-	sf::Color m_equipmentColor = COLOR_WHITE;
-	sf::RenderTexture m_particleBGRenderTexture;
-	sf::RenderTexture m_particleFGRenderTexture;
-	sf::RenderTexture m_particleEQRenderTexture;
-	sf::RenderTexture m_equipmentRenderTexture;
-	sf::BlendMode m_particleBlendMode;
-	void flushTexture(sf::RenderTarget& renderTarget, sf::RenderTexture& renderTexture, const sf::View& oldView, const sf::BlendMode& mode);
+	RenderPass m_particleBGPass;
+	RenderPass m_particleEQPass;
+	RenderPass m_particleFGPass;
+	RenderPass m_lightPass;
+	std::vector<const RenderPass*> m_renderPasses;
+	void logRenderPassStats() const;
+
+	DamageNumbers m_damageNumbers;
+
+	// lets all updated enemies think in parallel, then updates them in order
+	void updateEnemies(const sf::Time& frameTime);
+	JobSystem* m_jobSystem = nullptr;
+	std::vector<Enemy*> m_thinkingEnemies;
+	// below this many enemies, thinking on the workers costs more than it saves
+	static const int MIN_PARALLEL_ENEMIES;
 
 	void handleBookWindow(const sf::Time& frameTime);
 	void handleGameOver(const sf::Time& frameTime);
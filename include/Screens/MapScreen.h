@@ -3,6 +3,7 @@
 #include "global.h"
 #include "Map/Map.h"
 #include "Map/MapMainCharacter.h"
+#include "Map/PathFinder.h"
 #include "Screens/WorldScreen.h"
 #include "Screens/LoadingScreen.h"
 #include "GUI/DialogueWindow.h"
@@ -28,6 +29,7 @@ public:
 	const Map* getWorld() const override;
 	const MapData* getWorldData() const override;
 	MapMainCharacter* getMainCharacter() const override;
+	PathFinder* getPathFinder();
 	bool exitWorld() override;
 	void notifyBackFromMenu() override;
 	void notifyWaypointUnlocked() const;
@@ -46,14 +48,17 @@ private:
 	void notifyEquipmentReload() override;
 	void notifyNpcReload();
 
+	// reveals the tiles around the main character, only if it entered a new tile
 	void updateFogOfWar();
 
 private:
 	Map m_currentMap;
+	PathFinder m_pathFinder;
 	std::string m_mapID;
 	MapMainCharacter* m_mainChar = nullptr;
 	DialogueWindow* m_dialogueWindow = nullptr;
 	CookingWindow* m_cookingWindow = nullptr;
+	sf::Vector2i m_lastFogOfWarTile = sf::Vector2i(-1, -1);
 
 	void handleDialogueWindow(const sf::Time& frameTime);
 	void handleCookingWindow(const sf::Time& frameTime);
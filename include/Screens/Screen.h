@@ -2,6 +2,8 @@
 
 #include "global.h"
 #include "World/GameObject.h"
+#include "World/DepthOrder.h"
+#include "World/MousePicker.h"
 #include "ResourceManager.h"
 #include "CharacterCore.h"
 
@@ -70,6 +72,9 @@ protected:
 	void updateObjects(GameObjectType type, const sf::Time& frameTime);
 	// depth sorts all objects (y coord asc or desc) of type 'type'
 	void depthSortObjects(GameObjectType type, bool asc);
+	// lets the mouse picker resolve mouse over and clicks for the objects of type 'type'.
+	// layers added first are on top, they should be added in reverse render order.
+	void addPickableLayer(GameObjectType type);
 	// render all objects of type 'type'
 	void renderObjects(GameObjectType type, sf::RenderTarget& renderTarget);
 	// render all objects after foreground of type 'type'
@@ -82,8 +87,12 @@ protected:
 private:
 	// deletes all objects marked as 'disposed'
 	void deleteDisposedObjects();
+	// moves an added object into the vector of its type
+	void insertObject(GameObject* object);
 	std::vector<std::vector<GameObject*>> m_objects;
 	std::vector<GameObject*> m_toAdd;
+	std::map<GameObjectType, DepthOrder> m_depthOrders;
+	MousePicker m_mousePicker;
 	BitmapText m_tooltipText;
 
 	sf::Time m_tooltipTime = sf::Time::Zero;
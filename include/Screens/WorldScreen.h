@@ -5,6 +5,8 @@
 #include "ResourceManager.h"
 #include "Level/LevelInterface.h"
 #include "World/WeatherSystem.h"
+#include "World/TriggerIndex.h"
+#include "Map/DialogueGraphCache.h"
 #include "GUI/ProgressLog.h"
 #include "Structs/Condition.h"
 
@@ -67,8 +69,12 @@ public:
 	void notifyHintAdded(const std::string& hintKey);
 	// notifies that the godmode property has changed
 	virtual void toggleGodmode();
+	// adds a trigger to the screen and its trigger index and evaluates its conditions
+	void addTrigger(Trigger* trigger);
 	// reload all triggers, based on their conditions
 	void reloadTriggers();
+	// reload the triggers that reference this condition
+	void reloadTriggers(const Condition& condition);
 	// reloads a certain trigger
 	void reloadTrigger(Trigger* trigger) const;
 	// getter for the inventory of the interface
@@ -92,6 +98,8 @@ public:
 	bool isItemMonitored(const std::string& itemId) const;
 	// whether only to update the interface
 	bool isUpdateOnlyInterface() const;
+	// the node graphs of the dialogues held in this world
+	DialogueGraphCache& getDialogueCache();
 
 protected:
 	// handle quicksave
@@ -115,6 +123,9 @@ protected:
 	sf::Shader m_foregroundLayerShader;
 	static const std::string VERTEX_SHADER;
 
+	// sends the enter, stay and exit events of the triggers the main character overlaps
+	void updateTriggers();
+
 	// weather
 	WeatherSystem* m_weatherSystem = nullptr;
 	void loadWeather();
@@ -131,6 +142,12 @@ protected:
 	void checkMonitoredQuestItems(const std::string& itemID, int amount);
 
 private:
+	// triggers by their id in the trigger index, nullptr if disposed
+	std::vector<Trigger*> m_triggers;
+	TriggerIndex m_triggerIndex;
+	std::vector<TriggerEvent> m_triggerEvents;
+	DialogueGraphCache m_dialogueCache;
+
 	void updateOverlayQueue();
 	void clearOverlayQueue();
 };
\ No newline at end of file
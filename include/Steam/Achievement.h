@@ -2,6 +2,7 @@
 
 #include "global.h"
 #include "Steam/CendricAchievements.h"
+#include "GameplayEventBus.h"
 
 class CharacterCore;
 
@@ -12,4 +13,6 @@ public:
     
 	virtual bool notify(const std::string& message) { return false; };
 	virtual bool notifyCore(const CharacterCore* core) { return false; }
+	// a gameplay event this achievement is registered for. By default, its core condition is checked again.
+	virtual bool notifyEvent(const GameplayEvent& event, const CharacterCore* core) { return notifyCore(core); }
 };
\ No newline at end of file
@@ -7,6 +7,7 @@ class SteamAchievements;
 class CharacterCore;
 class Achievement;
 struct AchievementData;
+struct GameplayEvent;
 
 class AchievementManager final {
 public:
@@ -22,14 +23,24 @@ public:
 	void unlockAchievement(const std::string& achievement);
 	void unlockAchievement(AchievementID achievementId);
 
+	// returns VOID if there is no achievement with this name
+	static AchievementID getAchievementID(const std::string& achievement);
+
 private:
 	void initAchievements();
 	void clearAchievements();
+	// deletes the achievement and ends its event subscriptions
+	void removeAchievement(AchievementID achievementId);
+	void notifyEvent(AchievementID achievementId, const GameplayEvent& event);
+	// returns the achievement if it is still locked, else nullptr
+	Achievement* getAchievement(AchievementID achievementId) const;
 
 private:
 	CharacterCore* m_characterCore = nullptr;
 	SteamAchievements* m_steamAchievements = nullptr;
 	int m_gameId = -1;
 	AchievementData* m_cendricAchievements = nullptr;
-	std::map<std::string, Achievement*> m_achievements;
+	// the locked achievements and their event subscriptions, indexed by achievement ID
+	std::vector<Achievement*> m_achievements;
+	std::vector<std::vector<int>> m_subscriptions;
 };
@@ -5,4 +5,5 @@
 class KeyAchievement final : public Achievement {
 public:
     bool notifyCore(const CharacterCore* core) override;
+    bool notifyEvent(const GameplayEvent& event, const CharacterCore* core) override;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 class MercenariesOrderAchievement final : public Achievement {
 public:
     bool notify(const std::string& message) override;
+    bool notifyEvent(const GameplayEvent& event, const CharacterCore* core) override;
 private:
 	int m_correctOrderState = 0;
 };
\ No newline at end of file
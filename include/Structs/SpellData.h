@@ -65,11 +65,18 @@ struct SpellData final {
 
 	Key inputKey = Key::VOID;
 
-	static SpellData getSpellData(SpellID id);
-	static std::vector<SpellModifierType> getAllowedModifiers(SpellID id);
+	// returns the definition of this spell from the spell table. The table is built once and indexed by the spell id,
+	// ids without a definition return a default spell data with id VOID. Copy it if it should be changed.
+	static const SpellData& getSpellData(SpellID id);
+	static const std::vector<SpellModifierType>& getAllowedModifiers(SpellID id);
 	static SpellCreator* getSpellCreator(const SpellData& data, const std::vector<SpellModifier>& modifiers, LevelMovableGameObject* owner);
 
 private:
+	static std::vector<SpellData> createSpellTable();
+	static std::vector<std::vector<SpellModifierType>> createAllowedModifiersTable();
+	static SpellData createSpellData(SpellID id);
+	static std::vector<SpellModifierType> createAllowedModifiers(SpellID id);
+
 	static SpellData getChopSpellData();
 
 	static SpellData getFireBallSpellData();
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "World/AnimationLibrary.h"
+
+/// Requests the animations of many spawned objects from an animation library and checks that each definition is built once and shared.
+class AnimationLibraryTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// requests the animations of one object with this skin, like an enemy does in loadAnimation
+	static std::vector<const Animation*> spawn(AnimationLibrary& library, int skinNr);
+
+	bool testShared();
+	bool testSkins();
+	bool testDefinition();
+	bool testDeleted();
+
+	static const std::string SPRITE_SHEET;
+	static const int SPAWN_COUNT;
+};
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "World/AtlasPacker.h"
+
+/// Packs synthetic sprite sheets into atlas pages and compares every packed frame pixel by pixel with its source.
+/// Also checks that the committed texture atlas covers the sprite list and that packed sprite sheets are only uploaded when drawn directly.
+class AtlasPackerTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	std::map<std::string, sf::Image> createSpriteSheets() const;
+	std::map<std::string, std::vector<sf::IntRect>> createSprites() const;
+
+	bool testPixels();
+	bool testLayout();
+	bool testDeterministic();
+	bool testInvalidFrames();
+	bool testCommittedAtlas();
+	bool testPendingSpriteSheet();
+
+	static const int PAGE_SIZE;
+};
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Plays cutscenes with generated images through the cutscene streamer, without rendering them.
+class CutsceneStreamerTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testNoBlockingPlayback();
+	bool testMemoryBudget();
+	bool testMissingImage();
+};
\ No newline at end of file
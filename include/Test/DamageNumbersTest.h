@@ -0,0 +1,22 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+class GameObject;
+
+/// Emits damage numbers for a few targets and checks that they are merged, capped per frame and kept in the fixed pool.
+class DamageNumbersTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testMerge();
+	bool testTargets();
+	bool testCap();
+	bool testPool();
+
+	// the damage numbers only compare their targets, so any address will do
+	int m_targets[2];
+	const GameObject* getTarget(int i) const;
+};
\ No newline at end of file
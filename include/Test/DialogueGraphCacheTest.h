@@ -0,0 +1,24 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "Map/DialogueGraphCache.h"
+
+/// Caches dialogue graphs with the queries that built them and checks which graph is found for a changing game state.
+/// Also runs every dialogue script on a new game and checks that its cached graph walks like the graph the script builds again.
+class DialogueGraphCacheTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// a graph built by a script that asked whether these conditions are fulfilled, its root is made of the answers as digits
+	static DialogueGraph createGraph(const std::map<std::string, int>& conditions);
+	// the nodes reachable from the root in the order of a depth first walk, written as text
+	static std::string getNodeSequence(const std::map<int, DialogueNode>& nodes, int root);
+
+	bool testFound();
+	bool testChanged();
+	bool testStates();
+	bool testTextType();
+	bool testScripts();
+};
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "Level/EquipmentAtlas.h"
+
+/// Bakes synthetic layers into an equipment atlas and compares the composed pixels against drawing the layers on top of each other.
+class EquipmentAtlasTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	std::vector<EquipmentAtlasLayer> createLayers() const;
+	// draws the layers' frames of this state and index onto a transparent frame, like a render texture does with alpha blending.
+	sf::Image drawLayered(const std::vector<EquipmentAtlasLayer>& layers, GameObjectState state, size_t index) const;
+
+	bool testFrameLayout();
+	bool testComposedPixels();
+	bool testEmptyLayers();
+
+	static const sf::Vector2i FRAME_SIZE;
+};
\ No newline at end of file
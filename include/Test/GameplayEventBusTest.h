@@ -0,0 +1,16 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Subscribes to a gameplay event bus and checks which subscribers get the published events.
+class GameplayEventBusTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testPublish();
+	bool testUnsubscribe();
+	bool testUnsubscribeInCallback();
+	bool testSubscribeInCallback();
+};
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Feeds synthetic window events into the keyboard state and checks the per frame key snapshots.
+class InputSnapshotTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testPressAndHold();
+	bool testRelease();
+	bool testTapWithinFrame();
+	bool testPolledThisFrame();
+	bool testLostFocus();
+	bool testInvalidKeys();
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Places interactive objects in an interaction index and checks which one is the nearest to a character moving between them.
+class InteractionIndexTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testNearest();
+	bool testHysteresis();
+	bool testDenseRoom();
+	bool testMoveAndRemove();
+};
\ No newline at end of file
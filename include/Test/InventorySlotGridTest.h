@@ -0,0 +1,31 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+class InventorySlotGrid;
+
+/// Scrolls an inventory slot grid over real items and checks which item each slot is bound to,
+/// also while a slot is selected and dragged around.
+class InventorySlotGridTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testScroll();
+	bool testScrollWhileDragging();
+	bool testRemoveWhileScrolledAway();
+
+	// the sorted ids of some items in the database
+	static std::vector<std::string> getItemIDs();
+	static void setItems(InventorySlotGrid& grid, const std::vector<std::string>& itemIDs);
+	static void scrollToRow(InventorySlotGrid& grid, int row);
+	// the index of the first bound item when the grid is scrolled to the end
+	static int getLastFirstIndex(int itemCount);
+	// whether the live slots are bound to the items starting at this index, in order
+	static bool isBoundInOrder(const InventorySlotGrid& grid, const std::vector<std::string>& itemIDs, int firstIndex);
+
+	static const int COLUMNS;
+	static const int VISIBLE_ROWS;
+	static const int ITEM_COUNT;
+};
\ No newline at end of file
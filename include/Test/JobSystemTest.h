@@ -0,0 +1,31 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "World/JobSystem.h"
+
+class CharacterCore;
+class LevelScreen;
+
+/// Runs jobs on the job system and lets the enemies of a real level think on workers and on one thread,
+/// comparing their targets and positions frame by frame.
+class JobSystemTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// loads the level like the loading screen does, spawns enemies of both sides around the main character
+	// and replaces the job system of the level with one of this many workers.
+	static LevelScreen* loadLevel(CharacterCore* core, int workerCount);
+	static void unloadLevel(LevelScreen* screen);
+	// the index of the target of each enemy, -1 without target and -2 for the main character
+	static std::vector<int> getTargets(LevelScreen& screen);
+	static std::vector<sf::Vector2f> getPositions(LevelScreen& screen);
+
+	bool testAllJobs();
+	bool testDeterministic();
+
+	// the level and the entry the enemies are spawned around
+	static const std::string LEVEL_ID;
+	static const sf::Vector2f LEVEL_POSITION;
+};
\ No newline at end of file
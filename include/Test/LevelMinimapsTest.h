@@ -0,0 +1,23 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+#include "Level/LevelMinimaps.h"
+
+/// Renders the minimap of a small level and checks its pixels, the checksums and the minimap table that decides whether a baked minimap is used.
+/// Also bakes the minimaps of all levels again and checks them against the committed table and images.
+class LevelMinimapsTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// a level of 4x3 tiles, walkable tiles are marked with a dot, collidable ones with a hash
+	static WorldData createLevel();
+
+	bool testRender();
+	bool testChecksums();
+	bool testReadWrite();
+	bool testChangedLevel();
+	bool testBakedTable();
+};
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Runs loading pipelines with and without workers and checks that every stage starts after its dependencies,
+/// that failures skip the dependent stages and that loader thread stages stay on the calling thread.
+class LoadingPipelineTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// a diamond of stages with an independent chain next to it, run with this many workers
+	bool testStageOrder(int workerCount);
+	bool testFailedStage(int workerCount);
+	bool testLoaderThread(int workerCount);
+};
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Moves the mouse over overlapping objects in the layers of a mouse picker and checks which one is picked and when the picking pass runs.
+class MousePickerTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testTopmost();
+	bool testNotPickable();
+	bool testSkipped();
+	bool testMovedObject();
+	bool testMovedUnderMouse();
+	bool testClicked();
+	bool testRemoved();
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+struct MapData;
+class PathFinder;
+
+// Benchmarks the path finder on all maps and checks whether the per frame search budget holds,
+// whether the found paths are walkable and whether a breadth first search agrees on reachability.
+class PathFinderTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	void benchmarkMapFiles(TestResult& result);
+	bool benchmarkMap(const MapData& data, const std::string& mapPath);
+	static bool isValidPath(const PathFinder& pathFinder, const std::vector<sf::Vector2i>* waypoints,
+		const sf::Vector2i& start, const sf::Vector2i& goal);
+	static bool isReachable(const PathFinder& pathFinder, const sf::Vector2i& start, const sf::Vector2i& goal);
+
+	// how many paths are requested per map
+	const int QUERY_COUNT = 100;
+};
\ No newline at end of file
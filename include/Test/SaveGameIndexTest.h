@@ -0,0 +1,30 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "FileIO/SaveGameIndex.h"
+#include "Structs/CharacterCoreData.h"
+
+/// Writes a folder of large saves and checks that listing them never parses them and only reads their first lines once they are indexed.
+class SaveGameIndexTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	static CharacterCoreData createData(int nr);
+	static std::string getSaveFilename(int nr);
+	static bool isSameHeader(const SaveGameHeader& header, const CharacterCoreData& data);
+	void writeSaves();
+	void removeSaves();
+
+	bool testHeaders();
+	bool testIndexed();
+	bool testChanged();
+	bool testTampered();
+	bool testLegacy();
+
+	std::vector<std::string> m_filenames;
+	long long m_totalSize = 0;
+
+	static const int SAVE_COUNT;
+};
\ No newline at end of file
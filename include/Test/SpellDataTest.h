@@ -0,0 +1,19 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "Enums/SpellID.h"
+
+struct SpellData;
+
+/// Validates the spell table: every defined spell sits at the index of its id and has sane values.
+class SpellDataTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	void checkSpellTable(TestResult& result);
+	bool checkSpellData(const SpellData& data, SpellID id);
+	bool checkAllowedModifiers(SpellID id);
+	void checkUnknownIds(TestResult& result);
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+#include "Level/StatusEffectScheduler.h"
+
+/// Schedules buff expiries and dot ticks on a status effect scheduler and checks that they come due exactly once, in order and without looking at every event each frame.
+class StatusEffectSchedulerTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// updates the scheduler with 60 fps for this time and pops the events due, rescheduling the ticks
+	static std::vector<StatusEffectEvent> run(StatusEffectScheduler& scheduler, const sf::Time& time, int tickID, int& touched);
+
+	bool testExact();
+	bool testOrder();
+	bool testFarEvents();
+	bool testTicks();
+};
\ No newline at end of file
@@ -15,4 +15,8 @@ public:
 
 	/// returns whether test was successful
 	virtual TestResult runTest() = 0;
+
+protected:
+	/// counts a single check of the test and logs its name if it failed
+	void check(TestResult& result, bool success, const std::string& name);
 };
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+#include "Level/DynamicTiles/TileSimulation.h"
+
+/// Advances the motions of moving and swinging tiles every frame and in the few long steps of a tile far from the main character, and checks that both end in the same state.
+class TileSimulationTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	// frame times between 10 and 40 ms, the same for every test
+	static std::vector<sf::Time> getFrameTimes(int count);
+
+	bool testClock();
+	bool testBackAndForth();
+	bool testPendulum();
+	bool testCatchUp();
+};
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+
+/// Moves a character bounding box over triggers in a trigger index and checks the generated enter, stay and exit events.
+class TriggerIndexTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	bool testEnterStayExit();
+	bool testSpawnOnTrigger();
+	bool testLargeTrigger();
+	bool testRemove();
+	bool testConditions();
+};
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "global.h"
+#include "Test/Test.h"
+#include "World/WeatherSystem.h"
+
+/// Loads the weather types into a weather system and checks that the particles fill the view, wrap around the field and follow the camera.
+class WeatherSystemTest final : public Test {
+public:
+	TestResult runTest() override;
+
+private:
+	static WeatherData createData(const std::string& weather);
+	static bool isInField(const WeatherSystem& weather);
+
+	bool testTypes();
+	bool testCount();
+	bool testWrapping();
+	bool testCamera();
+};
\ No newline at end of file
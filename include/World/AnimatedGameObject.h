@@ -18,6 +18,8 @@ public:
 	if that state already has an animation, it will delete the old animation and replace it with this animation.
 	*/
 	void addAnimation(GameObjectState state, Animation* animation);
+	// insert a shared animation of the resource manager for a GameObjectState. It is not deleted with this object.
+	void addSharedAnimation(GameObjectState state, const Animation* animation);
 	void playCurrentAnimation(bool play);
 	void loopCurrentAnimation(bool loop);
 
@@ -33,6 +35,7 @@ public:
 	void setState(GameObjectState state) override;
 	
 	const Animation* getAnimation(GameObjectState state) const;
+	const std::map<GameObjectState, const Animation*>& getAnimations() const;
 	const sf::Vector2f& getSpriteOffset() const;
 	const sf::Color& getCurrentSpriteColor() const;
 	bool isAnimationLocked() const;
@@ -41,11 +44,16 @@ public:
 
 protected:
 	AnimatedSprite m_animatedSprite;
-	std::map<GameObjectState, Animation*> m_animations;
+	std::map<GameObjectState, const Animation*> m_animations;
 	sf::Vector2f m_spriteOffset = sf::Vector2f(0.f, 0.f);
 	bool m_isAnimationLocked = false;
 
 private:
+	// deletes the animation of this state if this object owns it
+	void deleteAnimation(GameObjectState state);
+
+	// the animations added by addAnimation, deleted with this object
+	std::vector<Animation*> m_ownedAnimations;
 	// the sprite will reset its color as soon as this time is zero.
 	sf::Time m_coloredTime = sf::Time::Zero;
 	sf::Color m_currentSpriteColor = COLOR_WHITE;
@@ -47,9 +47,18 @@ public:
 	const sf::Time getAnimationTime() const;
 	bool isLooped() const;
 
+	// looks the frames up in the texture atlas, the animation draws from the atlas page if all of them are packed.
+	// the getters do this on first use after the frames or the sprite sheet changed.
+	void resolveFrames() const;
+
 private:
 	bool m_isLooped = true;
-	std::vector<sf::IntRect> m_frames;
 	sf::Time m_frameTime;
-	const sf::Texture* m_texture = nullptr;
+	// the frames and sprite sheet to draw, resolved from the ones below
+	mutable std::vector<sf::IntRect> m_frames;
+	mutable const sf::Texture* m_texture = nullptr;
+	mutable bool m_isResolved = false;
+	// the frames and sprite sheet as they were set, before the atlas lookup
+	std::vector<sf::IntRect> m_sourceFrames;
+	const sf::Texture* m_sourceTexture = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "global.h"
+#include "World/Animation.h"
+
+#include <functional>
+
+// fills the frames, frame time and looping of an animation. The sprite sheet is already set.
+typedef std::function<void(Animation&)> AnimationBuilder;
+
+// Holds the animation definitions shared by all objects using the same sprite sheet. Each animation is built once,
+// keyed by its sprite sheet, its name and the skin, the objects only keep their playback state in their AnimatedSprite.
+// The animations of a sprite sheet live as long as the sprite sheet is loaded.
+class AnimationLibrary final {
+public:
+	AnimationLibrary() {}
+	~AnimationLibrary();
+
+	// returns the animation with this name and skin, building it on the sprite sheet if it does not exist yet.
+	const Animation* getAnimation(const sf::Texture* spriteSheet, const std::string& spriteSheetPath,
+		const std::string& name, int skinNr, const AnimationBuilder& builder);
+	// deletes the animations of this sprite sheet, for when it is released
+	void deleteAnimations(const std::string& spriteSheetPath);
+	void clear();
+
+	int getAnimationCount() const;
+	// how many animations have been built in total, for the spawn statistics
+	int getBuildCount() const;
+
+private:
+	AnimationLibrary(const AnimationLibrary&) = delete;
+	AnimationLibrary& operator=(const AnimationLibrary&) = delete;
+
+	// the animations of a sprite sheet, keyed by name and skin
+	std::map<std::string, std::map<std::pair<std::string, int>, Animation*>> m_animations;
+	int m_buildCount = 0;
+};
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "global.h"
+#include "World/TextureAtlas.h"
+
+// Packs the frames of source sprite sheets into a few large atlas pages and writes the texture atlas table for them.
+// Only the frames are copied, so the empty space between them in the sheets is left out. The frames of a source
+// are never split across pages. Packing only works on images and the result only depends on the input,
+// so the same sprite list always gives the same pages.
+class AtlasPacker final {
+public:
+	explicit AtlasPacker(int pageSize = DEFAULT_PAGE_SIZE);
+
+	// packs these frames of these sprite sheets. The pages are named pagePrefix + index + ".png".
+	// returns false if some frames could not be packed, they are left out of the atlas.
+	bool pack(const std::map<std::string, std::vector<sf::IntRect>>& sprites,
+		const std::map<std::string, sf::Image>& spriteSheets, const std::string& pagePrefix);
+
+	const TextureAtlas& getAtlas() const;
+	const std::vector<sf::Image>& getPages() const;
+
+	// transparent pixels between two frames, so they don't bleed into each other when they're smoothed
+	static const int PADDING;
+	static const int DEFAULT_PAGE_SIZE;
+
+private:
+	struct Shelf final {
+		int y;
+		int height;
+		int width;
+	};
+
+	struct Page final {
+		std::vector<Shelf> shelves;
+		sf::Vector2i size = sf::Vector2i(PADDING, PADDING);
+	};
+
+	// finds a place for a frame of this size on the page and reserves it. Returns false if the page is full.
+	bool place(Page& page, const sf::Vector2i& size, sf::Vector2i& position) const;
+	// returns the frames to pack: valid, without duplicates and sorted by height and width, largest first.
+	static std::vector<sf::IntRect> prepareFrames(const std::string& source, const std::vector<sf::IntRect>& frames,
+		const sf::Image& spriteSheet, bool& isValid);
+
+private:
+	int m_pageSize;
+	TextureAtlas m_atlas;
+	std::vector<sf::Image> m_pages;
+};
\ No newline at end of file
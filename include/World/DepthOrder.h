@@ -0,0 +1,38 @@
+#pragma once
+
+#include "global.h"
+
+#include <unordered_map>
+
+class GameObject;
+
+// Keeps a vector of game objects sorted by depth (bottom y coordinate) between frames.
+// The depths are cached and only refreshed when an object moved more than DEPTH_THRESHOLD,
+// and the order is restored with an insertion sort, which is close to O(n) as objects rarely swap.
+// Objects with equal depth keep the order in which they were added, so they don't flicker.
+class DepthOrder final {
+public:
+	// sorts 'objects' ascending or descending by depth. Objects may have been added to or removed from the vector since the last call.
+	void sort(std::vector<GameObject*>& objects, bool asc);
+
+	static const float DEPTH_THRESHOLD;
+
+private:
+	struct Entry final {
+		GameObject* object;
+		float depth;
+		unsigned int sequence;
+	};
+
+	// matches the cached entries with the current objects. Returns whether the order needs to be restored.
+	bool syncEntries(const std::vector<GameObject*>& objects);
+	static float getDepth(const GameObject* object);
+
+private:
+	std::vector<Entry> m_entries;
+	std::vector<Entry> m_syncedEntries;
+	// cached entry of an object, only filled when the objects have been removed or reordered
+	std::unordered_map<const GameObject*, size_t> m_entryIndices;
+	unsigned int m_nextSequence = 0;
+	bool m_isAsc = true;
+};
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 class Screen;
 class GameObjectComponent;
+class MousePicker;
 
 // A game object with position, bounding box, game state that can be added to a screen.
 class GameObject {
@@ -44,6 +45,10 @@ public:
 	virtual void setScreen(Screen* screen);
 	void setInputInDefaultView(bool value);
 	virtual void setViewable(bool value);
+	// objects that react to the mouse can be picked, the others don't cover the objects behind them
+	void setMousePickable(bool value);
+	// set by the screen for the objects in its picked layers, these only check whether they are picked
+	void setMousePicker(MousePicker* mousePicker);
 
 	const sf::FloatRect* getBoundingBox() const;
 	sf::Vector2f getPosition() const;
@@ -56,6 +61,8 @@ public:
 	// returns whether the game object should be deleted
 	// if this is set, the game object gets deleted in the next game loop
 	bool isDisposed() const;
+	bool isInputInDefaultView() const;
+	bool isMousePickable() const;
 	virtual GameObjectType getConfiguredType() const = 0;
 	Screen* getScreen() const;
 	GameObjectState getGameObjectState() const;
@@ -76,6 +83,8 @@ protected:
 
 	bool m_isDebugRendering = false;
 	bool m_isInputInDefaultView = false;
+	bool m_isMousePickable = false;
+	MousePicker* m_mousePicker = nullptr;
 
 protected:
 	void addComponent(GameObjectComponent* component);
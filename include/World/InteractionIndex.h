@@ -0,0 +1,51 @@
+#pragma once
+
+#include "global.h"
+#include "World/SpatialGrid.h"
+
+// A spatial index of the interactive objects around the main character, each registered once.
+// The objects are sorted into grid cells and only move between cells when their position changes,
+// so finding the nearest one only measures the squared distances to the objects in the cells around the character.
+class InteractionIndex final {
+public:
+	InteractionIndex();
+
+	// adds an object at this position and returns its id. The ids are consecutive, starting at 0.
+	int addObject(const sf::Vector2f& position, float range);
+	void moveObject(int object, const sf::Vector2f& position);
+	void setRange(int object, float range);
+	// disabled objects stay in their cell, but are never the nearest
+	void setEnabled(int object, bool isEnabled);
+	void removeObject(int object);
+	void clear();
+
+	// returns the id of the nearest enabled object that has this position in its range, or -1.
+	// the focused object stays the nearest until another one is nearer by the hysteresis, so equidistant objects don't take turns.
+	int getNearest(const sf::Vector2f& position, int focused);
+	// the number of objects whose distance was measured in the last query
+	int getTestedCount() const;
+	int getObjectCount() const;
+
+	static const float CELL_SIZE;
+	static const float HYSTERESIS;
+
+private:
+	struct Entry final {
+		sf::Vector2f position;
+		float range = 0.f;
+		uint64_t cell = 0;
+		bool isEnabled = true;
+		bool isRemoved = false;
+	};
+
+	bool isValid(int object) const;
+	// returns the squared distance to the object if it is enabled and in range, a negative value otherwise
+	float getSquaredDistance(int object, const sf::Vector2f& position);
+
+private:
+	std::vector<Entry> m_entries;
+	SpatialGrid m_grid;
+	std::vector<int> m_candidates;
+	float m_maxRange = 0.f;
+	int m_testedCount = 0;
+};
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "global.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// A small pool of worker threads for work inside a frame. parallelFor splits a range of independent jobs into chunks,
+// the calling thread works on them as well and returns when all of them are done.
+// Without workers, the jobs simply run on the calling thread in order.
+class JobSystem final {
+public:
+	explicit JobSystem(int workerCount);
+	~JobSystem();
+
+	// runs job(i) for every i in [0, count). The jobs must not depend on each other.
+	void parallelFor(int count, const std::function<void(int)>& job);
+	int getWorkerCount() const;
+
+private:
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	void work();
+	// runs chunks of the current jobs until none are left
+	void runChunks();
+
+private:
+	std::vector<std::thread> m_workers;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::condition_variable m_doneCondition;
+
+	// the current jobs, set under the mutex before the generation changes
+	const std::function<void(int)>* m_job = nullptr;
+	int m_count = 0;
+	int m_chunkSize = 1;
+	std::atomic<int> m_next;
+	int m_activeWorkers = 0;
+	unsigned int m_generation = 0;
+	bool m_isRunning = true;
+};
\ No newline at end of file
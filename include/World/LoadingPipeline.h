@@ -0,0 +1,66 @@
+#pragma once
+
+#include "global.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+enum class LoadingStageState {
+	Waiting,
+	Running,
+	Done,
+	Failed,
+	Skipped
+};
+
+// Loads a world in declared stages. A stage starts as soon as all stages it depends on are done,
+// so independent stages (tile layers, texture decoding, scripts) run in parallel on a small worker pool.
+// Every stage is timed, the times are logged per world to measure loading regressions.
+class LoadingPipeline final {
+public:
+	explicit LoadingPipeline(const std::string& name);
+
+	// adds a stage and returns its index. Dependencies must have been added before.
+	// stages on the loader thread run on the thread calling run(), use them for graphics uploads.
+	int addStage(const std::string& name, const std::function<bool()>& job,
+		const std::vector<int>& dependencies = std::vector<int>(), bool isOnLoaderThread = false);
+	// runs all stages on the calling thread and workerCount additional threads.
+	// if a stage fails, the stages depending on it are skipped. Returns whether all stages are done.
+	bool run(int workerCount);
+
+	LoadingStageState getStageState(int stage) const;
+	sf::Time getStageTime(int stage) const;
+	sf::Time getTotalTime() const;
+	// logs the time of each stage and the total time
+	void logTimes() const;
+
+	// the number of worker threads for loading, none if multithreading is disabled in the configuration.
+	static int getWorkerCount();
+	static const int MAX_WORKERS;
+
+private:
+	struct Stage final {
+		std::string name;
+		std::function<bool()> job;
+		std::vector<int> dependencies;
+		bool isOnLoaderThread = false;
+		LoadingStageState state = LoadingStageState::Waiting;
+		sf::Time time = sf::Time::Zero;
+	};
+
+	// runs stages until all are finished.
+	void work(bool isLoaderThread);
+	// returns a stage that is ready to run on this thread or -1. Skips stages whose dependencies failed.
+	// the mutex must be locked.
+	int takeStage(bool isLoaderThread);
+
+private:
+	std::string m_name;
+	std::vector<Stage> m_stages;
+	int m_remainingStages = 0;
+	sf::Time m_totalTime = sf::Time::Zero;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+};
\ No newline at end of file
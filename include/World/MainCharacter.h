@@ -2,6 +2,7 @@
 
 #include "global.h"
 #include "World/GameObject.h"
+#include "World/InteractionIndex.h"
 
 class InteractComponent;
 
@@ -11,8 +12,8 @@ public:
 	MainCharacter() {};
 	virtual ~MainCharacter() {};
 
-	// registers an interactive object that's in range
-	void registerInteractiveObject(InteractComponent* component);
+	// registers an interactive object or updates its position, range and state
+	void updateInteractiveObject(InteractComponent* component);
 	// notifies that an interactive object has been disposed
 	void notifyDisposed(InteractComponent* component);
 
@@ -20,6 +21,8 @@ protected:
 	void handleInteraction();
 
 protected:
+	InteractionIndex m_interactionIndex;
+	// the interactive objects by their id in the index, nullptr if disposed
 	std::vector<InteractComponent*> m_interactiveObjects;
 	InteractComponent* m_nearestInteractive = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "global.h"
+#include "Enums/GameObjectType.h"
+
+class GameObject;
+
+// Resolves once per frame which world object is under the mouse, so the objects of its layers don't test their bounding boxes themselves.
+// The layers are the object lists of a screen, the hit on the topmost layer wins and inside a layer the object rendered last.
+// The pass is skipped as long as the mouse stays on the same world position, no button is pressed, the picked object is still under it
+// and no other object of the layers has moved under it.
+class MousePicker final {
+public:
+	// adds the objects of this type as a layer below the layers added before
+	void addLayer(GameObjectType type, const std::vector<GameObject*>* objects);
+	bool hasLayer(GameObjectType type) const;
+	void clear();
+
+	// picks the object under this mouse position, in world coordinates. A pressed or clicked button always runs the pass, so no click is lost.
+	void update(const sf::Vector2f& mousePosition, bool isMouseInsideView, bool isMouseButtonDown);
+	// forces a new pass on the next update, called when objects are added to the layers
+	void setDirty();
+	// called when an object of the layers has moved, forces a new pass if it is now under the mouse
+	void notifyMoved(const GameObject* object);
+	// forgets this object, it is about to be deleted
+	void removeObject(const GameObject* object);
+
+	bool isPicked(const GameObject* object) const;
+	const GameObject* getPicked() const;
+	// the number of passes that searched the layers, skipped passes don't count
+	int getPassCount() const;
+
+private:
+	static bool isHit(const GameObject* object, const sf::Vector2f& mousePosition);
+
+private:
+	std::vector<GameObjectType> m_types;
+	std::vector<const std::vector<GameObject*>*> m_layers;
+
+	const GameObject* m_picked = nullptr;
+	sf::Vector2f m_mousePosition;
+	bool m_isMouseInsideView = false;
+	bool m_isDirty = true;
+	int m_passCount = 0;
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "global.h"
+
+#include <memory>
+
+// statistics of one render pass, accumulated since the last reset
+struct RenderPassStats final {
+	// how often objects requested the target to draw into it
+	int draws = 0;
+	// frames in which the pass was composited onto the screen
+	int composites = 0;
+	// frames in which the pass was empty and neither cleared nor composited
+	int skipped = 0;
+	// pixels written by compositing and clearing the pass
+	sf::Uint64 filledPixels = 0;
+};
+
+// An offscreen target that objects draw into and that is composited onto the screen at a fixed point of the frame.
+// Passes that nothing was drawn into since their last composite are neither composited nor cleared.
+// Passes that are never filled at the same time can share one texture, see share().
+class RenderPass final {
+public:
+	RenderPass(const std::string& name, const sf::BlendMode& blendMode, const sf::Color& clearColor = sf::Color(0, 0, 0, 0));
+
+	// creates an own texture of this size
+	void create(unsigned int width, unsigned int height);
+	// uses this texture, which is owned by someone else
+	void setTexture(sf::RenderTexture* texture);
+	// uses the texture of another pass. Anything drawn into one of the passes is composited by the first of them that flushes.
+	void share(RenderPass& other);
+
+	// returns the target to draw into, with its view set, and marks the pass as used.
+	sf::RenderTarget& getTarget(const sf::View& view);
+	// composites the target onto the render target in screen space and clears it, if anything has been drawn.
+	// the sprite is used to draw the texture, its color tints the pass.
+	void flush(sf::RenderTarget& renderTarget, sf::Sprite& sprite, const sf::Shader* shader = nullptr);
+
+	bool isEmpty() const;
+	const std::string& getName() const;
+	const RenderPassStats& getStats() const;
+	void resetStats();
+
+private:
+	struct Target final {
+		std::unique_ptr<sf::RenderTexture> ownedTexture;
+		sf::RenderTexture* texture = nullptr;
+		bool isDirty = false;
+	};
+
+	std::string m_name;
+	sf::BlendMode m_blendMode;
+	sf::Color m_clearColor;
+	std::shared_ptr<Target> m_target;
+	RenderPassStats m_stats;
+};
\ No newline at end of file
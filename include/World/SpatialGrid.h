@@ -0,0 +1,34 @@
+#pragma once
+
+#include "global.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+// A uniform grid that sorts ids into square cells, used by the spatial indexes of a world.
+// Only the cells that hold ids are stored, so the grid covers any world size and negative positions.
+class SpatialGrid final {
+public:
+	SpatialGrid(float cellSize);
+
+	// adds the id to all cells overlapped by this rect
+	void insert(int id, const sf::FloatRect& rect);
+	// adds the id to the cell of this position and returns the key of that cell
+	uint64_t insert(int id, const sf::Vector2f& position);
+	// removes the id from the cell with this key
+	void remove(int id, uint64_t key);
+	void clear();
+
+	// appends the ids of all cells overlapped by this rect, an id in several of these cells is appended for each of them
+	void collect(const sf::FloatRect& rect, std::vector<int>& ids) const;
+	uint64_t getKey(const sf::Vector2f& position) const;
+	float getCellSize() const;
+
+private:
+	sf::Vector2i toCell(const sf::Vector2f& position) const;
+	static uint64_t getKey(int x, int y);
+
+private:
+	float m_cellSize;
+	std::unordered_map<uint64_t, std::vector<int>> m_cells;
+};
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "global.h"
+
+// the place of a frame of a source sprite sheet on an atlas page
+struct TextureAtlasSprite final {
+	sf::IntRect sourceRect;
+	sf::Vector2i position;
+};
+
+// The remap table written by the atlas packer. It maps frames of source sprite sheets to their place on one of a few
+// large atlas pages, so the objects using them share a texture. All frames of a source are on the same page.
+class TextureAtlas final {
+public:
+	// reads and writes the table as text, one line per page or sprite.
+	bool read(std::istream& stream);
+	void write(std::ostream& stream) const;
+	bool load(const std::string& filename);
+	bool save(const std::string& filename) const;
+
+	// adds a page and returns its index
+	int addPage(const std::string& path);
+	void addSprite(const std::string& source, int page, const TextureAtlasSprite& sprite);
+	void clear();
+
+	// returns the sprite of this frame or nullptr if it is not packed.
+	const TextureAtlasSprite* getSprite(const std::string& source, const sf::IntRect& rect) const;
+	// returns the index of the page holding the frames of this source or -1 if it is not packed.
+	int getPage(const std::string& source) const;
+	const std::string& getPagePath(int page) const;
+	int getPageCount() const;
+	int getSpriteCount() const;
+	bool isPacked(const std::string& source) const;
+
+	// the sprite list is the input of the atlas packer: the frames used by animations, per source sprite sheet.
+	static bool readSpriteList(std::istream& stream, std::map<std::string, std::vector<sf::IntRect>>& sprites);
+	static void writeSpriteList(std::ostream& stream, const std::map<std::string, std::vector<sf::IntRect>>& sprites);
+
+	static const std::string ATLAS_PATH;
+	static const std::string SPRITE_LIST_PATH;
+
+private:
+	struct Source final {
+		int page;
+		std::vector<TextureAtlasSprite> sprites;
+	};
+
+	std::vector<std::string> m_pages;
+	std::map<std::string, Source> m_sources;
+};
\ No newline at end of file
@@ -14,7 +14,10 @@ public:
 	void dispose();
 
 	void initFogOfWar(const sf::Vector2i& mapSize);
+	// updates the fog of war quads of all tiles
 	void updateFogOfWar(const std::vector<bool>& tilesExplored);
+	// updates only the fog of war quads in the given tile rect (and its border, as the edges are blended)
+	void updateFogOfWar(const std::vector<bool>& tilesExplored, const sf::IntRect& dirtyRect);
 
 private:
 	// there is a border around each tile of size 1, to avoid rounding problems
@@ -26,4 +29,8 @@ private:
 	sf::Vector2i m_size;
 
 	void readAnimatedTile(int tileNumber, int layerNr, int i, int j, const WorldData& data);
+
+	// returns the alpha of the four quad corners (top left, top right, bottom right, bottom left) 
+	// for each 3x3 neighbourhood mask of fogged tiles. Bit (dy + 1) * 3 + (dx + 1) is set if the neighbour is fogged.
+	static const std::vector<sf::Uint8>& getFogOfWarLookup();
 };
\ No newline at end of file
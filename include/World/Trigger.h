@@ -3,6 +3,7 @@
 #include "global.h"
 #include "World/GameObject.h"
 #include "Structs/TriggerData.h"
+#include "World/TriggerIndex.h"
 
 class WorldScreen;
 
@@ -14,14 +15,21 @@ public:
 
 	void update(const sf::Time& frameTime) override;
 	void render(sf::RenderTarget& renderTarget) override;
+	// the main character entered, stays on or left this trigger. Executes the trigger if it's triggerable.
+	void notifyTriggerEvent(TriggerEventType type);
 	TriggerData& getData();
+	// the id of this trigger in the trigger index of its world screen
+	void setIndexID(int id);
+	int getIndexID() const;
 
 	GameObjectType getConfiguredType() const override;
 
 private:
 	GameObject* m_mainChar;
 	WorldScreen* m_worldScreen;
+	// the main character spawned on this trigger or stood on it while it was not triggerable, and hasn't left it yet
 	bool m_isOnTrigger = true;
+	int m_indexID = -1;
 	
 	TriggerData m_data;
 
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "global.h"
+#include "Structs/Condition.h"
+#include "World/SpatialGrid.h"
+
+enum class TriggerEventType {
+	Enter,
+	Stay,
+	Exit
+};
+
+struct TriggerEvent final {
+	TriggerEventType type;
+	int trigger;
+};
+
+// A static spatial index of the triggers of a world, built while the world is loaded.
+// The triggers are sorted into grid cells, so a character update only tests the triggers in the cells it overlaps.
+// It also knows which triggers reference a condition, so only these need to be reevaluated when it changes.
+class TriggerIndex final {
+public:
+	TriggerIndex();
+
+	// adds a trigger and returns its id. The ids are consecutive, starting at 0.
+	int addTrigger(const sf::FloatRect& rect, const std::vector<Condition>& conditions);
+	// removes a trigger, it won't generate any events anymore (not even an exit event).
+	void removeTrigger(int trigger);
+	void clear();
+
+	// generates the events for this character bounding box, ordered by trigger id:
+	// enter for triggers that are overlapped now, stay for triggers that were overlapped before, exit for triggers that are left.
+	// triggers overlapped on the first update get stay events, as the character spawned on them and never entered them.
+	void update(const sf::FloatRect& boundingBox, std::vector<TriggerEvent>& events);
+
+	// returns the ids of the triggers with a condition of this type and name, negated or not.
+	const std::vector<int>& getTriggers(const std::string& conditionType, const std::string& conditionName) const;
+	// returns whether the character overlapped this trigger on the last update.
+	bool isOverlapped(int trigger) const;
+	int getTriggerCount() const;
+
+	static const float CELL_SIZE;
+
+private:
+	struct Entry final {
+		sf::FloatRect rect;
+		bool isRemoved = false;
+		unsigned int stamp = 0;
+	};
+
+	// collects the ids of the triggers in all cells overlapped by this rect, each only once.
+	void collectCandidates(const sf::FloatRect& rect);
+
+private:
+	std::vector<Entry> m_entries;
+	SpatialGrid m_grid;
+	std::map<std::string, std::map<std::string, std::vector<int>>> m_conditionTriggers;
+
+	// triggers overlapped on the last update, sorted by id
+	std::vector<int> m_overlapped;
+	std::vector<int> m_candidates;
+	std::vector<int> m_nowOverlapped;
+	unsigned int m_currentStamp = 0;
+	bool m_isFirstUpdate = true;
+};
\ No newline at end of file
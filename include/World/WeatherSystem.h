@@ -3,17 +3,56 @@
 #include "global.h"
 
 #include "Structs/WeatherData.h"
-#include "Particles/ParticleSystem.h"
+#include "Enums/WeatherType.h"
 
+// a weather particle, positioned in the field
+struct WeatherParticle final {
+	sf::Vector2f position;
+	sf::Vector2f velocity;
+	float startSize;
+	float endSize;
+	// in radian, the particle texture is turned by this angle
+	float angle;
+	// how much the particle moves against the camera, 1 is attached to the world
+	float parallax;
+	// the time into its fading cycle
+	sf::Time time;
+};
+
+// Weather particles in camera space. The particles live on a field slightly larger than the view and wrap around its borders,
+// so only as many particles as fill the view are simulated and none of them is ever respawned. They fade in cycles
+// and are moved against the camera, each with its own parallax factor.
 class WeatherSystem final {
 public:
-	~WeatherSystem();
-
 	void load(const WeatherData* data, bool isLevel);
-	void update(const sf::Vector2f& center, const sf::Time& frameTime);
+	void update(const sf::Time& frameTime);
+	// moves the particles against the camera of this view and draws them over it
 	void render(sf::RenderTarget& renderTarget);
 
+	// moves the particles against the camera moving to this center
+	void moveCamera(const sf::Vector2f& center);
+
+	WeatherType getWeatherType() const;
+	const std::vector<WeatherParticle>& getParticles() const;
+	const sf::Vector2f& getFieldSize() const;
+
+	// resolves the weather name of maps and saves, VOID if there is no such weather
+	static WeatherType getWeatherType(const std::string& name);
+
+	// how long a particle takes to fade out
+	static const sf::Time CYCLE_TIME;
+
+private:
+	// moves the particle into the field, wrapping around its borders
+	void wrap(sf::Vector2f& position) const;
+
 private:
-	particles::ParticleSystem* m_ps = nullptr;
-	sf::Vector2f* m_center = nullptr;
+	WeatherType m_type = WeatherType::VOID;
+	std::vector<WeatherParticle> m_particles;
+	sf::VertexArray m_vertices;
+	const sf::Texture* m_texture = nullptr;
+
+	sf::Vector2f m_fieldSize;
+	sf::Vector2f m_center;
+	bool m_isCenterSet = false;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include "Structs/WorldCollisionQueryRecord.h"
 
 class MainCharacter;
+class LoadingPipeline;
 
 // a level or a map in the cendric world
 class World {
@@ -67,6 +68,8 @@ protected:
 	// helper method to calculate safe collision locations, regarding the collider bounding box 'bb'
 	// the record is updated with this safe values
 	void calculateCollisionLocations(WorldCollisionQueryRecord& rec, const sf::FloatRect& bb) const;
+	// adds the stages that decode and upload the tileset and build the three tile maps once the world data is read.
+	void addTileMapStages(LoadingPipeline& pipeline, const WorldData& data, int readStage);
 
 public:
 	// line direction from p1 to p2
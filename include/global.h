@@ -16,6 +16,7 @@ class ResourceManager;
 class InputController;
 class DatabaseManager;
 class AchievementManager;
+class GameplayEventBus;
 
 extern DatabaseManager* g_databaseManager;
 extern ResourceManager* g_resourceManager;
@@ -24,6 +25,7 @@ extern Logger* g_logger;
 extern TextProvider* g_textProvider;
 extern sf::RenderTexture* g_renderTexture;
 extern AchievementManager* g_achievementManager;
+extern GameplayEventBus* g_gameplayEventBus;
 
 extern std::string g_resourcePath;
 extern std::string g_documentsPath;
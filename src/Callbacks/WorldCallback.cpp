@@ -12,6 +12,11 @@ WorldCallback::WorldCallback(WorldScreen* screen) {
 	m_screen = screen;
 }
 
+WorldCallback::WorldCallback(CharacterCore* core) {
+	m_core = core;
+	m_screen = nullptr;
+}
+
 WorldCallback::~WorldCallback() {
 }
 
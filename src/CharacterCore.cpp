@@ -5,6 +5,7 @@
 #include "DatabaseManager.h"
 #include "GlobalResource.h"
 #include "Steam/AchievementManager.h"
+#include "GameplayEventBus.h"
 #include "FileIO/CharacterCoreReader.h"
 #include "FileIO/CharacterCoreWriter.h"
 
@@ -614,11 +615,12 @@ std::map<std::string, int>* CharacterCore::getItems() {
 
 void CharacterCore::addGold(int gold) {
 	m_data.gold += std::max(gold, 0);
-	g_achievementManager->notifyAchievementCore(ACH_GOLD_1000);
+	g_gameplayEventBus->publish(GameplayEventType::GoldChanged, m_data.gold);
 }
 
 void CharacterCore::removeGold(int gold) {
 	m_data.gold -= std::min(m_data.gold, gold);
+	g_gameplayEventBus->publish(GameplayEventType::GoldChanged, m_data.gold);
 }
 
 bool CharacterCore::notifyItemChange(const std::string& itemID, int amount) {
@@ -654,8 +656,7 @@ void CharacterCore::addItem(const std::string& item, int quantity) {
 		m_data.items.insert({ item, quantity });
 	}
 
-	g_achievementManager->notifyAchievementCore(ACH_ALL_KEYS);
-	g_achievementManager->notifyAchievementCore(ACH_MASOCHIST);
+	g_gameplayEventBus->publish(GameplayEventType::ItemAdded, item, quantity);
 }
 
 bool CharacterCore::removeItem(const std::string& item, int quantity) {
@@ -931,6 +932,7 @@ void CharacterCore::setBookRead(const std::string& itemId) {
 
 void CharacterCore::increaseDeathCount(const std::string& level) {
 	m_data.deaths++;
+	g_gameplayEventBus->publish(GameplayEventType::Death, level);
 
 	if (!contains(m_data.levelDeaths, level)) return;
 	m_data.levelDeaths.at(level)++;
@@ -6,14 +6,9 @@ InputController* g_inputController;
 const sf::Time InputController::MOUSE_TIMEOUT = sf::seconds(2.f);
 
 InputController::InputController() {
-	init();
 }
 
 InputController::~InputController() {
-	m_keyboardKeyActiveMap.clear();
-	m_keyboardKeyJustPressedMap.clear();
-	m_gamepadKeyActiveMap.clear();
-	m_gamepadKeyJustPressedMap.clear();
 }
 
 void InputController::update(const sf::Time& frameTime) {
@@ -22,17 +17,20 @@ void InputController::update(const sf::Time& frameTime) {
 	KeyboardController::update(frameTime);
 	GamepadController::update(frameTime);
 
-	// update keys
-	for (auto& it : m_keyboardKeyActiveMap) {
-		m_gamepadKeyJustPressedMap[it.first] = !m_gamepadKeyActiveMap[it.first] && isGamepadButtonPressed(it.first);
-		m_gamepadKeyActiveMap[it.first] = isGamepadButtonPressed(it.first);
-		m_keyboardKeyJustPressedMap[it.first] = !m_keyboardKeyActiveMap[it.first] && isKeyboardKeyPressed(it.first);
-		m_keyboardKeyActiveMap[it.first] = isKeyboardKeyPressed(it.first);
-	}
-
 	updateMouseVisibility(frameTime);
 }
 
+void InputController::updateKeys() {
+	updateKeyboardState();
+
+	const bool isGamepad = isGamepadConnected();
+	for (int i = static_cast<int>(Key::VOID) + 1; i < static_cast<int>(Key::MAX); ++i) {
+		Key key = static_cast<Key>(i);
+		m_keyboardSnapshot.update(key, isKeyboardKeyPressed(key));
+		m_gamepadSnapshot.update(key, isGamepad && isGamepadButtonPressed(key));
+	}
+}
+
 void InputController::updateMouseVisibility(const sf::Time& frameTime) {
 	if (!isGamepadConnected()) {
 		if (!m_cursor.isVisible()) {
@@ -61,16 +59,6 @@ void InputController::updateMouseVisibility(const sf::Time& frameTime) {
 	}
 }
 
-void InputController::init() {
-	for (int i = static_cast<int>(Key::VOID) + 1; i < static_cast<int>(Key::MAX); ++i) {
-		m_keyboardKeyActiveMap.insert({ static_cast<Key>(i), false });
-	}
-
-	m_keyboardKeyJustPressedMap = m_keyboardKeyActiveMap;
-	m_gamepadKeyActiveMap = m_keyboardKeyActiveMap;
-	m_gamepadKeyJustPressedMap = m_keyboardKeyActiveMap;
-}
-
 bool InputController::isKeyActive(Key key) const {
 	return m_isWindowFocused && checkKeyActive(key);
 }
@@ -82,15 +70,15 @@ bool InputController::isKeyJustPressed(Key key) const {
 
 bool InputController::isJoystickButtonJustPressed(Key key) const {
 	if (m_isActionLocked || !m_isWindowFocused) return false;
-	return m_gamepadKeyJustPressedMap.at(key);
+	return m_gamepadSnapshot.isJustPressed(key);
 }
 
 bool InputController::checkKeyActive(Key key) const {
-	return m_keyboardKeyActiveMap.at(key) || m_gamepadKeyActiveMap.at(key);
+	return m_keyboardSnapshot.isActive(key) || m_gamepadSnapshot.isActive(key);
 }
 
 bool InputController::checkKeyJustPressed(Key key) const {
-	return m_keyboardKeyJustPressedMap.at(key) || m_gamepadKeyJustPressedMap.at(key);
+	return m_keyboardSnapshot.isJustPressed(key) || m_gamepadSnapshot.isJustPressed(key);
 }
 
 bool InputController::isSelected() const {
@@ -0,0 +1,30 @@
+#include "Controller/InputSnapshot.h"
+
+const std::size_t InputSnapshot::KEY_COUNT;
+
+InputSnapshot::InputSnapshot() {
+	clear();
+}
+
+void InputSnapshot::update(Key key, bool isPressed) {
+	std::size_t index = static_cast<std::size_t>(key);
+	if (index >= KEY_COUNT) return;
+
+	m_justPressed[index] = isPressed && !m_active[index];
+	m_active[index] = isPressed;
+}
+
+void InputSnapshot::clear() {
+	m_active.fill(false);
+	m_justPressed.fill(false);
+}
+
+bool InputSnapshot::isActive(Key key) const {
+	std::size_t index = static_cast<std::size_t>(key);
+	return index < KEY_COUNT && m_active[index];
+}
+
+bool InputSnapshot::isJustPressed(Key key) const {
+	std::size_t index = static_cast<std::size_t>(key);
+	return index < KEY_COUNT && m_justPressed[index];
+}
\ No newline at end of file
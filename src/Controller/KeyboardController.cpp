@@ -10,6 +10,10 @@ void KeyboardController::update(const sf::Time& frameTime) {
 	m_lastPressedKey = sf::Keyboard::Unknown;
 }
 
+void KeyboardController::updateKeyboardState() {
+	m_keyboardState.snapshot();
+}
+
 sf::Keyboard::Key KeyboardController::getLastPressedKey() const {
 	return m_lastPressedKey;
 }
@@ -49,6 +53,10 @@ void KeyboardController::setLastPressedKey(sf::Keyboard::Key key) {
 	m_lastPressedKey = key;
 }
 
+void KeyboardController::handleKeyboardEvent(const sf::Event& e) {
+	m_keyboardState.handleEvent(e);
+}
+
 bool KeyboardController::isKeyboardKeyPressed(Key key) const {
 	auto const it = m_mainKeyMap->find(key);
 	auto const it2 = m_alternativeKeyMap->find(key);
@@ -60,10 +68,6 @@ bool KeyboardController::isKeyboardKeyPressed(Key key) const {
 }
 
 bool KeyboardController::isKeyboardKeyPressed(sf::Keyboard::Key key) const {
-	if (key >= sf::Keyboard::KeyCount || key <= sf::Keyboard::Unknown) {
-		return false;
-	}
-
-	return sf::Keyboard::isKeyPressed(key);
+	return m_keyboardState.isPressed(key);
 }
 
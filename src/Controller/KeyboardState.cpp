@@ -0,0 +1,39 @@
+#include "Controller/KeyboardState.h"
+
+inline bool isValidKey(sf::Keyboard::Key key) {
+	return key > sf::Keyboard::Unknown && key < sf::Keyboard::KeyCount;
+}
+
+void KeyboardState::handleEvent(const sf::Event& e) {
+	switch (e.type) {
+	case sf::Event::KeyPressed:
+		if (!isValidKey(e.key.code)) return;
+		m_pressed.set(e.key.code);
+		m_pressedSinceSnapshot.set(e.key.code);
+		break;
+	case sf::Event::KeyReleased:
+		if (!isValidKey(e.key.code)) return;
+		m_pressed.reset(e.key.code);
+		break;
+	case sf::Event::LostFocus:
+		clear();
+		break;
+	default:
+		break;
+	}
+}
+
+void KeyboardState::snapshot() {
+	m_snapshot = m_pressed | m_pressedSinceSnapshot;
+	m_pressedSinceSnapshot.reset();
+}
+
+void KeyboardState::clear() {
+	m_pressed.reset();
+	m_pressedSinceSnapshot.reset();
+	m_snapshot.reset();
+}
+
+bool KeyboardState::isPressed(sf::Keyboard::Key key) const {
+	return isValidKey(key) && m_snapshot.test(key);
+}
\ No newline at end of file
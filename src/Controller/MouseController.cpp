@@ -92,6 +92,10 @@ bool MouseController::isMouseClickedRight() const {
 	return m_isMouseClickedRight;
 }
 
+bool MouseController::isMouseInsideView() const {
+	return m_isMouseInsideView;
+}
+
 bool MouseController::isMouseWheelScrolledDown() const {
 	if (!m_isMouseInsideView || !m_isWindowFocused) return false;
 	return m_mouseWheelScrollTicks < 0.f;
@@ -16,23 +16,34 @@ Cutscene::Cutscene(std::string& id) {
 	m_cutsceneText.setTextStyle(TextStyle::Shadowed);
 	m_cutsceneText.setTextAlignment(TextAlignment::Center);
 
-	// load all textures now
+	// read all texts now, the images are decoded in the background while the cutscene plays
+	std::vector<std::vector<std::string>> stepImages;
 	for (auto& step : m_data.steps) {
+		std::vector<std::string> texts;
+		for (auto& text : step.texts) {
+			texts.push_back(text.text.empty() ? "" : g_textProvider->getCroppedText(text.text, "cutscene",
+				GUIConstants::CHARACTER_SIZE_L, WINDOW_WIDTH - 2 * static_cast<int>(TEXT_OFFSET.x)));
+		}
+		m_texts.push_back(texts);
+
+		std::vector<std::string> images;
 		for (auto& img : step.images) {
-			g_resourceManager->loadTexture(img.imagePath, ResourceType::Unique, this);
-			if (g_resourceManager->getTexture(img.imagePath) == nullptr) {
-				g_logger->logError("Cutscene", "Cutscene image not found at path: " + img.imagePath);
-				continue;
-			}
-			g_resourceManager->getTexture(img.imagePath)->setSmooth(true);
+			images.push_back(img.imagePath);
 		}
+		stepImages.push_back(images);
 	}
 
+	m_streamer = new CutsceneStreamer(stepImages);
+	m_streamer->waitForStep(0);
+
 	setNextStep();
 }
 
 Cutscene::~Cutscene() {
-	g_resourceManager->deleteUniqueResources(this);
+	delete m_streamer;
+	for (auto& it : m_textures) {
+		delete it.second;
+	}
 }
 
 void Cutscene::update(const sf::Time& frameTime) {
@@ -54,6 +65,8 @@ void Cutscene::update(const sf::Time& frameTime) {
 		}
 	}
 
+	prepareNextStep();
+
 	for (size_t i = 0; i < m_cutsceneImages.size(); ++i) {
 		sf::Vector2f oldPos = m_cutsceneImages.at(i).getPosition();
 		sf::Vector2f velocity = m_data.steps.at(m_currentStep).images.at(i).velocity;
@@ -94,13 +107,7 @@ void Cutscene::setNextText() {
 	CutsceneStep& step = m_data.steps.at(m_currentStep);
 	CutsceneText& text = step.texts.at(m_currentText);
 
-	if (text.text.empty()) {
-		m_cutsceneText.setString("");
-	}
-	else {
-		m_cutsceneText.setString(g_textProvider->getCroppedText(text.text, "cutscene",
-			GUIConstants::CHARACTER_SIZE_L, WINDOW_WIDTH - 2 * static_cast<int>(TEXT_OFFSET.x)));
-	}
+	m_cutsceneText.setString(m_texts.at(m_currentStep).at(m_currentText));
 
 	if (text.centered) {
 		m_cutsceneText.setCharacterSize(GUIConstants::CHARACTER_SIZE_XXL);
@@ -126,6 +133,8 @@ void Cutscene::setNextStep() {
 	}
 
 	m_currentStep++;
+	m_streamer->setCurrentStep(m_currentStep);
+	releaseTextures();
 
 	CutsceneStep& step = m_data.steps.at(m_currentStep);
 
@@ -137,7 +146,10 @@ void Cutscene::setNextStep() {
 
 	for (auto& cutsceneImage : step.images) {
 		sf::Sprite sprite;
-		sprite.setTexture(*g_resourceManager->getTexture(cutsceneImage.imagePath));
+		sf::Texture* texture = getTexture(cutsceneImage.imagePath);
+		if (texture != nullptr) {
+			sprite.setTexture(*texture);
+		}
 
 		if (cutsceneImage.velocity.x >= 0.f && cutsceneImage.velocity.y >= 0.f) {
 			sprite.setPosition(
@@ -163,6 +175,55 @@ void Cutscene::setNextStep() {
 	m_delayTimer = m_fadeTime > sf::Time::Zero ? sf::seconds(0.3f) : sf::Time::Zero;
 }
 
+sf::Texture* Cutscene::getTexture(const std::string& imagePath) {
+	auto it = m_textures.find(imagePath);
+	if (it != m_textures.end()) return it->second;
+
+	const sf::Image* image = m_streamer->waitForImage(imagePath);
+	if (image == nullptr) return nullptr;
+	return createTexture(imagePath, *image);
+}
+
+sf::Texture* Cutscene::createTexture(const std::string& imagePath, const sf::Image& image) {
+	sf::Texture* texture = new sf::Texture();
+	texture->loadFromImage(image);
+	texture->setSmooth(true);
+	m_textures.insert({ imagePath, texture });
+	return texture;
+}
+
+void Cutscene::prepareNextStep() {
+	if (m_currentStep + 1 >= static_cast<int>(m_data.steps.size())) return;
+
+	for (auto& cutsceneImage : m_data.steps.at(m_currentStep + 1).images) {
+		if (contains(m_textures, cutsceneImage.imagePath)) continue;
+
+		const sf::Image* image = m_streamer->getImage(cutsceneImage.imagePath);
+		if (image == nullptr) continue;
+
+		createTexture(cutsceneImage.imagePath, *image);
+		return;
+	}
+}
+
+void Cutscene::releaseTextures() {
+	std::set<std::string> shownImages;
+	for (int step = m_currentStep; step <= m_currentStep + 1 && step < static_cast<int>(m_data.steps.size()); ++step) {
+		for (auto& cutsceneImage : m_data.steps.at(step).images) {
+			shownImages.insert(cutsceneImage.imagePath);
+		}
+	}
+
+	for (auto it = m_textures.begin(); it != m_textures.end(); /* don't increment here */) {
+		if (contains(shownImages, it->first)) {
+			++it;
+			continue;
+		}
+		delete it->second;
+		it = m_textures.erase(it);
+	}
+}
+
 bool Cutscene::isLoaded() const {
 	return m_currentStep > -1;
 }
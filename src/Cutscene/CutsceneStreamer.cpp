@@ -0,0 +1,200 @@
+#include "Cutscene/CutsceneStreamer.h"
+#include "Logger.h"
+
+const int CutsceneStreamer::PREFETCH_STEPS = 2;
+const size_t CutsceneStreamer::DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+CutsceneStreamer::CutsceneStreamer(const std::vector<std::vector<std::string>>& stepImages, const ImageDecoder& decoder, size_t memoryBudget) {
+	m_stepImages = stepImages;
+	m_memoryBudget = memoryBudget;
+	m_decoder = decoder;
+	if (!m_decoder) {
+		m_decoder = [](const std::string& path, sf::Image& image) {
+			return image.loadFromFile(getResourcePath(path));
+		};
+	}
+
+	for (int step = 0; step < static_cast<int>(m_stepImages.size()); ++step) {
+		for (auto& path : m_stepImages[step]) {
+			std::vector<int>& steps = m_images[path].steps;
+			if (steps.empty() || steps.back() != step) {
+				steps.push_back(step);
+			}
+		}
+	}
+
+	m_thread = std::thread(&CutsceneStreamer::run, this);
+}
+
+CutsceneStreamer::~CutsceneStreamer() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isRunning = false;
+	}
+	m_condition.notify_all();
+	m_thread.join();
+
+	for (auto& it : m_images) {
+		delete it.second.image;
+	}
+}
+
+void CutsceneStreamer::run() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_isRunning) {
+		std::string path;
+		StreamedImage* image = takeImage(path);
+		if (image == nullptr) {
+			m_isPrefetching = false;
+			m_condition.notify_all();
+			m_condition.wait(lock);
+			continue;
+		}
+		decode(path, *image, lock);
+	}
+}
+
+CutsceneStreamer::StreamedImage* CutsceneStreamer::takeImage(std::string& path) {
+	int lastStep = std::min(m_currentStep + PREFETCH_STEPS, static_cast<int>(m_stepImages.size()) - 1);
+	for (int step = std::max(m_currentStep, 0); step <= lastStep; ++step) {
+		// images of later steps wait until there is memory left
+		if (step > m_currentStep && m_memoryUsage >= m_memoryBudget) return nullptr;
+
+		for (auto& stepPath : m_stepImages[step]) {
+			StreamedImage& image = m_images.at(stepPath);
+			if (image.state != ImageState::Waiting) continue;
+			path = stepPath;
+			return &image;
+		}
+	}
+	return nullptr;
+}
+
+void CutsceneStreamer::decode(const std::string& path, StreamedImage& image, std::unique_lock<std::mutex>& lock) {
+	image.state = ImageState::Decoding;
+	lock.unlock();
+
+	sf::Image* decoded = new sf::Image();
+	bool isDecoded = m_decoder(path, *decoded);
+
+	lock.lock();
+	if (!isDecoded) {
+		g_logger->logError("CutsceneStreamer", "Cutscene image not found at path: " + path);
+		delete decoded;
+		image.state = ImageState::Failed;
+	}
+	else if (!isNeeded(image)) {
+		// the cutscene moved on while decoding
+		delete decoded;
+		image.state = ImageState::Waiting;
+	}
+	else {
+		image.image = decoded;
+		image.state = ImageState::Decoded;
+		m_memoryUsage += getSize(*decoded);
+		m_maxMemoryUsage = std::max(m_maxMemoryUsage, m_memoryUsage);
+	}
+	m_condition.notify_all();
+}
+
+void CutsceneStreamer::setCurrentStep(int step) {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_currentStep = step;
+		m_isPrefetching = true;
+		for (auto& it : m_images) {
+			StreamedImage& image = it.second;
+			if (image.state != ImageState::Decoded || isNeeded(image)) continue;
+			m_memoryUsage -= getSize(*image.image);
+			delete image.image;
+			image.image = nullptr;
+			image.state = ImageState::Waiting;
+		}
+	}
+	m_condition.notify_all();
+}
+
+bool CutsceneStreamer::isNeeded(const StreamedImage& image) const {
+	for (int step : image.steps) {
+		if (step >= m_currentStep && step <= m_currentStep + PREFETCH_STEPS) return true;
+	}
+	return false;
+}
+
+const sf::Image* CutsceneStreamer::getImage(const std::string& path) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_images.find(path);
+	if (it == m_images.end() || it->second.state != ImageState::Decoded) return nullptr;
+	return it->second.image;
+}
+
+const sf::Image* CutsceneStreamer::waitForImage(const std::string& path) {
+	return acquireImage(path, true);
+}
+
+void CutsceneStreamer::waitForStep(int step) {
+	if (step < 0 || step >= static_cast<int>(m_stepImages.size())) return;
+	for (auto& path : m_stepImages[step]) {
+		acquireImage(path, false);
+	}
+}
+
+void CutsceneStreamer::waitForPrefetch() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_condition.wait(lock, [this] { return !m_isPrefetching; });
+}
+
+const sf::Image* CutsceneStreamer::acquireImage(const std::string& path, bool isCountingBlocks) {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	auto it = m_images.find(path);
+	if (it == m_images.end()) return nullptr;
+	StreamedImage& image = it->second;
+
+	if (isCountingBlocks && (image.state == ImageState::Waiting || image.state == ImageState::Decoding)) {
+		++m_blockCount;
+	}
+
+	while (true) {
+		switch (image.state) {
+		case ImageState::Decoded:
+			return image.image;
+		case ImageState::Failed:
+			return nullptr;
+		case ImageState::Waiting:
+			if (!isNeeded(image)) return nullptr;
+			decode(path, image, lock);
+			break;
+		case ImageState::Decoding:
+			m_condition.wait(lock);
+			break;
+		}
+	}
+}
+
+bool CutsceneStreamer::isStepDecoded(int step) const {
+	if (step < 0 || step >= static_cast<int>(m_stepImages.size())) return false;
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& path : m_stepImages[step]) {
+		if (m_images.at(path).state != ImageState::Decoded) return false;
+	}
+	return true;
+}
+
+int CutsceneStreamer::getBlockCount() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_blockCount;
+}
+
+size_t CutsceneStreamer::getMemoryUsage() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_memoryUsage;
+}
+
+size_t CutsceneStreamer::getMaxMemoryUsage() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_maxMemoryUsage;
+}
+
+size_t CutsceneStreamer::getSize(const sf::Image& image) {
+	return static_cast<size_t>(image.getSize().x) * image.getSize().y * 4;
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "FileIO/CharacterCoreWriter.h"
+#include "FileIO/SaveGameIndex.h"
 #include "Enums/EnumNames.h"
 #include "Misc/CBit.h"
 #include "Logger.h"
@@ -24,6 +25,7 @@ bool CharacterCoreWriter::saveToFile(const std::string& filename, const Characte
 	std::ofstream savefile(filename, std::ios::trunc);
 	if (savefile.is_open()) {
 		std::string toHash;
+		toHash.append(writeHeader(data));
 		toHash.append(writeTimePlayed(data));
 		toHash.append(writeSaveGameName(data));
 		toHash.append(writeDateSaved(data));
@@ -92,6 +94,15 @@ std::string CharacterCoreWriter::writeAndHash(const std::string& in, const Chara
 	return hash + in;
 }
 
+std::string CharacterCoreWriter::writeHeader(const CharacterCoreData& data) const {
+	SaveGameHeader header;
+	header.saveGameName = data.saveGameName;
+	header.location = data.isInLevel ? data.currentLevel : data.currentMap;
+	header.dateSaved = data.dateSaved;
+	header.timePlayed = sf::seconds(std::floor(data.timePlayed.asSeconds()));
+	return std::string(SAVE_GAME_HEADER) + ":" + SaveGameIndex::writeHeaderFields(header) + "\n";
+}
+
 std::string CharacterCoreWriter::writeTimePlayed(const CharacterCoreData& data) const {
 	std::string timePlayed = "# time played, in seconds\n";
 	return timePlayed.append(std::string(TIME_PLAYED) + ":" + std::to_string(static_cast<int>(std::floor(data.timePlayed.asSeconds()))) + "\n");
@@ -0,0 +1,54 @@
+#include "FileIO/ResourceFolder.h"
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include "dirent/dirent.h"
+#else
+#include <dirent.h>
+#endif
+
+std::vector<std::string> ResourceFolder::findFiles(const std::string& folder, const std::string& ending, const std::string& start) {
+	std::vector<std::string> paths;
+	for (auto& innerFolder : listEntries(folder, true)) {
+		const std::string innerDirPath = folder + "/" + innerFolder;
+		for (auto& name : listEntries(innerDirPath, false)) {
+			if (!startsWith(name, start) || !endsWith(name, ending)) continue;
+			paths.push_back(innerDirPath + "/" + name);
+		}
+	}
+
+	// the order of the directory entries depends on the file system
+	std::sort(paths.begin(), paths.end());
+	return paths;
+}
+
+std::vector<std::string> ResourceFolder::listFiles(const std::string& folder) {
+	std::vector<std::string> names = listEntries(folder, false);
+	std::sort(names.begin(), names.end());
+	return names;
+}
+
+std::vector<std::string> ResourceFolder::listEntries(const std::string& folder, bool isFolders) {
+	std::vector<std::string> names;
+	DIR* dir = opendir(folder.c_str());
+	while (dir) {
+		struct dirent* de = readdir(dir);
+		if (!de) break;
+		if ((de->d_type == DT_DIR) != isFolders) continue;
+		if (isFolders && de->d_name[0] == '.') continue;
+		names.push_back(std::string(de->d_name));
+	}
+	if (dir) closedir(dir);
+	return names;
+}
+
+bool ResourceFolder::startsWith(const std::string& value, const std::string& start) {
+	if (start.size() > value.size()) return false;
+	return std::equal(start.begin(), start.end(), value.begin());
+}
+
+bool ResourceFolder::endsWith(const std::string& value, const std::string& ending) {
+	if (ending.size() > value.size()) return false;
+	return std::equal(ending.rbegin(), ending.rend(), value.rbegin());
+}
\ No newline at end of file
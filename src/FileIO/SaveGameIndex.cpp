@@ -0,0 +1,264 @@
+#include "FileIO/SaveGameIndex.h"
+#include "FileIO/CharacterCoreReader.h"
+#include "FileIO/ResourceFolder.h"
+#include "Logger.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+const std::string SaveGameIndex::INDEX_FILENAME = "saves.index";
+const std::string SaveGameIndex::INDEX_VERSION = "# savegame.index.2";
+const int SaveGameIndex::HEADER_BLOCK_SIZE = 512;
+
+// reads a field up to the next comma and removes it from the fields
+inline bool readHeaderField(std::string& fields, std::string& value) {
+	size_t commaPos = fields.find(',');
+	if (commaPos == std::string::npos) return false;
+	value = fields.substr(0, commaPos);
+	fields.erase(0, commaPos + 1);
+	return true;
+}
+
+// reads a number up to the next comma and removes it from the fields
+inline bool readHeaderNumber(std::string& fields, long long& number) {
+	std::string value;
+	if (!readHeaderField(fields, value) || value.empty()) return false;
+	char* end;
+	number = std::strtoll(value.c_str(), &end, 10);
+	return *end == '\0';
+}
+
+SaveGameIndex::SaveGameIndex(const std::string& indexFilename) {
+	m_indexFilename = indexFilename;
+}
+
+void SaveGameIndex::findSaves(const std::string& folder, std::vector<std::string>& filenames) {
+	for (auto& name : ResourceFolder::listFiles(folder)) {
+		if (name == INDEX_FILENAME) continue;
+		if (!ResourceFolder::endsWith(name, ".sav")) {
+			// we only consider .sav files in this folder
+			g_logger->logWarning("SaveGameIndex", "There is a file of the wrong type in the savegame folder: " + name);
+			continue;
+		}
+		filenames.push_back(folder + name);
+	}
+}
+
+void SaveGameIndex::listSaves(const std::vector<std::string>& filenames, std::vector<SaveGameHeader>& headers) {
+	m_cachedCount = 0;
+	m_headerCount = 0;
+	m_parsedCount = 0;
+	m_bytesRead = 0;
+
+	loadIndex();
+	std::map<std::string, SaveGameHeader> index;
+	bool isChanged = false;
+
+	for (auto& filename : filenames) {
+		long long size;
+		long long modifiedTime;
+		if (!getFileState(filename, size, modifiedTime)) {
+			g_logger->logError("SaveGameIndex", "Could not access savegame " + filename);
+			continue;
+		}
+
+		std::string fileHash;
+		if (!readFileHash(filename, fileHash)) {
+			g_logger->logError("SaveGameIndex", "Could not read savegame " + filename);
+			continue;
+		}
+
+		SaveGameHeader header;
+		auto it = m_index.find(filename);
+		if (it != m_index.end() && it->second.fileSize == size && it->second.modifiedTime == modifiedTime &&
+			it->second.fileHash == fileHash) {
+			header = it->second;
+			++m_cachedCount;
+		}
+		else if (readHeader(filename, header)) {
+			++m_headerCount;
+			isChanged = true;
+		}
+		else if (parseSave(filename, header)) {
+			++m_parsedCount;
+			isChanged = true;
+		}
+		else {
+			g_logger->logError("SaveGameIndex", "Could not load savegame " + filename);
+			continue;
+		}
+
+		header.filename = filename;
+		header.fileSize = size;
+		header.modifiedTime = modifiedTime;
+		header.fileHash = fileHash;
+		index.insert({ filename, header });
+		headers.push_back(header);
+	}
+
+	// deleted saves are dropped from the index as well
+	if (isChanged || index.size() != m_index.size()) {
+		m_index.swap(index);
+		saveIndex();
+	}
+}
+
+bool SaveGameIndex::readHeader(const std::string& filename, SaveGameHeader& header) {
+	// read like the character core reader does, so the hash is computed over the same text
+	std::ifstream file(filename);
+	if (!file.is_open()) return false;
+
+	std::stringstream buffer;
+	buffer << file.rdbuf();
+	const std::string text = buffer.str();
+	m_bytesRead += static_cast<long long>(text.size());
+
+	const std::string tag = std::string(SAVE_GAME_HEADER) + ":";
+	std::stringstream lines(text.substr(0, HEADER_BLOCK_SIZE));
+	std::string line;
+	while (std::getline(lines, line)) {
+		// the last line may be cut off by the block end
+		if (lines.eof()) break;
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.compare(0, tag.size(), tag) != 0) continue;
+		if (!readHeaderFields(line.substr(tag.size()), header)) return false;
+		header.hashValid = isHashValid(text);
+		return true;
+	}
+	return false;
+}
+
+bool SaveGameIndex::readFileHash(const std::string& filename, std::string& fileHash) {
+	std::ifstream file(filename);
+	if (!file.is_open()) return false;
+
+	std::string block(HEADER_BLOCK_SIZE, '\0');
+	file.read(&block[0], HEADER_BLOCK_SIZE);
+	block.resize(static_cast<size_t>(file.gcount()));
+	m_bytesRead += static_cast<long long>(block.size());
+
+	fileHash = getHashLine(block);
+	return true;
+}
+
+bool SaveGameIndex::isHashValid(const std::string& text) const {
+	const std::string tag = std::string(HASH) + ":";
+	std::string hashLine = getHashLine(text);
+	if (hashLine.compare(0, tag.size(), tag) != 0) return false;
+
+	// the hash covers everything after the hash line
+	size_t bodyPos = text.find('\n', text.find('\n') + 1);
+	if (bodyPos == std::string::npos) return false;
+	return hashLine.substr(tag.size()) == hashFile(text.substr(bodyPos + 1));
+}
+
+std::string SaveGameIndex::getHashLine(const std::string& text) {
+	size_t startPos = text.find('\n');
+	if (startPos == std::string::npos) return "";
+	size_t endPos = text.find('\n', startPos + 1);
+	if (endPos == std::string::npos) return "";
+	std::string line = text.substr(startPos + 1, endPos - startPos - 1);
+	if (!line.empty() && line.back() == '\r') line.pop_back();
+	return line;
+}
+
+bool SaveGameIndex::parseSave(const std::string& filename, SaveGameHeader& header) {
+	CharacterCoreReader reader;
+	CharacterCoreData data;
+	if (!reader.readCharacterCore(filename, data, true)) return false;
+
+	long long size;
+	long long modifiedTime;
+	if (getFileState(filename, size, modifiedTime)) {
+		// the reader hashes the whole file
+		m_bytesRead += size;
+	}
+
+	header.saveGameName = data.saveGameName;
+	header.location = data.isInLevel ? data.currentLevel : data.currentMap;
+	header.dateSaved = data.dateSaved;
+	header.timePlayed = data.timePlayed;
+	header.hashValid = data.hashValid;
+	return true;
+}
+
+std::string SaveGameIndex::writeHeaderFields(const SaveGameHeader& header) {
+	// the name can contain commas and is therefore the last field
+	return std::to_string(static_cast<long long>(header.dateSaved)) + "," +
+		std::to_string(static_cast<int>(header.timePlayed.asSeconds())) + "," +
+		header.location + "," +
+		header.saveGameName;
+}
+
+bool SaveGameIndex::readHeaderFields(const std::string& fields, SaveGameHeader& header) {
+	std::string rest = fields;
+	long long dateSaved;
+	long long secondsPlayed;
+	if (!readHeaderNumber(rest, dateSaved) || !readHeaderNumber(rest, secondsPlayed)) {
+		return false;
+	}
+
+	size_t commaPos = rest.find(',');
+	if (commaPos == std::string::npos) return false;
+
+	header.dateSaved = static_cast<std::time_t>(dateSaved);
+	header.timePlayed = sf::seconds(static_cast<float>(secondsPlayed));
+	header.location = rest.substr(0, commaPos);
+	header.saveGameName = rest.substr(commaPos + 1);
+	return true;
+}
+
+void SaveGameIndex::loadIndex() {
+	m_index.clear();
+	std::ifstream file(m_indexFilename);
+	if (!file.is_open()) return;
+
+	std::string line;
+	if (!std::getline(file, line) || line != INDEX_VERSION) return;
+
+	// a line is "<filename>|<size>,<modified time>,<hash line>,<hash valid>,<header fields>", filenames of saves can't contain a '|'
+	while (std::getline(file, line)) {
+		if (line.empty() || line.at(0) == '#') continue;
+		size_t separatorPos = line.find('|');
+		if (separatorPos == std::string::npos) continue;
+
+		SaveGameHeader header;
+		header.filename = line.substr(0, separatorPos);
+		std::string fields = line.substr(separatorPos + 1);
+		long long hashValid;
+		if (!readHeaderNumber(fields, header.fileSize) || !readHeaderNumber(fields, header.modifiedTime) ||
+			!readHeaderField(fields, header.fileHash) || !readHeaderNumber(fields, hashValid) || !readHeaderFields(fields, header)) {
+			g_logger->logWarning("SaveGameIndex", "Ignoring a corrupt entry in the savegame index: " + header.filename);
+			continue;
+		}
+		header.hashValid = hashValid == 1;
+		m_index.insert({ header.filename, header });
+	}
+}
+
+void SaveGameIndex::saveIndex() const {
+	std::ofstream file(m_indexFilename, std::ios::trunc);
+	if (!file.is_open()) {
+		g_logger->logWarning("SaveGameIndex", "Could not write the savegame index: " + m_indexFilename);
+		return;
+	}
+
+	file << INDEX_VERSION << "\n";
+	file << "# the headers of the saves in this folder, rebuilt when a save changes\n";
+	for (auto& it : m_index) {
+		const SaveGameHeader& header = it.second;
+		file << header.filename << "|" << header.fileSize << "," << header.modifiedTime << "," << header.fileHash << "," <<
+			(header.hashValid ? "1" : "0") << "," << writeHeaderFields(header) << "\n";
+	}
+}
+
+bool SaveGameIndex::getFileState(const std::string& filename, long long& size, long long& modifiedTime) {
+	struct stat fileState;
+	if (stat(filename.c_str(), &fileState) != 0) return false;
+	size = static_cast<long long>(fileState.st_size);
+	modifiedTime = static_cast<long long>(fileState.st_mtime);
+	return true;
+}
\ No newline at end of file
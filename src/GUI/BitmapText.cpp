@@ -119,6 +119,16 @@ sf::FloatRect BitmapText::getBounds() const {
 	return getTransform().transformRect(m_bounds);
 }
 
+void BitmapText::appendVertices(sf::VertexArray& vertices, sf::Uint8 alpha) const {
+	const sf::Transform& transform = getTransform();
+	for (size_t i = 0; i < m_vertices.getVertexCount(); ++i) {
+		sf::Vertex vertex = m_vertices[i];
+		vertex.position = transform.transformPoint(vertex.position);
+		vertex.color.a = static_cast<sf::Uint8>(vertex.color.a * alpha / 255);
+		vertices.append(vertex);
+	}
+}
+
 void BitmapText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
 	states.transform *= getTransform();
 	states.texture = &m_font->getTexture();
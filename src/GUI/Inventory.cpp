@@ -1,6 +1,7 @@
 #include "GUI/Inventory.h"
 #include "GUI/GUIConstants.h"
 #include "GUI/SlotClone.h"
+#include "GUI/InventorySlotGrid.h"
 #include "GUI/ScrollBar.h"
 #include "GUI/ScrollHelper.h"
 #include "Level/LevelMainCharacter.h"
@@ -73,21 +74,21 @@ void Inventory::init() {
 
 	// fill the helper map
 	m_typeMap.insert({
-		{ ItemType::Consumable, &m_consumableItems },
-		{ ItemType::Permanent, &m_consumableItems },
-		{ ItemType::Misc, &m_miscItems },
-		{ ItemType::Convertible, &m_miscItems },
-		{ ItemType::Document, &m_documentItems },
-		{ ItemType::Spell, &m_documentItems },
-		{ ItemType::Quest, &m_questItems },
-		{ ItemType::Key, &m_keyItems },
-		{ ItemType::Equipment_back, &m_equipmentItems },
-		{ ItemType::Equipment_body, &m_equipmentItems },
-		{ ItemType::Equipment_head, &m_equipmentItems },
-		{ ItemType::Equipment_neck, &m_equipmentItems },
-		{ ItemType::Equipment_ring_1, &m_equipmentItems },
-		{ ItemType::Equipment_ring_2, &m_equipmentItems },
-		{ ItemType::Equipment_weapon, &m_equipmentItems },
+		{ ItemType::Consumable, ItemType::Consumable },
+		{ ItemType::Permanent, ItemType::Consumable },
+		{ ItemType::Misc, ItemType::Misc },
+		{ ItemType::Convertible, ItemType::Misc },
+		{ ItemType::Document, ItemType::Document },
+		{ ItemType::Spell, ItemType::Document },
+		{ ItemType::Quest, ItemType::Quest },
+		{ ItemType::Key, ItemType::Key },
+		{ ItemType::Equipment_back, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_body, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_head, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_neck, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_ring_1, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_ring_2, ItemType::Equipment_weapon },
+		{ ItemType::Equipment_weapon, ItemType::Equipment_weapon },
 		});
 
 	// tabbar
@@ -110,6 +111,7 @@ void Inventory::init() {
 
 	const sf::FloatRect scrollBox(INVENTORY_LEFT + SCROLL_WINDOW_LEFT, GUIConstants::TOP + SCROLL_WINDOW_TOP, SCROLL_WINDOW_WIDTH, SCROLL_WINDOW_HEIGHT);
 	m_scrollHelper = new ScrollHelper(scrollBox);
+	m_slotGrid = new InventorySlotGrid(SLOT_COUNT_X, SLOT_COUNT_Y, ICON_MARGIN, this);
 
 	// init empty text
 	m_emptyText.setCharacterSize(GUIConstants::CHARACTER_SIZE_M);
@@ -168,23 +170,11 @@ Inventory::~Inventory() {
 	delete m_tabBar;
 	delete m_scrollBar;
 	delete m_scrollHelper;
-	clearAllSlots();
+	delete m_slotGrid;
 }
 
 void Inventory::clearAllSlots() {
-	if (m_buttonGroup) {
-		m_buttonGroup->clearButtons(false);
-		delete m_buttonGroup;
-		m_buttonGroup = nullptr;
-	}
-
-	CLEAR_MAP(m_consumableItems);
-	CLEAR_MAP(m_equipmentItems);
-	CLEAR_MAP(m_questItems);
-	CLEAR_MAP(m_documentItems);
-	CLEAR_MAP(m_keyItems);
-	CLEAR_MAP(m_miscItems);
-
+	m_slotGrid->clear();
 	m_selectedSlotId.first = "";
 }
 
@@ -193,15 +183,14 @@ InventorySlot* Inventory::getSelectedSlot() const {
 	if (m_selectedSlotId.second != ItemType::VOID) {
 		return m_equipment->getSelectedSlot(m_selectedSlotId.second);
 	}
-	if (!contains(m_typeMap, m_currentTab)) return nullptr;
-	if (!contains(*m_typeMap.at(m_currentTab), m_selectedSlotId.first)) return nullptr;
-	return m_typeMap.at(m_currentTab)->at(m_selectedSlotId.first);
+	return m_slotGrid->getSlot(m_selectedSlotId.first);
 }
 
 void Inventory::deselectCurrentSlot() {
 	InventorySlot* slot = getSelectedSlot();
 	m_selectedSlotId.first = "";
 	m_selectedSlotId.second = ItemType::VOID;
+	m_slotGrid->setSelectedItemID("");
 	m_descriptionWindow->hide();
 	if (slot != nullptr) {
 		slot->deselect();
@@ -221,51 +210,31 @@ void Inventory::notifyChange(const std::string itemID) {
 		m_equipment->reload();
 	}
 
-	std::map<std::string, InventorySlot*>* tab = m_typeMap.at(item->getType());
+	// the other tabs are reloaded when they are selected
+	if (m_typeMap.at(item->getType()) != m_currentTab) return;
 
-	// search for the slot
-	if (contains(*tab, item->getID())) {
-		if (!contains(m_core->getData().items, itemID)) {
-			// the item was removed. check if it is selected.
-			if (m_selectedSlotId.first == item->getID()) {
-				deselectCurrentSlot();
-			}
-			tab->erase(item->getID());
-			reloadButtonGroup();
-		}
-		else {
-			tab->at(item->getID())->setAmount(m_core->getData().items.at(itemID));
+	if (!contains(m_core->getData().items, itemID)) {
+		// the item was removed. check if it is selected.
+		if (m_selectedSlotId.first == item->getID()) {
+			deselectCurrentSlot();
 		}
+		m_slotGrid->removeItem(itemID);
 		return;
 	}
 
-	// the slot for that item has not been found. The slot is added with the current amount in the core
-	if (!contains(m_core->getData().items, itemID)) return;
-	if (contains(*tab, itemID)) return;
-	(*tab).insert({ item->getID(), new InventorySlot(itemID, m_core->getData().items.at(itemID)) });
-	reloadButtonGroup();
+	m_slotGrid->setItem(itemID, m_core->getData().items.at(itemID));
 }
 
-void Inventory::reloadButtonGroup(bool keepSelectedButton) {
-	int previouslySelectedId = 0;
-	if (m_buttonGroup) {
-		previouslySelectedId = m_buttonGroup->getSelectedButtonId();
-		m_buttonGroup->clearButtons(false);
-		delete m_buttonGroup;
-	}
-
-	m_buttonGroup = new ButtonGroup(SLOT_COUNT_X);
-	m_buttonGroup->setSelectableWindow(this);
-	m_buttonGroup->setUpdateButtons(false);
-	m_buttonGroup->setGamepadEnabled(isWindowSelected());
-	
-	for (auto& it : *m_typeMap.at(m_currentTab)) {
-		m_buttonGroup->addButton(it.second);
+void Inventory::reloadItems() {
+	std::vector<SlotGridEntry> items;
+	for (auto& itemData : m_core->getData().items) {
+		Item* item = g_resourceManager->getItem(itemData.first);
+		if (item == nullptr || !contains(m_typeMap, item->getType())) continue;
+		if (m_typeMap.at(item->getType()) != m_currentTab) continue;
+		items.push_back({ item->getID(), itemData.second });
 	}
 
-	if (keepSelectedButton) {
-		m_buttonGroup->selectButton(previouslySelectedId);
-	}
+	m_slotGrid->setItems(items);
 }
 
 void Inventory::handleMapRightClick(const InventorySlot* clicked) {
@@ -458,7 +427,7 @@ void Inventory::updateButtonActions() {
 		return;
 	}
 
-	const auto selectedButton = dynamic_cast<InventorySlot*>(m_buttonGroup->getSelectedButton());
+	const auto selectedButton = dynamic_cast<InventorySlot*>(m_slotGrid->getButtonGroup()->getSelectedButton());
 	if (!selectedButton) return;
 
 	updateButtonActionMap(selectedButton);
@@ -466,11 +435,12 @@ void Inventory::updateButtonActions() {
 }
 
 void Inventory::updateWindowSelected() {
+	ButtonGroup* buttonGroup = m_slotGrid->getButtonGroup();
 	m_tabBar->setGamepadEnabled(isWindowSelected());
-	m_buttonGroup->setGamepadEnabled(isWindowSelected());
+	buttonGroup->setGamepadEnabled(isWindowSelected());
 
-	if (isWindowSelected() && m_buttonGroup->getSelectedButton()) {
-		m_buttonGroup->getSelectedButton()->setSelected(true);
+	if (isWindowSelected() && buttonGroup->getSelectedButton()) {
+		buttonGroup->getSelectedButton()->setSelected(true);
 	}
 }
 
@@ -505,16 +475,21 @@ bool Inventory::isSlotInvisible(const InventorySlot* slot) {
 void Inventory::update(const sf::Time& frameTime) {
 	if (!m_isVisible) return;
 
-	m_scrollBar->update(frameTime);
-	if (m_scrollBar->isTouchedThisFrame()) {
-		dynamic_cast<InventorySlot*>(m_buttonGroup->getSelectedButton())->setSelectedByButtonGroup(false);
+	ButtonGroup* buttonGroup = m_slotGrid->getButtonGroup();
+
+	// the dragged slot must not be rebound to another item
+	if (!m_isDragging) {
+		m_scrollBar->update(frameTime);
+	}
+	if (m_scrollBar->isTouchedThisFrame() && buttonGroup->getSelectedButton()) {
+		dynamic_cast<InventorySlot*>(buttonGroup->getSelectedButton())->setSelectedByButtonGroup(false);
 	}
 
-	m_buttonGroup->update(frameTime);
+	buttonGroup->update(frameTime);
 
-	// check whether an item was selected
-	for (int i = 0; i < static_cast<int>(m_buttonGroup->getButtons().size()); ++i) {
-		const auto slot = dynamic_cast<InventorySlot*>(m_buttonGroup->getButton(i));
+	// check whether an item was selected, only the live slots of the grid are updated
+	for (int i = 0; i < static_cast<int>(buttonGroup->getButtons().size()); ++i) {
+		const auto slot = dynamic_cast<InventorySlot*>(buttonGroup->getButton(i));
 
 		const auto considerSlot = 
 			(!isSlotInvisible(slot) && slot->isMousedOver()) || 
@@ -528,7 +503,7 @@ void Inventory::update(const sf::Time& frameTime) {
 
 		if (considerSlot && !m_hasDraggingStarted) {
 			selectSlot(slot->getItemID(), ItemType::VOID);
-			m_buttonGroup->notifyButtonSelected(i);
+			buttonGroup->notifyButtonSelected(i);
 
 			if (isSlotInvisible(slot)) {
 				if (slot->getPosition().y < GUIConstants::TOP + SCROLL_WINDOW_TOP) {
@@ -603,7 +578,7 @@ void Inventory::selectSlot(const std::string& selectedSlotId, ItemType type) {
 
 	auto selectedSlot = getSelectedSlot();
 
-	if (g_inputController->isMouseJustPressedLeftRaw() && selectedSlot->getBoundingBox()->contains(g_inputController->getDefaultViewMousePosition())) {
+	if (selectedSlot != nullptr && g_inputController->isMouseJustPressedLeftRaw() && selectedSlot->getBoundingBox()->contains(g_inputController->getDefaultViewMousePosition())) {
 		m_hasDraggingStarted = true;
 		m_isEquipmentSlotDragged = type != ItemType::VOID;
 		m_startMousePosition = g_inputController->getDefaultViewMousePosition();
@@ -613,17 +588,26 @@ void Inventory::selectSlot(const std::string& selectedSlotId, ItemType type) {
 		return;
 	}
 
-	auto currentlySelectedSlot = dynamic_cast<InventorySlot*>(m_buttonGroup->getSelectedButton());
+	auto currentlySelectedSlot = dynamic_cast<InventorySlot*>(m_slotGrid->getButtonGroup()->getSelectedButton());
 	if (currentlySelectedSlot && currentlySelectedSlot->getItemID() == selectedSlotId) {
 		m_selectedSlotId.first = selectedSlotId;
 		m_selectedSlotId.second = type;
-		showDescription(getSelectedSlot()->getItem(), getSelectedSlot()->isEquipmentOrigin());
+		if (type == ItemType::VOID) {
+			m_slotGrid->setSelectedItemID(selectedSlotId);
+		}
+		selectedSlot = getSelectedSlot();
+		if (selectedSlot != nullptr) {
+			showDescription(selectedSlot->getItem(), selectedSlot->isEquipmentOrigin());
+		}
 		return;
 	}
 	    
 	deselectCurrentSlot();
 	m_selectedSlotId.first = selectedSlotId;
 	m_selectedSlotId.second = type;
+	if (type == ItemType::VOID) {
+		m_slotGrid->setSelectedItemID(selectedSlotId);
+	}
 	selectedSlot = getSelectedSlot();
 	if (selectedSlot != nullptr) {
 		selectedSlot->select();
@@ -757,7 +741,7 @@ void Inventory::render(sf::RenderTarget& target) {
 	target.draw(m_goldSprite);
 	target.draw(m_selectedTabText);
 
-	m_buttonGroup->render(m_scrollHelper->texture);
+	m_slotGrid->render(m_scrollHelper->texture);
 	m_scrollHelper->render(target);
 
 	m_tabBar->render(target);
@@ -772,16 +756,14 @@ void Inventory::render(sf::RenderTarget& target) {
 	target.draw(m_scrollWindow);
 	m_scrollBar->render(target);
 
-	if (m_typeMap[m_currentTab]->empty()) {
+	if (m_slotGrid->getItemCount() == 0) {
 		target.draw(m_emptyText);
 	}
 }
 
 void Inventory::renderAfterForeground(sf::RenderTarget& target) {
 	if (!m_isVisible) return;
-	for (auto& it : *(m_typeMap.at(m_currentTab))) {
-		it.second->renderAfterForeground(target);
-	}
+	m_slotGrid->renderAfterForeground(target);
 	m_equipment->renderAfterForeground(target);
 
 	m_tabBar->renderAfterForeground(target);
@@ -900,11 +882,7 @@ void Inventory::selectTab(ItemType type) {
 		m_mapInterface->showQuickslotBar(type == ItemType::Consumable);
 	}
 
-	for (auto slot : *m_typeMap.at(m_currentTab)) {
-		slot.second->hideTooltip();
-	}
-
-	reloadButtonGroup(false);
+	reloadItems();
 }
 
 void Inventory::reloadGold() {
@@ -929,22 +907,14 @@ void Inventory::reload() {
 	// reload items
 	clearAllSlots();
 	hideDescription();
-	for (auto& itemData : m_core->getData().items) {
-		Item* item = g_resourceManager->getItem(itemData.first);
-		if (item == nullptr || !contains(m_typeMap, item->getType())) continue;
-		if (contains(*m_typeMap.at(item->getType()), item->getID())) continue;
-		m_typeMap.at(item->getType())->insert({ item->getID(), new InventorySlot(item->getID(), itemData.second) });
-	}
+	reloadItems();
 
 	// reload equipment
 	m_equipment->reload();
-	reloadButtonGroup();
 }
 
 void Inventory::calculateSlotPositions() const {
-	auto const& buttons = m_buttonGroup->getButtons();
-	float number = static_cast<float>(buttons.size());
-	int rows = static_cast<int>(std::ceil(number / SLOT_COUNT_X));
+	int rows = m_slotGrid->getRowCount();
 	int steps = rows - SLOT_COUNT_Y + 1;
 
 	m_scrollBar->setDiscreteSteps(steps);
@@ -965,25 +935,10 @@ void Inventory::calculateSlotPositions() const {
 	float change = m_scrollHelper->nextOffset - m_scrollHelper->lastOffset;
 	float effectiveScrollOffset = easeInOutQuad(time, start, change, animationTime);
 
-	float xOffsetStart = m_position.x + SCROLL_WINDOW_LEFT + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN;
-
-	float yOffset = m_position.y + SCROLL_WINDOW_TOP + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN - effectiveScrollOffset;
-	float xOffset = xOffsetStart;
-	int y = 1;
-	int x = 1;
-	for (auto button : buttons) {
-		button->setPosition(sf::Vector2f(xOffset, yOffset));
-		if (x + 1 > SLOT_COUNT_X) {
-			x = 1;
-			xOffset = xOffsetStart;
-			y++;
-			yOffset += ICON_MARGIN + InventorySlot::SIZE;
-		}
-		else {
-			x++;
-			xOffset += ICON_MARGIN + InventorySlot::SIZE;
-		}
-	}
+	sf::Vector2f origin(
+		m_position.x + SCROLL_WINDOW_LEFT + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN,
+		m_position.y + SCROLL_WINDOW_TOP + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN);
+	m_slotGrid->calculateSlotPositions(origin, effectiveScrollOffset);
 }
 
 void Inventory::show() {
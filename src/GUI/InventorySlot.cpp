@@ -11,29 +11,11 @@ const float InventorySlot::SIZE = 58.f;
 const float InventorySlot::ICON_OFFSET = 4.f;
 
 InventorySlot::InventorySlot(const std::string& itemID, int amount, bool isEquipmentOrigin) {
-	m_itemID = itemID;
 	m_isEquipmentOrigin = isEquipmentOrigin;
-
-	if (itemID == "gold") {
-		m_type = ItemType::Gold;
-
-		m_iconTextureRect = sf::IntRect(0, 0, static_cast<int>(ICON_SIZE), static_cast<int>(ICON_SIZE));
-
-	} else {
-		Item* item = g_resourceManager->getItem(itemID);
-		if (item == nullptr)
-			return;
-		m_type = item->getType();
-
-		m_iconTextureRect = sf::IntRect(item->getIconTextureLocation().x, item->getIconTextureLocation().y, static_cast<int>(ICON_SIZE), static_cast<int>(ICON_SIZE));
-	}
-
-	m_tooltipComponent->setTooltipText(g_textProvider->getText(itemID, "item"));
 	m_iconTexture = g_resourceManager->getTexture(GlobalResource::TEX_ITEMS);
 
 	m_amountText.setCharacterSize(GUIConstants::CHARACTER_SIZE_S);
 	m_amountText.setColor(COLOR_WHITE);
-	setAmount(amount);
 
 	m_borderTexture = g_resourceManager->getTexture(GlobalResource::TEX_GUI_SLOT_INVENTORY);
 	m_borderTextureSelected = g_resourceManager->getTexture(GlobalResource::TEX_GUI_SLOT_INVENTORY_SELECTED);
@@ -41,6 +23,7 @@ InventorySlot::InventorySlot(const std::string& itemID, int amount, bool isEquip
 	m_highlightTexture = g_resourceManager->getTexture(GlobalResource::TEX_GUI_SLOT_HIGHLIGHT);
 
 	initSlot();
+	setItem(itemID, amount);
 }
 
 InventorySlot::InventorySlot(const sf::Texture* tex, const sf::Vector2i& texPos, ItemType equipmentType) {
@@ -63,6 +46,28 @@ InventorySlot::InventorySlot(const sf::Texture* tex, const sf::Vector2i& texPos,
 	initSlot();
 }
 
+void InventorySlot::setItem(const std::string& itemID, int amount) {
+	m_itemID = itemID;
+
+	if (itemID == "gold") {
+		m_type = ItemType::Gold;
+
+		m_iconTextureRect = sf::IntRect(0, 0, static_cast<int>(ICON_SIZE), static_cast<int>(ICON_SIZE));
+
+	} else {
+		Item* item = g_resourceManager->getItem(itemID);
+		if (item == nullptr)
+			return;
+		m_type = item->getType();
+
+		m_iconTextureRect = sf::IntRect(item->getIconTextureLocation().x, item->getIconTextureLocation().y, static_cast<int>(ICON_SIZE), static_cast<int>(ICON_SIZE));
+	}
+
+	m_iconRect.setTextureRect(m_iconTextureRect);
+	m_tooltipComponent->setTooltipText(g_textProvider->getText(itemID, "item"));
+	setAmount(amount);
+}
+
 void InventorySlot::setPosition(const sf::Vector2f& pos) {
 	Slot::setPosition(pos);
 	m_amountText.setPosition(sf::Vector2f(
@@ -0,0 +1,252 @@
+#include "GUI/InventorySlotGrid.h"
+#include "GUI/ButtonGroup.h"
+#include "GUI/InventorySlot.h"
+#include "GUI/SelectableWindow.h"
+
+#include <algorithm>
+#include <cmath>
+
+const int InventorySlotGrid::MARGIN_ROWS = 1;
+
+InventorySlotGrid::InventorySlotGrid(int columns, int visibleRows, float margin, SelectableWindow* window) {
+	m_columns = columns;
+	m_visibleRows = visibleRows;
+	m_margin = margin;
+	m_window = window;
+
+	reloadButtonGroup(-1);
+}
+
+InventorySlotGrid::~InventorySlotGrid() {
+	m_buttonGroup->clearButtons(false);
+	delete m_buttonGroup;
+	CLEAR_VECTOR(m_slots);
+	delete m_pinnedSlot;
+}
+
+void InventorySlotGrid::setItems(std::vector<SlotGridEntry>& items) {
+	std::sort(items.begin(), items.end(), [](const SlotGridEntry& a, const SlotGridEntry& b) {
+		return a.itemID < b.itemID;
+	});
+	m_items.swap(items);
+	m_selectedItemID.clear();
+	releasePinnedSlot();
+
+	for (auto slot : m_slots) {
+		slot->hideTooltip();
+	}
+
+	// new items start with a new selection
+	m_boundCount = 0;
+	reloadButtonGroup(-1);
+	bind(0, true);
+}
+
+void InventorySlotGrid::setItem(const std::string& itemID, int amount) {
+	int index = findItem(itemID);
+	if (index < getItemCount() && m_items[index].itemID == itemID) {
+		m_items[index].amount = amount;
+	}
+	else {
+		m_items.insert(m_items.begin() + index, { itemID, amount });
+	}
+	bind(m_firstIndex, true);
+}
+
+void InventorySlotGrid::removeItem(const std::string& itemID) {
+	int index = findItem(itemID);
+	if (index == getItemCount() || m_items[index].itemID != itemID) return;
+	m_items.erase(m_items.begin() + index);
+	if (m_selectedItemID == itemID) {
+		m_selectedItemID.clear();
+		releasePinnedSlot();
+	}
+	bind(m_firstIndex, true);
+}
+
+void InventorySlotGrid::clear() {
+	std::vector<SlotGridEntry> items;
+	setItems(items);
+}
+
+int InventorySlotGrid::getItemCount() const {
+	return static_cast<int>(m_items.size());
+}
+
+int InventorySlotGrid::getRowCount() const {
+	return (getItemCount() + m_columns - 1) / m_columns;
+}
+
+int InventorySlotGrid::findItem(const std::string& itemID) const {
+	auto it = std::lower_bound(m_items.begin(), m_items.end(), itemID, [](const SlotGridEntry& entry, const std::string& id) {
+		return entry.itemID < id;
+	});
+	return static_cast<int>(it - m_items.begin());
+}
+
+void InventorySlotGrid::calculateSlotPositions(const sf::Vector2f& origin, float scrollOffset) {
+	const float step = m_margin + InventorySlot::SIZE;
+	bind((static_cast<int>(std::floor(scrollOffset / step)) - MARGIN_ROWS) * m_columns, false);
+
+	for (int i = 0; i < m_boundCount; ++i) {
+		m_slots[i]->setPosition(getSlotPosition(m_firstIndex + i, origin, scrollOffset));
+	}
+	// the pinned slot stays where its item is, outside of the visible rows
+	if (m_pinnedSlot != nullptr) {
+		m_pinnedSlot->setPosition(getSlotPosition(findItem(m_selectedItemID), origin, scrollOffset));
+	}
+}
+
+sf::Vector2f InventorySlotGrid::getSlotPosition(int index, const sf::Vector2f& origin, float scrollOffset) const {
+	const float step = m_margin + InventorySlot::SIZE;
+	const int row = index / m_columns;
+	const int column = index % m_columns;
+	return origin + sf::Vector2f(column * step, row * step - scrollOffset);
+}
+
+void InventorySlotGrid::bind(int firstIndex, bool isForced) {
+	const int capacity = (m_visibleRows + 2 * MARGIN_ROWS) * m_columns;
+	firstIndex = std::max(0, std::min(firstIndex, getRowCount() * m_columns - capacity));
+	const int count = std::max(0, std::min(capacity, getItemCount() - firstIndex));
+	if (!isForced && firstIndex == m_firstIndex && count == m_boundCount) return;
+
+	// the model index focused by the button group and whether the selected item was focused
+	int focusedIndex = -1;
+	if (m_buttonGroup->getSelectedButtonId() >= 0) {
+		focusedIndex = m_firstIndex + m_buttonGroup->getSelectedButtonId();
+	}
+	InventorySlot* selectedSlot = getSlot(m_selectedItemID);
+	const bool isSelectedByButtonGroup = selectedSlot != nullptr && selectedSlot->isSelectedByButtonGroup();
+
+	const bool isRearranged = pinSelectedSlot(firstIndex, count);
+	for (int i = 0; i < count; ++i) {
+		const SlotGridEntry& entry = m_items[firstIndex + i];
+		if (i == static_cast<int>(m_slots.size())) {
+			m_slots.push_back(new InventorySlot(entry.itemID, entry.amount));
+		}
+
+		InventorySlot* slot = m_slots[i];
+		if (slot->getItemID() != entry.itemID) {
+			slot->setItem(entry.itemID, entry.amount);
+			slot->hideTooltip();
+			slot->activate();
+		}
+		else {
+			slot->setAmount(entry.amount);
+		}
+
+		if (entry.itemID != m_selectedItemID) {
+			slot->deselect();
+			slot->setSelectedByButtonGroup(false);
+		}
+		else {
+			slot->select();
+			slot->setSelectedByButtonGroup(isSelectedByButtonGroup);
+		}
+	}
+
+	for (int i = count; i < static_cast<int>(m_slots.size()); ++i) {
+		m_slots[i]->hideTooltip();
+	}
+
+	const int lastFocusedIndex = focusedIndex < 0 ? -1 : std::max(0, std::min(count - 1, focusedIndex - firstIndex));
+	m_firstIndex = firstIndex;
+	if (count != m_boundCount || isRearranged) {
+		m_boundCount = count;
+		reloadButtonGroup(lastFocusedIndex);
+	}
+	else {
+		m_buttonGroup->notifyButtonSelected(lastFocusedIndex);
+	}
+}
+
+bool InventorySlotGrid::pinSelectedSlot(int firstIndex, int count) {
+	int selectedIndex = findItem(m_selectedItemID);
+	if (m_selectedItemID.empty() || selectedIndex == getItemCount() || m_items[selectedIndex].itemID != m_selectedItemID) {
+		return false;
+	}
+	const int slotIndex = selectedIndex - firstIndex;
+	const bool isBound = slotIndex >= 0 && slotIndex < count;
+
+	if (m_pinnedSlot == nullptr) {
+		if (isBound) return false;
+		for (int i = 0; i < m_boundCount; ++i) {
+			if (m_slots[i]->getItemID() != m_selectedItemID) continue;
+			m_pinnedSlot = m_slots[i];
+			m_slots.erase(m_slots.begin() + i);
+			return true;
+		}
+		return false;
+	}
+
+	if (!isBound) return false;
+	while (static_cast<int>(m_slots.size()) <= slotIndex) {
+		const SlotGridEntry& entry = m_items[firstIndex + m_slots.size()];
+		m_slots.push_back(new InventorySlot(entry.itemID, entry.amount));
+	}
+	// the slot that held this place is rebound with the other spare slots
+	std::swap(m_slots[slotIndex], m_pinnedSlot);
+	releasePinnedSlot();
+	return true;
+}
+
+void InventorySlotGrid::releasePinnedSlot() {
+	if (m_pinnedSlot == nullptr) return;
+	m_pinnedSlot->hideTooltip();
+	m_slots.push_back(m_pinnedSlot);
+	m_pinnedSlot = nullptr;
+}
+
+void InventorySlotGrid::reloadButtonGroup(int selectedIndex) {
+	if (m_buttonGroup) {
+		m_buttonGroup->clearButtons(false);
+		delete m_buttonGroup;
+	}
+
+	m_buttonGroup = new ButtonGroup(m_columns);
+	m_buttonGroup->setSelectableWindow(m_window);
+	m_buttonGroup->setUpdateButtons(false);
+	m_buttonGroup->setGamepadEnabled(m_window->isWindowSelected());
+
+	for (int i = 0; i < m_boundCount; ++i) {
+		m_buttonGroup->addButton(m_slots[i]);
+	}
+
+	m_buttonGroup->selectButton(selectedIndex);
+}
+
+InventorySlot* InventorySlotGrid::getSlot(const std::string& itemID) const {
+	if (itemID.empty()) return nullptr;
+	for (int i = 0; i < m_boundCount; ++i) {
+		if (m_slots[i]->getItemID() == itemID) {
+			return m_slots[i];
+		}
+	}
+	if (m_pinnedSlot != nullptr && m_pinnedSlot->getItemID() == itemID) {
+		return m_pinnedSlot;
+	}
+	return nullptr;
+}
+
+ButtonGroup* InventorySlotGrid::getButtonGroup() const {
+	return m_buttonGroup;
+}
+
+void InventorySlotGrid::setSelectedItemID(const std::string& itemID) {
+	if (itemID != m_selectedItemID) {
+		releasePinnedSlot();
+	}
+	m_selectedItemID = itemID;
+}
+
+void InventorySlotGrid::render(sf::RenderTarget& target) {
+	for (int i = 0; i < m_boundCount; ++i) {
+		m_slots[i]->render(target);
+	}
+}
+
+void InventorySlotGrid::renderAfterForeground(sf::RenderTarget& target) {
+	for (int i = 0; i < m_boundCount; ++i) {
+		m_slots[i]->renderAfterForeground(target);
+	}
+}
\ No newline at end of file
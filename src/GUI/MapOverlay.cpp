@@ -7,6 +7,7 @@
 #include "Map/DynamicTiles/WaypointTile.h"
 #include "Map/NPC.h"
 #include "Level/DynamicTiles/ChestLevelTile.h"
+#include "Level/LevelMinimaps.h"
 #include "World/MainCharacter.h"
 #include "World/Trigger.h"
 #include "GlobalResource.h"
@@ -18,13 +19,14 @@ const float MapOverlay::TOP = 30.f;
 const float MapOverlay::LEFT = GUIConstants::LEFT;
 const float MapOverlay::MAX_WIDTH = WINDOW_WIDTH - 2 * LEFT;
 const float MapOverlay::MAX_HEIGHT = WINDOW_HEIGHT - 2 * TOP;
+const int MapOverlay::MAX_DIRTY_RECTS = 16;
 
 MapOverlay::MapOverlay(WorldInterface* interface, GUITabBar* mapTabBar) {
 	m_interface = interface;
 	m_screen = interface->getScreen();
 	m_mapTabBar = mapTabBar;
 
-	m_levelOverlayIcons.loadFromFile(getResourcePath(GlobalResource::TEX_GUI_LEVELOVERLAY_ICONS));
+	m_levelOverlayIcons = sf::VertexArray(sf::Quads);
 
 	const World& map = *m_screen->getWorld();
 
@@ -71,7 +73,7 @@ void MapOverlay::update(const sf::Time& frameTime) {
 	}
 
 	if (m_isOnCurrentMap) {
-		updateFogOfWar(map);
+		updateFogOfWarDirtyRects(map);
 		m_mainCharMarker.setPosition(m_position +
 			m_screen->getMainCharacter()->getCenter() * map->scale - sf::Vector2f(12.5f, 12.5f));
 	}
@@ -143,6 +145,9 @@ void MapOverlay::setMapIndex(int index) {
 	map->map.setPosition(m_position);
 	map->fogOfWarTileMap.setPosition(m_position);
 	updateFogOfWar(map);
+	if (map->mapId == m_screen->getWorldData()->id) {
+		m_fogOfWarDirtyRects.clear();
+	}
 
 	auto worldName = g_textProvider->getText(World::getNameFromId(map->mapId), "location");
 	auto breakPos = worldName.find('\n');
@@ -166,7 +171,36 @@ void MapOverlay::updateFogOfWar(MapOverlayData* map) {
 	map->fogOfWarTileMap.updateFogOfWar(currentMap.second);
 }
 
-float MapOverlay::getScale(const sf::Vector2f& mapSize) const {
+void MapOverlay::updateFogOfWarDirtyRects(MapOverlayData* map) {
+	if (m_fogOfWarDirtyRects.empty()) return;
+	if (map->isLevel || !m_screen->getCharacterCore()->isMapExplored(map->mapId)) return;
+
+	auto const& currentMap = m_screen->getCharacterCore()->getExploredTiles().at(map->mapId);
+	for (auto& rect : m_fogOfWarDirtyRects) {
+		map->fogOfWarTileMap.updateFogOfWar(currentMap.second, rect);
+	}
+	m_fogOfWarDirtyRects.clear();
+}
+
+void MapOverlay::notifyFogOfWarRevealed(const sf::IntRect& dirtyRect) {
+	if (static_cast<int>(m_fogOfWarDirtyRects.size()) < MAX_DIRTY_RECTS) {
+		m_fogOfWarDirtyRects.push_back(dirtyRect);
+		return;
+	}
+
+	// too many rects, merge them into their bounds
+	sf::IntRect& bounds = m_fogOfWarDirtyRects[0];
+	for (auto& rect : m_fogOfWarDirtyRects) {
+		int left = std::min(bounds.left, std::min(rect.left, dirtyRect.left));
+		int top = std::min(bounds.top, std::min(rect.top, dirtyRect.top));
+		int right = std::max(bounds.left + bounds.width, std::max(rect.left + rect.width, dirtyRect.left + dirtyRect.width));
+		int bottom = std::max(bounds.top + bounds.height, std::max(rect.top + rect.height, dirtyRect.top + dirtyRect.height));
+		bounds = sf::IntRect(left, top, right - left, bottom - top);
+	}
+	m_fogOfWarDirtyRects.resize(1);
+}
+
+float MapOverlay::getScale(const sf::Vector2f& mapSize) {
 	return (mapSize.x / MAX_WIDTH > mapSize.y / MAX_HEIGHT) ?
 		MAX_WIDTH / mapSize.x :
 		MAX_HEIGHT / mapSize.y;
@@ -202,56 +236,57 @@ MapOverlayData* MapOverlay::createMapOverlayData(const std::string& id, const sf
 	return data;
 }
 
-void MapOverlay::renderLevelOverlay(float scale) {
-	auto lScreen = dynamic_cast<LevelScreen*>(m_screen);
-	auto lData = lScreen->getWorldData();
-
-	// background (white)
-	sf::Image img;
-	img.create(
-		static_cast<unsigned int>(std::round(lData->mapSize.x * TILE_SIZE_F * scale)),
-		static_cast<unsigned int>(std::round(lData->mapSize.y * TILE_SIZE_F * scale)), COLOR_BLACK);
-
-	float pixelSize = TILE_SIZE_F * scale;
-
-	// draw collidable layer on top of it (simple other imgs)
-	for (int i = 0; i < lData->mapSize.x; ++i) {
-		for (int j = 0; j < lData->mapSize.y; ++j) {
-			if (lData->collidableTilePositions[j][i]) continue;
-			sf::Image img2;
-			unsigned int sizeX = static_cast<unsigned int>(std::round((i + 1) * pixelSize)) - static_cast<unsigned int>(std::round(i * pixelSize));
-			unsigned int sizeY = static_cast<unsigned int>(std::round((j + 1) * pixelSize)) - static_cast<unsigned int>(std::round(j * pixelSize));
-			img2.create(sizeX, sizeY, COLOR_TWILIGHT_INACTIVE);
-			img.copy(img2, static_cast<unsigned int>(std::round(i * pixelSize)), static_cast<unsigned int>(std::round(j * pixelSize)));
+void MapOverlay::loadLevelMinimap(float scale) {
+	auto lData = dynamic_cast<LevelScreen*>(m_screen)->getWorldData();
+
+	// the walkable tiles are baked by the minimap baker, unless they have changed since
+	const LevelMinimap* minimap = g_resourceManager->getLevelMinimaps().getMinimap(*lData);
+	if (minimap != nullptr && minimap->size == LevelMinimaps::getImageSize(*lData, scale)) {
+		g_resourceManager->loadTexture(minimap->imagePath, ResourceType::Level);
+		const sf::Texture* texture = g_resourceManager->getTexture(minimap->imagePath);
+		if (texture != nullptr) {
+			m_levelOverlaySprite.setTexture(*texture, true);
+			return;
 		}
 	}
 
-	// draw the important tiles etc
+	std::vector<sf::Uint8> pixels;
+	sf::Vector2u size = LevelMinimaps::render(*lData, scale, pixels);
+	m_levelOverlayTexture.create(size.x, size.y);
+	m_levelOverlayTexture.update(pixels.data());
+	m_levelOverlaySprite.setTexture(m_levelOverlayTexture, true);
+}
+
+void MapOverlay::reloadLevelOverlayIcons(float scale) {
+	auto lScreen = dynamic_cast<LevelScreen*>(m_screen);
+	m_levelOverlayIcons.clear();
+
+	// the important tiles etc, they change with the game state and are drawn over the minimap
 	/////////////////////////////////
 
 	// dynamic tiles
 	for (auto go : *lScreen->getObjects(_DynamicTile)) {
 		if (auto dTile = dynamic_cast<LevelDynamicTile*>(go)) {
 			if (dTile->getDynamicTileID() == LevelDynamicTileID::Modifier && dTile->getGameObjectState() == GameObjectState::Active) {
-				drawOverlayTexture(img, dTile->getCenter() * scale, 0, 0);
+				addOverlayIcon(dTile->getCenter() * scale, 0, 0);
 			}
 			else if (dTile->getDynamicTileID() == LevelDynamicTileID::Door && dTile->isCollidable()) {
-				drawOverlayTexture(img, dTile->getCenter() * scale, 3, 0);
+				addOverlayIcon(dTile->getCenter() * scale, 3, 0);
 			}
 			else if (dTile->getDynamicTileID() == LevelDynamicTileID::Chest) {
 				auto chest = dynamic_cast<ChestLevelTile*>(dTile);
 				if (chest && chest->isLootable()) {
-					drawOverlayTexture(img, dTile->getCenter() * scale, 1, 1);
+					addOverlayIcon(dTile->getCenter() * scale, 1, 1);
 					if (chest->isQuestRelevant()) {
-						drawOverlayTexture(img, dTile->getCenter() * scale, 2, 0);
+						addOverlayIcon(dTile->getCenter() * scale, 2, 0);
 					}
 				}
 			}
 			else if (dTile->getDynamicTileID() == LevelDynamicTileID::Lever) {
-				drawOverlayTexture(img, dTile->getCenter() * scale, 3, 1);
+				addOverlayIcon(dTile->getCenter() * scale, 3, 1);
 			}
 			else if (dTile->getDynamicTileID() == LevelDynamicTileID::Checkpoint && dTile->getGameObjectState() == GameObjectState::Active) {
-				drawOverlayTexture(img, dTile->getCenter() * scale, 4, 0);
+				addOverlayIcon(dTile->getCenter() * scale, 4, 0);
 			}
 		}
 	}
@@ -260,7 +295,7 @@ void MapOverlay::renderLevelOverlay(float scale) {
 	for (auto go : *lScreen->getObjects(_Overlay)) {
 		if (Trigger* trigger = dynamic_cast<Trigger*>(go)) {
 			if (trigger->getData().isKeyGuarded) {
-				drawOverlayTexture(img, trigger->getCenter() * scale, 1, 0);
+				addOverlayIcon(trigger->getCenter() * scale, 1, 0);
 			}
 		}
 	}
@@ -270,10 +305,10 @@ void MapOverlay::renderLevelOverlay(float scale) {
 		if (LevelItem* item = dynamic_cast<LevelItem*>(go)) {
 			auto type = item->getItemType();
 			if (type == ItemType::Quest || type == ItemType::Key || type == ItemType::Spell || lScreen->isItemMonitored(item->getID())) {
-				drawOverlayTexture(img, item->getCenter() * scale, 2, 0);
+				addOverlayIcon(item->getCenter() * scale, 2, 0);
 			}
 			else {
-				drawOverlayTexture(img, item->getCenter() * scale, 2, 1);
+				addOverlayIcon(item->getCenter() * scale, 2, 1);
 			}
 		}
 	}
@@ -282,23 +317,20 @@ void MapOverlay::renderLevelOverlay(float scale) {
 	for (auto go : *lScreen->getObjects(_Enemy)) {
 		if (Enemy* enemy = dynamic_cast<Enemy*>(go)) {
 			if (enemy->isQuestRelevant()) {
-				drawOverlayTexture(img, enemy->getCenter() * scale, 2, 0);
+				addOverlayIcon(enemy->getCenter() * scale, 2, 0);
 			}
 		}
 	}
 
-	/////////////////////////////////////////////////////////////////////
-
-	// now convert to texture format
-	m_levelOverlayTexture.loadFromImage(img);
-
-	// and save as sprite
-	m_levelOverlaySprite.setTexture(m_levelOverlayTexture, true);
 }
 
-void MapOverlay::drawOverlayTexture(sf::Image& image, const sf::Vector2f& pos, int posX, int posY) {
-	image.copy(m_levelOverlayIcons, static_cast<unsigned int>(std::round(pos.x - 12.5)), static_cast<unsigned int>(std::round(pos.y - 12.5)),
-		sf::IntRect(posX * 25, posY * 25, 25, 25), true);
+void MapOverlay::addOverlayIcon(const sf::Vector2f& pos, int posX, int posY) {
+	sf::Vector2f topLeft(std::round(pos.x - 12.5f), std::round(pos.y - 12.5f));
+	sf::Vector2f texTopLeft(posX * 25.f, posY * 25.f);
+	m_levelOverlayIcons.append(sf::Vertex(topLeft, texTopLeft));
+	m_levelOverlayIcons.append(sf::Vertex(topLeft + sf::Vector2f(25.f, 0.f), texTopLeft + sf::Vector2f(25.f, 0.f)));
+	m_levelOverlayIcons.append(sf::Vertex(topLeft + sf::Vector2f(25.f, 25.f), texTopLeft + sf::Vector2f(25.f, 25.f)));
+	m_levelOverlayIcons.append(sf::Vertex(topLeft + sf::Vector2f(0.f, 25.f), texTopLeft + sf::Vector2f(0.f, 25.f)));
 }
 
 void MapOverlay::reloadButtonGroup() {
@@ -329,9 +361,7 @@ void MapOverlay::reloadLevelOverlay() {
 		return;
 	}
 
-	renderLevelOverlay(m_maps[0]->scale);
-	m_maps[0]->map = m_levelOverlaySprite;
-	m_maps[0]->map.setPosition(sf::Vector2f(m_boundingBox.left, m_boundingBox.top));
+	reloadLevelOverlayIcons(m_maps[0]->scale);
 	m_needsLevelOverlayReload = false;
 }
 
@@ -356,9 +386,10 @@ void MapOverlay::reloadMaps() {
 		sf::Vector2f mapSize = sf::Vector2f(
 			lScreen->getWorldData()->mapSize.x * TILE_SIZE_F,
 			lScreen->getWorldData()->mapSize.y * TILE_SIZE_F);
-		renderLevelOverlay(getScale(mapSize));
+		loadLevelMinimap(getScale(mapSize));
 		MapOverlayData* data = createMapOverlayData(lScreen->getWorldData()->id, lScreen->getWorldData()->mapSize,
 			m_levelOverlaySprite);
+		data->isLevel = true;
 
 		m_maps.push_back(data);
 
@@ -521,6 +552,11 @@ void MapOverlay::render(sf::RenderTarget& target) {
 	if (map == nullptr) return;
 
 	target.draw(map->map);
+	if (map->isLevel) {
+		sf::RenderStates states(g_resourceManager->getTexture(GlobalResource::TEX_GUI_LEVELOVERLAY_ICONS));
+		states.transform = map->map.getTransform();
+		target.draw(m_levelOverlayIcons, states);
+	}
 	target.draw(map->fogOfWarTileMap);
 
 	target.draw(m_title);
@@ -1,4 +1,5 @@
 #include "GUI/MerchantWindow.h"
+#include "GUI/InventorySlotGrid.h"
 #include "GUI/ScrollBar.h"
 #include "GUI/ScrollHelper.h"
 #include "Map/MerchantInterface.h"
@@ -56,6 +57,7 @@ void MerchantWindow::init() {
 
 	sf::FloatRect scrollBox(LEFT + SCROLL_WINDOW_LEFT, TOP + SCROLL_WINDOW_TOP, SCROLL_WINDOW_WIDTH, SCROLL_WINDOW_HEIGHT);
 	m_scrollHelper = new ScrollHelper(scrollBox);
+	m_slotGrid = new InventorySlotGrid(SLOT_COUNT_X, SLOT_COUNT_Y, ICON_MARGIN, this);
 
 	reload();
 }
@@ -65,18 +67,7 @@ MerchantWindow::~MerchantWindow() {
 	delete m_descriptionWindow;
 	delete m_scrollBar;
 	delete m_scrollHelper;
-	clearAllSlots();
-}
-
-void MerchantWindow::clearAllSlots() {
-	if (m_buttonGroup) {
-		m_buttonGroup->clearButtons(false);
-		delete m_buttonGroup;
-		m_buttonGroup = nullptr;
-	}
-
-	CLEAR_MAP(m_items);
-	m_selectedSlotId = "";
+	delete m_slotGrid;
 }
 
 void MerchantWindow::completeTrade() {
@@ -87,28 +78,17 @@ void MerchantWindow::notifyChange(const std::string& itemID) {
 	auto item = g_resourceManager->getItem(itemID);
 	if (!item) return;
 
-	// search for the slot
-	if (contains(m_items, itemID)) {
-		if (!contains(m_interface->getMerchantData().wares, itemID)) {
-			// the item was removed. check if it is selected.
-			if (m_selectedSlotId == itemID) {
-				deselectCurrentSlot();
-			}
-			m_items.erase(itemID);
-			calculateSlotPositions();
-		}
-		else {
-			m_items.at(itemID)->setAmount(m_interface->getMerchantData().wares.at(itemID));
+	if (!contains(m_interface->getMerchantData().wares, itemID)) {
+		// the item was removed. check if it is selected.
+		if (m_selectedSlotId == itemID) {
+			deselectCurrentSlot();
 		}
-		return;
+		m_slotGrid->removeItem(itemID);
+	}
+	else {
+		m_slotGrid->setItem(itemID, m_interface->getMerchantData().wares.at(itemID));
 	}
 
-	// the slot for that item has not been found. The slot is added with the current amount in the core
-	if (!contains(m_interface->getMerchantData().wares, itemID)) return;
-
-	m_items.insert({ itemID, new InventorySlot(itemID, m_interface->getMerchantData().wares.at(itemID)) });
-
-	reloadButtonGroup();
 	calculateSlotPositions();
 }
 
@@ -121,17 +101,18 @@ bool MerchantWindow::isSlotInvisible(const InventorySlot* slot) {
 void MerchantWindow::update(const sf::Time& frameTime) {
 	m_scrollBar->update(frameTime);
 
-	m_buttonGroup->update(frameTime);
+	ButtonGroup* buttonGroup = m_slotGrid->getButtonGroup();
+	buttonGroup->update(frameTime);
 
-	// check whether an item was selected
-	for (int i = 0; i < static_cast<int>(m_buttonGroup->getButtons().size()); ++i) {
-		const auto slot = dynamic_cast<InventorySlot*>(m_buttonGroup->getButton(i));
+	// check whether an item was selected, only the live slots of the grid are updated
+	for (int i = 0; i < static_cast<int>(buttonGroup->getButtons().size()); ++i) {
+		const auto slot = dynamic_cast<InventorySlot*>(buttonGroup->getButton(i));
 
 		if (isSlotInvisible(slot) && !slot->isSelected()) continue;
 		slot->update(frameTime);
 		if (slot->isMousedOver() || slot->isSelected()) {
 			selectSlot(slot->getItemID());
-			m_buttonGroup->selectButton(i);
+			buttonGroup->selectButton(i);
 		}
 	}
 
@@ -146,7 +127,7 @@ void MerchantWindow::update(const sf::Time& frameTime) {
 }
 
 void MerchantWindow::updateButtonActions() {
-	const auto slot = dynamic_cast<InventorySlot*>(m_buttonGroup->getSelectedButton());
+	const auto slot = dynamic_cast<InventorySlot*>(m_slotGrid->getButtonGroup()->getSelectedButton());
 	if (!slot) return;
 
 	if (isSlotInvisible(slot)) {
@@ -185,6 +166,7 @@ void MerchantWindow::selectSlot(const std::string& selectedSlotId) {
 
 	deselectCurrentSlot();
 	m_selectedSlotId = selectedSlotId;
+	m_slotGrid->setSelectedItemID(selectedSlotId);
 
 	InventorySlot* selectedSlot = getSelectedSlot();
 	
@@ -197,6 +179,7 @@ void MerchantWindow::selectSlot(const std::string& selectedSlotId) {
 void MerchantWindow::deselectCurrentSlot() {
 	InventorySlot* slot = getSelectedSlot();
 	m_selectedSlotId = "";
+	m_slotGrid->setSelectedItemID("");
 	m_descriptionWindow->hide();
 	if (slot != nullptr) {
 		slot->deselect();
@@ -204,18 +187,14 @@ void MerchantWindow::deselectCurrentSlot() {
 }
 
 InventorySlot* MerchantWindow::getSelectedSlot() {
-	if (m_selectedSlotId.empty()) return nullptr;
-	if (!contains(m_items, m_selectedSlotId)) return nullptr;
-	return m_items.at(m_selectedSlotId);
+	return m_slotGrid->getSlot(m_selectedSlotId);
 }
 
 void MerchantWindow::render(sf::RenderTarget& target) {
 	m_window->render(target);
 	target.draw(m_title);
 
-	for (auto& it : m_items) {
-		it.second->render(m_scrollHelper->texture);
-	}
+	m_slotGrid->render(m_scrollHelper->texture);
 	m_scrollHelper->render(target);
 
 	m_descriptionWindow->render(target);
@@ -225,9 +204,7 @@ void MerchantWindow::render(sf::RenderTarget& target) {
 }
 
 void MerchantWindow::renderAfterForeground(sf::RenderTarget& target) {
-	for (auto& it : m_items) {
-		it.second->renderAfterForeground(target);
-	}
+	m_slotGrid->renderAfterForeground(target);
 }
 
 void MerchantWindow::showDescription(const Item* item) {
@@ -253,55 +230,36 @@ void MerchantWindow::hideDescription() {
 }
 
 void MerchantWindow::updateWindowSelected() {
-	m_buttonGroup->setGamepadEnabled(isWindowSelected());
+	ButtonGroup* buttonGroup = m_slotGrid->getButtonGroup();
+	buttonGroup->setGamepadEnabled(isWindowSelected());
 
-	if (isWindowSelected()) {
-		m_buttonGroup->getSelectedButton()->setSelected(true);
+	if (isWindowSelected() && buttonGroup->getSelectedButton()) {
+		buttonGroup->getSelectedButton()->setSelected(true);
 	}
 }
 
-void MerchantWindow::reloadButtonGroup() {
-	int previouslySelectedId = 0;
-	if (m_buttonGroup) {
-		previouslySelectedId = m_buttonGroup->getSelectedButtonId();
-		m_buttonGroup->clearButtons(false);
-		delete m_buttonGroup;
-	}
-
-	m_buttonGroup = new ButtonGroup(SLOT_COUNT_X);
-	m_buttonGroup->setSelectableWindow(this);
-	m_buttonGroup->setUpdateButtons(false);
-	m_buttonGroup->setGamepadEnabled(isWindowSelected());
-
-	for (auto slot : m_items) {
-		m_buttonGroup->addButton(slot.second);
-	}
-
-	m_buttonGroup->selectButton(previouslySelectedId);
-}
-
 void MerchantWindow::reload() {
 	m_scrollBar->scroll(0);
 
 	// reload items
-	clearAllSlots();
-	
+	m_selectedSlotId = "";
 	hideDescription();
+
+	std::vector<SlotGridEntry> items;
 	for (auto& it : m_interface->getMerchantData().wares) {
 		if (!g_resourceManager->getItem(it.first)) {
 			g_logger->logError("MerchantWindow", "Item not resolved: " + it.first);
 			continue;
 		}
 		
-		m_items.insert({ it.first, new InventorySlot(it.first, it.second) });
+		items.push_back({ it.first, it.second });
 	}
 
-	reloadButtonGroup();
+	m_slotGrid->setItems(items);
 }
 
 void MerchantWindow::calculateSlotPositions() {
-	float number = static_cast<float>(m_items.size());
-	int rows = static_cast<int>(std::ceil(number / SLOT_COUNT_X));
+	int rows = m_slotGrid->getRowCount();
 	int steps = rows - SLOT_COUNT_Y + 1;
 
 	m_scrollBar->setDiscreteSteps(steps);
@@ -322,23 +280,8 @@ void MerchantWindow::calculateSlotPositions() {
 	float change = m_scrollHelper->nextOffset - m_scrollHelper->lastOffset;
 	float effectiveScrollOffset = easeInOutQuad(time, start, change, animationTime);
 
-	float xOffsetStart = LEFT + SCROLL_WINDOW_LEFT + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN;
-
-	float yOffset = TOP + SCROLL_WINDOW_TOP + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN - effectiveScrollOffset;
-	float xOffset = xOffsetStart;
-	int y = 1;
-	int x = 1;
-	for (auto& it : m_items) {
-		it.second->setPosition(sf::Vector2f(xOffset, yOffset));
-		if (x + 1 > SLOT_COUNT_X) {
-			x = 1;
-			xOffset = xOffsetStart;
-			y++;
-			yOffset += ICON_MARGIN + InventorySlot::SIZE;
-		}
-		else {
-			x++;
-			xOffset += ICON_MARGIN + InventorySlot::SIZE;
-		}
-	}
+	sf::Vector2f origin(
+		LEFT + SCROLL_WINDOW_LEFT + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN,
+		TOP + SCROLL_WINDOW_TOP + InventorySlot::ICON_OFFSET + 2 * WINDOW_MARGIN);
+	m_slotGrid->calculateSlotPositions(origin, effectiveScrollOffset);
 }
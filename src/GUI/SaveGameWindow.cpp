@@ -1,17 +1,10 @@
 #include "GUI/SaveGameWindow.h"
 #include "GUI/ScrollBar.h"
 #include "GUI/ScrollHelper.h"
-#include "FileIO/CharacterCoreReader.h"
 #include "GlobalResource.h"
 
 #include <sstream>
 
-#ifdef _WIN32
-#include "dirent/dirent.h"
-#else
-#include <dirent.h>
-#endif
-
 const std::string QUICKSAVE_NAME = "quicksave.sav";
 
 const int SaveGameWindow::ENTRY_COUNT = 20;
@@ -24,11 +17,6 @@ const float SaveGameWindow::HEIGHT = ENTRY_COUNT * GUIConstants::CHARACTER_SIZE_
 const float SaveGameWindow::TOP = 75.f;
 const float SaveGameWindow::LEFT = 0.5f * (WINDOW_WIDTH - WIDTH);
 
-inline bool ends_with(const std::string& value, const std::string& ending) {
-	if (ending.size() > value.size()) return false;
-	return std::equal(ending.rbegin(), ending.rend(), value.rbegin());
-}
-
 struct sort_date {
 	bool operator() (const ScrollEntry* save1, const ScrollEntry* save2) {
 		return *dynamic_cast<const SaveGameEntry*>(save1) > *dynamic_cast<const SaveGameEntry*>(save2);
@@ -82,31 +70,21 @@ void SaveGameWindow::loadSaves(std::vector<ScrollEntry*>& entries) {
 	}
 	entries.clear();
 
-	DIR * dir = opendir((getDocumentsPath(GlobalResource::SAVEGAME_FOLDER)).c_str());
-	int nr = 0;
-	while (dir) {
-		struct dirent * de = readdir(dir);
-		if (!de) break;
-		if (de->d_type == DT_DIR) {
-			// we don't consider directory folders
-			continue;
-		}
-		if (!ends_with(std::string(de->d_name), ".sav")) {
-			// we only consider .sav files in this folder
-			g_logger->logWarning("SaveGameWindow", "There is a file of the wrong type in the savegame folder: " + std::string(de->d_name));
-			continue;
-		}
+	// only the headers of changed saves are read
+	const std::string folder = getDocumentsPath(GlobalResource::SAVEGAME_FOLDER);
+	std::vector<std::string> filenames;
+	SaveGameIndex::findSaves(folder, filenames);
+
+	SaveGameIndex index(folder + SaveGameIndex::INDEX_FILENAME);
+	std::vector<SaveGameHeader> headers;
+	index.listSaves(filenames, headers);
+
+	for (auto& header : headers) {
 		auto entry = new SaveGameEntry();
-		const auto location = getDocumentsPath(GlobalResource::SAVEGAME_FOLDER) + std::string(de->d_name);
-		if (!entry->load(location)) {
-			g_logger->logError("SaveGameWindow", "Could not load savegame " + location);
-			continue;
-		}
+		entry->load(header);
 		entry->deselect();
-		nr++;
 		entries.push_back(entry);
 	}
-	closedir(dir);
 
 	std::sort(entries.begin(), entries.end(), sort_date());
 }
@@ -189,25 +167,18 @@ SaveGameEntry::SaveGameEntry() {
 	updateColor();
 }
 
-bool SaveGameEntry::load(const std::string& filename) {
-	CharacterCoreReader reader;
-	CharacterCoreData data;
-	if (!reader.readCharacterCore(filename, data, true)) {
-		g_logger->logError("SaveGameEntry", "Could not load data from file: " + std::string(filename));
-		return false;
-	}
-
-	m_filename = filename;
+void SaveGameEntry::load(const SaveGameHeader& header) {
+	m_filename = header.filename;
 
 	// format date saved
 	char buff[20];
-	strftime(buff, 20, "%Y-%m-%d %H:%M:%S", localtime(&data.dateSaved));
+	strftime(buff, 20, "%Y-%m-%d %H:%M:%S", localtime(&header.dateSaved));
 	m_dateSaved.setString(std::string(buff));
-	m_dateSavedNr = data.dateSaved;
-	m_name.setString(data.saveGameName);
+	m_dateSavedNr = header.dateSaved;
+	m_name.setString(header.saveGameName);
 
 	// format time played
-	auto secondsPlayed = static_cast<int>(data.timePlayed.asSeconds());
+	auto secondsPlayed = static_cast<int>(header.timePlayed.asSeconds());
 	const auto hoursPlayed = secondsPlayed / 3600;
 	const auto minutesPlayed = (secondsPlayed / 60) % 60;
 	secondsPlayed = (secondsPlayed % 60);
@@ -217,8 +188,7 @@ bool SaveGameEntry::load(const std::string& filename) {
 	const auto formattedTime = stringHours + stringMinutes + stringSeconds;
 	m_timePlayed.setString(formattedTime);
 
-	m_isHashValid = data.hashValid;
-	return true;
+	m_isHashValid = header.hashValid;
 }
 
 const std::string& SaveGameEntry::getFilename() const {
@@ -463,7 +463,7 @@ void WeaponWindow::notifySpellSlotActivation(SpellType type) {
 
 void WeaponWindow::highlightModifierSlots(SpellModifierType type, bool highlight) {
 	for (auto& it : m_weaponSlots) {
-		std::vector<SpellModifierType> allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
+		const std::vector<SpellModifierType>& allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
 		if (!highlight || contains(allowedMods, type)) {
 			for (auto& it2 : it.second) {
 				if (highlight) {
@@ -481,7 +481,7 @@ void WeaponWindow::notifyModifierSlotActivation(SpellModifierType type) {
 	for (auto& it : m_weaponSlots) {
 		it.first->deactivate();
 		it.first->deselect();
-		std::vector<SpellModifierType> allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
+		const std::vector<SpellModifierType>& allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
 		if (contains(allowedMods, type)) {
 			for (auto& it2 : it.second) {
 				it2->activate();
@@ -532,7 +532,7 @@ void WeaponWindow::notifyModifierDrop(SlotClone* clone, bool onSelected) {
 	}
 
 	for (auto& it : m_weaponSlots) {
-		std::vector<SpellModifierType> allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
+		const std::vector<SpellModifierType>& allowedMods = SpellData::getAllowedModifiers(it.first->getSpellID());
 		if (!contains(allowedMods, modifier.type)) continue;
 		for (auto modifierSlot : it.second) {
 			if (fastIntersect(*clone->getBoundingBox(), *modifierSlot->getBoundingBox()) || modifierSlot == selectedSlot) {
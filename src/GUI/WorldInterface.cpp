@@ -96,6 +96,10 @@ void WorldInterface::reloadLevelOverlay() {
 	m_mapOverlay->notifyLevelOverlayReload();
 }
 
+void WorldInterface::notifyFogOfWarRevealed(const sf::IntRect& dirtyRect) const {
+	m_mapOverlay->notifyFogOfWarRevealed(dirtyRect);
+}
+
 void WorldInterface::jumpToQuestMarker(const std::string& questId, const std::vector<QuestMarkerData>& data) {
 	showGuiElement(m_mapOverlay, GUIElement::Map);
 	m_guiSidebar->setWindowSelected(false);
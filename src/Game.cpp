@@ -71,6 +71,8 @@ void Game::run() {
 		// don't count this loop into the frametime!
 		sf::Time deltaTime = frameClock.restart();
 		pollEvents();
+		// the key snapshot has to see the events polled in this frame
+		g_inputController->updateKeys();
 
 		frameClock.restart();
 		if (deltaTime.asSeconds() > MAX_FRAME_TIME) {
@@ -130,6 +132,10 @@ void Game::pollEvents() {
 		}
 		else if (e.type == sf::Event::KeyPressed) {
 			g_inputController->setLastPressedKey(e.key.code);
+			g_inputController->handleKeyboardEvent(e);
+		}
+		else if (e.type == sf::Event::KeyReleased || e.type == sf::Event::LostFocus) {
+			g_inputController->handleKeyboardEvent(e);
 		}
 		else if (e.type == sf::Event::JoystickMoved) {
 			g_inputController->setLastPressedGamepadAxis(e.joystickMove);
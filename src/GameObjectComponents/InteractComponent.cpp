@@ -27,15 +27,31 @@ InteractComponent::InteractComponent(std::string tooltip, AnimatedGameObject* pa
 void InteractComponent::update(const sf::Time& frameTime) {
 	TooltipComponent::update(frameTime);
 
-	if (!m_isInteractable || m_animatedParent->isDisposed()) return;
-
-	if (getDistanceToMainChar() <= m_interactRange) {
-		m_mainChar->registerInteractiveObject(this);
+	// objects are registered when they are placed, the ones that never moved on their first update
+	if (m_interactionID == -1) {
+		updateInteraction();
 	}
 }
 
-float InteractComponent::getDistanceToMainChar() const {
-	return dist(m_mainChar->getCenter(), m_animatedParent->getCenter());
+void InteractComponent::updateInteraction() {
+	if (m_mainChar == nullptr || m_animatedParent->isDisposed()) return;
+	m_mainChar->updateInteractiveObject(this);
+}
+
+void InteractComponent::setInteractionID(int id) {
+	m_interactionID = id;
+}
+
+int InteractComponent::getInteractionID() const {
+	return m_interactionID;
+}
+
+sf::Vector2f InteractComponent::getInteractPosition() const {
+	return m_animatedParent->getCenter();
+}
+
+float InteractComponent::getInteractRange() const {
+	return m_interactRange;
 }
 
 bool InteractComponent::isInteractable() const {
@@ -68,11 +84,17 @@ void InteractComponent::setInteractTextColor(const sf::Color& color) {
 
 void InteractComponent::setInteractRange(float range) {
 	m_interactRange = range;
+	if (m_interactionID != -1) {
+		updateInteraction();
+	}
 }
 
 void InteractComponent::setInteractable(bool interactable) {
 	m_isInteractable = interactable;
 	m_useInteractiveColor = interactable;
+	if (m_interactionID != -1) {
+		updateInteraction();
+	}
 }
 
 void InteractComponent::setFocused(bool focused) {
@@ -85,6 +107,7 @@ void InteractComponent::onDisposed() {
 }
 
 void InteractComponent::setPosition(const sf::Vector2f& pos) {
+	updateInteraction();
 	if (!m_isFocused) {
 		TooltipComponent::setPosition(pos);
 	} else {
@@ -1,5 +1,6 @@
 #include "GameObjectComponents/ParticleComponent.h"
 #include "Screens/Screen.h"
+#include "World/RenderPass.h"
 
 ParticleComponent::ParticleComponent(const ParticleComponentData& data, GameObject* parent) : 
 	GameObjectComponent(parent), m_data(data) {
@@ -17,9 +18,8 @@ void ParticleComponent::update(const sf::Time& frameTime) {
 
 void ParticleComponent::render(sf::RenderTarget& renderTarget) {
 	if (!m_isVisible) return;
-	if (m_data.particleTexture) {
-		m_data.particleTexture->setView(renderTarget.getView());
-		m_ps->render(*m_data.particleTexture);
+	if (m_data.particlePass) {
+		m_ps->render(m_data.particlePass->getTarget(renderTarget.getView()));
 	}
 	else {
 		m_ps->render(renderTarget);
@@ -14,6 +14,8 @@ TooltipComponent::TooltipComponent(const std::string& tooltip, AnimatedGameObjec
 	m_tooltipText.setCharacterSize(GUIConstants::CHARACTER_SIZE_S);
 
 	m_tooltipHeight = 10.f;
+	// the tooltip shows on mouse over, so the parent has to be found by the mouse picker
+	parent->setMousePickable(true);
 }
 
 TooltipComponent::TooltipComponent(const std::string& tooltip, GameObject* parent) : GameObjectComponent(parent) {
@@ -26,6 +28,7 @@ TooltipComponent::TooltipComponent(const std::string& tooltip, GameObject* paren
 	m_tooltipText.setCharacterSize(GUIConstants::CHARACTER_SIZE_S);
 
 	m_tooltipHeight = 10.f;
+	parent->setMousePickable(true);
 }
 
 void TooltipComponent::update(const sf::Time& frameTime) {
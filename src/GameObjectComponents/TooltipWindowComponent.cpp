@@ -3,6 +3,7 @@
 
 TooltipWindowComponent::TooltipWindowComponent(const std::string& tooltip, GameObject* parent) : GameObjectComponent(parent) {	
 	m_tooltipWindow.setText(tooltip);
+	parent->setMousePickable(true);
 }
 
 void TooltipWindowComponent::update(const sf::Time& frameTime) {
@@ -0,0 +1,98 @@
+#include "GameplayEventBus.h"
+
+#include <algorithm>
+
+GameplayEventBus* g_gameplayEventBus;
+
+const std::string GameplayEventBus::EMPTY_ID = "";
+
+GameplayEventBus::GameplayEventBus() {
+	for (int i = 0; i < static_cast<int>(GameplayEventType::MAX); ++i) {
+		m_subscriberCount[i] = 0;
+	}
+}
+
+int GameplayEventBus::subscribe(GameplayEventType type, const GameplayEventCallback& callback) {
+	if (type <= GameplayEventType::VOID || type >= GameplayEventType::MAX || !callback) return -1;
+
+	Subscription subscription;
+	subscription.id = static_cast<int>(m_subscriptionTypes.size());
+	subscription.isRemoved = false;
+	subscription.callback = callback;
+	m_subscriptionTypes.push_back(type);
+	m_subscriberCount[static_cast<int>(type)]++;
+
+	if (m_dispatchDepth > 0) {
+		// the subscription table may be iterated right now
+		m_pendingSubscriptions.push_back({ type, subscription });
+		m_isDirty = true;
+	}
+	else {
+		m_subscriptions[static_cast<int>(type)].push_back(subscription);
+	}
+
+	return subscription.id;
+}
+
+void GameplayEventBus::unsubscribe(int subscription) {
+	if (subscription < 0 || subscription >= static_cast<int>(m_subscriptionTypes.size())) return;
+	GameplayEventType type = m_subscriptionTypes[subscription];
+	if (type == GameplayEventType::VOID) return;
+
+	m_subscriptionTypes[subscription] = GameplayEventType::VOID;
+	m_subscriberCount[static_cast<int>(type)]--;
+
+	// the callback may be running right now, so it is only marked and removed after the dispatch
+	for (auto& it : m_subscriptions[static_cast<int>(type)]) {
+		if (it.id == subscription) {
+			it.isRemoved = true;
+		}
+	}
+	for (auto& it : m_pendingSubscriptions) {
+		if (it.second.id == subscription) {
+			it.second.isRemoved = true;
+		}
+	}
+
+	m_isDirty = true;
+	if (m_dispatchDepth == 0) {
+		compact();
+	}
+}
+
+bool GameplayEventBus::hasSubscribers(GameplayEventType type) const {
+	if (type <= GameplayEventType::VOID || type >= GameplayEventType::MAX) return false;
+	return m_subscriberCount[static_cast<int>(type)] > 0;
+}
+
+void GameplayEventBus::dispatch(GameplayEventType type, int value, const std::string& id) {
+	GameplayEvent event;
+	event.type = type;
+	event.value = value;
+	event.id = id;
+
+	m_dispatchDepth++;
+	const std::vector<Subscription>& subscriptions = m_subscriptions[static_cast<int>(type)];
+	for (size_t i = 0; i < subscriptions.size(); ++i) {
+		if (subscriptions[i].isRemoved) continue;
+		subscriptions[i].callback(event);
+	}
+	m_dispatchDepth--;
+
+	if (m_dispatchDepth == 0 && m_isDirty) {
+		compact();
+	}
+}
+
+void GameplayEventBus::compact() {
+	for (auto& subscriptions : m_subscriptions) {
+		subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(),
+			[](const Subscription& s) { return s.isRemoved; }), subscriptions.end());
+	}
+	for (auto& it : m_pendingSubscriptions) {
+		if (it.second.isRemoved) continue;
+		m_subscriptions[static_cast<int>(it.first)].push_back(it.second);
+	}
+	m_pendingSubscriptions.clear();
+	m_isDirty = false;
+}
\ No newline at end of file
@@ -4,117 +4,180 @@
 #include "TextProvider.h"
 
 
-const int DamageNumbers::MAX_NUMBERS = 5;
+const int DamageNumbers::MAX_NUMBERS = 64;
+const int DamageNumbers::MAX_EMITS_PER_FRAME = 16;
+const float DamageNumbers::MERGE_TIME = 0.2f;
 const float DamageNumbers::START_OFFSET = -15.f;
 const float DamageNumbers::DISTANCE = -40.f;
 const float DamageNumbers::TIME = 0.8f;
 
-DamageNumbers::DamageNumbers(bool isAlly) {
-	m_isAlly = isAlly;
-	m_nextIndex = 0;
-	for (int i = 0; i < MAX_NUMBERS; ++i) {
-		DamageNumberData numberData;
-		numberData.active = false;
-		numberData.startPosition = 0.f;
-		numberData.text = new BitmapText("", TextStyle::Shadowed, TextAlignment::Center);
-		numberData.text->setCharacterSize(12);
-		m_data.push_back(numberData);
-	}
+DamageNumbers::DamageNumbers() {
+	m_data = std::vector<DamageNumberData>(MAX_NUMBERS);
 }
 
 DamageNumbers::~DamageNumbers() {
-	for (int i = 0; i < MAX_NUMBERS; ++i) {
-		delete m_data[i].text;
+	for (auto& data : m_data) {
+		delete data.text;
 	}
 }
 
 void DamageNumbers::update(const sf::Time& frameTime) {
-	offset = START_OFFSET;
-
-	for (int i = 0; i < MAX_NUMBERS; ++i) {
-		DamageNumberData& data = m_data[i];
-
-		if (data.active) {
-			data.time += frameTime.asSeconds();
-			if (data.time < 0.8f * TIME) {
-				sf::Vector2f pos = data.text->getPosition();
-				pos.y = easeInOutQuad(data.time, data.startPosition, DISTANCE, 0.8f * TIME);
-				data.text->setPosition(pos);
-			}
-			else if (data.time < TIME) {
-				sf::Color col = data.text->getColor();
-				col.a = static_cast<int>(linearTween(data.time - 0.8f * TIME, 255.f, -255.f, 0.2f * TIME));
-				data.text->setColor(col);
-			}
-			else {
-				data.active = false;
-			}
+	m_offsets.clear();
+	m_emitCount = 0;
+
+	for (auto& data : m_data) {
+		if (!data.active) continue;
+
+		data.time += frameTime.asSeconds();
+		if (data.time < 0.8f * TIME) {
+			data.position.y = easeInOutQuad(data.time, data.startPosition, DISTANCE, 0.8f * TIME);
+		}
+		else if (data.time < TIME) {
+			data.alpha = static_cast<sf::Uint8>(linearTween(data.time - 0.8f * TIME, 255.f, -255.f, 0.2f * TIME));
+		}
+		else {
+			data.active = false;
 		}
 	}
 }
 
 void DamageNumbers::render(sf::RenderTarget& target) {
-	for (int i = 0; i < MAX_NUMBERS; ++i) {
-		DamageNumberData& data = m_data[i];
-		if (data.active) {
-			target.draw(*data.text);
+	for (auto& batch : m_batches) {
+		batch.second.clear();
+	}
+
+	for (auto& data : m_data) {
+		if (!data.active) continue;
+
+		if (data.text == nullptr) {
+			data.text = new BitmapText("", TextStyle::Shadowed, TextAlignment::Center);
+			data.isTextDirty = true;
 		}
+		if (data.isTextDirty) {
+			data.text->setCharacterSize(data.characterSize);
+			data.text->setColor(data.color);
+			data.text->setString(data.str);
+			data.isTextDirty = false;
+		}
+
+		data.text->setPosition(data.position.x - 0.5f * data.text->getLocalBounds().width, data.position.y);
+		data.text->appendVertices(getBatch(&data.text->getFont()->getTexture()), data.alpha);
 	}
+
+	for (auto& batch : m_batches) {
+		if (batch.second.getVertexCount() == 0) continue;
+		target.draw(batch.second, sf::RenderStates(batch.first));
+	}
+}
+
+sf::VertexArray& DamageNumbers::getBatch(const sf::Texture* texture) {
+	// there is one batch per font, and the two character sizes use two fonts.
+	for (auto& batch : m_batches) {
+		if (batch.first == texture) return batch.second;
+	}
+	m_batches.push_back(std::make_pair(texture, sf::VertexArray(sf::Quads)));
+	return m_batches.back().second;
 }
 
-void DamageNumbers::emitNumber(int value, const sf::Vector2f& position, DamageNumberType type, bool critical) {
-	emitString(std::to_string(value), position, type);
+void DamageNumbers::emitNumber(const GameObject* target, int value, const sf::Vector2f& position, DamageNumberType type, bool isAlly, bool critical) {
+	if (!critical) {
+		DamageNumberData* merged = findMergeable(target, type);
+		if (merged != nullptr) {
+			merged->value += value;
+			merged->str = std::to_string(merged->value);
+			merged->isTextDirty = true;
+			return;
+		}
+	}
+
+	DamageNumberData* data = emit(target, std::to_string(value), position, type, isAlly);
+	if (data == nullptr) return;
+	data->isMergeable = !critical;
+	data->value = value;
+
 	if (critical) {
 		// Force "Critical!" text to be CHARACTER_SIZE_M
 		if (type == DamageNumberType::Damage) type = DamageNumberType::DamageOverTime;
 		if (type == DamageNumberType::Heal) type = DamageNumberType::HealOverTime;
 		std::string criticalText = g_textProvider->getText("Critical");
 		criticalText.push_back('!');
-		emitString(criticalText, position, type);
+		emitString(target, criticalText, position, type, isAlly);
 	}
 }
 
-void DamageNumbers::emitString(std::string str, const sf::Vector2f& position, DamageNumberType type) {
+void DamageNumbers::emitString(const GameObject* target, const std::string& str, const sf::Vector2f& position, DamageNumberType type, bool isAlly) {
+	emit(target, str, position, type, isAlly);
+}
+
+DamageNumberData* DamageNumbers::findMergeable(const GameObject* target, DamageNumberType type) {
+	for (auto& data : m_data) {
+		if (data.active && data.isMergeable && data.target == target && data.type == type && data.time < MERGE_TIME) {
+			return &data;
+		}
+	}
+	return nullptr;
+}
+
+DamageNumberData* DamageNumbers::emit(const GameObject* target, const std::string& str, const sf::Vector2f& position, DamageNumberType type, bool isAlly) {
+	if (m_emitCount >= MAX_EMITS_PER_FRAME) return nullptr;
+	m_emitCount++;
+
+	// the oldest number is overwritten if all of them are active
 	DamageNumberData& data = m_data[m_nextIndex];
+	m_nextIndex = (m_nextIndex + 1) % MAX_NUMBERS;
 
 	data.active = true;
+	data.target = target;
+	data.type = type;
+	data.isMergeable = false;
+	data.value = 0;
+	data.str = str;
 	data.time = 0.f;
-	data.text->setString(str);
+	data.alpha = 255;
+	data.isTextDirty = true;
 
-	int characterSize;
 	if (type == DamageNumberType::DamageOverTime || type == DamageNumberType::HealOverTime) {
-		characterSize = GUIConstants::CHARACTER_SIZE_M;
+		data.characterSize = GUIConstants::CHARACTER_SIZE_M;
 	}
 	else {
-		characterSize = GUIConstants::CHARACTER_SIZE_L;
+		data.characterSize = GUIConstants::CHARACTER_SIZE_L;
+	}
+
+	// numbers of the same target in one frame are stacked on top of each other
+	float* offset = nullptr;
+	for (auto& it : m_offsets) {
+		if (it.first == target) {
+			offset = &it.second;
+			break;
+		}
+	}
+	if (offset == nullptr) {
+		m_offsets.push_back(std::make_pair(target, START_OFFSET));
+		offset = &m_offsets.back().second;
 	}
-	data.text->setCharacterSize(characterSize);
-	offset -= 1.5f * characterSize;
+	*offset -= 1.5f * data.characterSize;
 
-	const sf::FloatRect& rect = data.text->getBounds();
-	sf::Vector2f startPosition = sf::Vector2f(position.x - 0.5f * rect.width, position.y + offset);
-	data.text->setPosition(startPosition);
-	data.startPosition = startPosition.y;
+	data.position = sf::Vector2f(position.x, position.y + *offset);
+	data.startPosition = data.position.y;
 
 	if (type == DamageNumberType::Damage || type == DamageNumberType::DamageOverTime) {
-		if (m_isAlly) {
-			data.text->setColor(COLOR_DAMAGE_ALLY);
-		}
-		else {
-			data.text->setColor(COLOR_DAMAGE_ENEMY);
-		}
+		data.color = isAlly ? COLOR_DAMAGE_ALLY : COLOR_DAMAGE_ENEMY;
 	}
 	else {
-		if (m_isAlly) {
-			data.text->setColor(COLOR_HEAL_ALLY);
-		}
-		else {
-			data.text->setColor(COLOR_HEAL_ENEMY);
-		}
+		data.color = isAlly ? COLOR_HEAL_ALLY : COLOR_HEAL_ENEMY;
 	}
 
-	m_nextIndex++;
-	if (m_nextIndex > MAX_NUMBERS - 1) {
-		m_nextIndex = 0;
+	return &data;
+}
+
+const std::vector<DamageNumberData>& DamageNumbers::getNumbers() const {
+	return m_data;
+}
+
+int DamageNumbers::getActiveCount() const {
+	int count = 0;
+	for (auto& data : m_data) {
+		if (data.active) count++;
 	}
+	return count;
 }
\ No newline at end of file
@@ -80,7 +80,7 @@ void AntiMagicTile::loadParticleSystem() {
 	data.emitRate = m_width * 2.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	m_lineSpawner = new particles::LineSpawner();
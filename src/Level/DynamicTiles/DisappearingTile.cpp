@@ -148,7 +148,7 @@ std::string DisappearingTile::getSpritePath() const {
 
 void DisappearingTile::loadComponents() {
 	ParticleComponentData data;
-	data.particleTexture = &(dynamic_cast<LevelScreen*>(getScreen())->getParticleFGRenderTexture());
+	data.particlePass = &(dynamic_cast<LevelScreen*>(getScreen())->getParticleFGPass());
 	data.particleCount = 50;
 	data.texturePath = getSpritePath();
 	data.emitRate = 10.f;
@@ -50,11 +50,10 @@ bool MovingTile::init(const LevelTileProperties& properties) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, size * TILE_SIZE_F, 40.f));
 	float phi = degToRad(static_cast<float>(direction - 90));
 
-	m_currentVelocity.x = std::round(speed * std::cos(phi));
-	m_currentVelocity.y = std::round(speed * std::sin(phi));
+	m_forwardVelocity.x = std::round(speed * std::cos(phi));
+	m_forwardVelocity.y = std::round(speed * std::sin(phi));
 
-	m_distanceTime = speed == 0 ? sf::Time::Zero : sf::seconds(static_cast<float>(distance) / static_cast<float>(speed));
-	m_timeUntilTurn = m_distanceTime;
+	m_motion.setDistanceTime(speed == 0 ? sf::Time::Zero : sf::seconds(static_cast<float>(distance) / static_cast<float>(speed)));
 
 	setFrozen(isFrozen, true);
 	setInitialState(isActive);
@@ -108,15 +107,47 @@ void MovingTile::loadAnimation(int skinNr) {
 	m_frozenSprites.push_back(sprite);
 }
 
-void MovingTile::update(const sf::Time& frameTime) {
-	if (m_isFrozen) {
-		if (!m_isPermanentlyFrozen) {
-			updateTime(m_frozenTime, frameTime);
-		}
+void MovingTile::updateFirst(const sf::Time& frameTime) {
+	if (!m_isOriginSet) {
+		m_origin = getPosition();
+		m_isOriginSet = true;
+	}
+
+	m_relativeVelocity = sf::Vector2f();
+	sf::Time time = frameTime == sf::Time::Zero ? sf::Time::Zero : getSimulationTime(frameTime);
+	if (time == sf::Time::Zero) {
+		LevelMovableTile::updateFirst(frameTime);
+		return;
+	}
+
+	// the tile and the mobs on it move by the same distance in this frame, also if it has turned or caught up in between
+	advance(time);
+	sf::Vector2f position = m_origin + m_forwardVelocity * m_motion.getOffset();
+	m_relativeVelocity = (position - getPosition()) / frameTime.asSeconds();
+	LevelMovableTile::updateFirst(frameTime);
+
+	// the relative velocity step can be refused or rounded, the motion decides where the tile is
+	if (getPosition() != position) {
+		setPosition(position);
+	}
+}
+
+void MovingTile::advance(sf::Time time) {
+	if (m_isFrozen && !m_isPermanentlyFrozen) {
+		sf::Time frozenTime = std::min(time, m_frozenTime);
+		updateTime(m_frozenTime, frozenTime);
+		time -= frozenTime;
 		if (m_frozenTime == sf::Time::Zero) {
 			setFrozen(false);
-			return;
 		}
+	}
+	if (m_isFrozen || !m_isActive) return;
+
+	m_motion.advance(time);
+}
+
+void MovingTile::update(const sf::Time& frameTime) {
+	if (m_isFrozen) {
 		// scale frozen sprites accordingly for fading
 		float scale = m_frozenTime > FROZEN_FADING_TIME ? 1.f : m_frozenTime / FROZEN_FADING_TIME;
 		sf::Uint8 scaleU = static_cast<sf::Uint8>(scale * 255);
@@ -126,12 +157,6 @@ void MovingTile::update(const sf::Time& frameTime) {
 		return;
 	}
 	if (m_isActive) {
-		updateTime(m_timeUntilTurn, frameTime);
-		if (m_timeUntilTurn == sf::Time::Zero) {
-			m_timeUntilTurn = m_distanceTime;
-			m_currentVelocity = -m_currentVelocity;
-			m_relativeVelocity = m_currentVelocity;
-		}
 		MovableGameObject::update(frameTime);
 	}
 
@@ -213,7 +238,6 @@ void MovingTile::setFrozen(bool frozen, bool permanent) {
 	if (!m_isFreezable && frozen) return;
 	m_isFrozen = frozen;
 	m_isPermanentlyFrozen = permanent;
-	m_relativeVelocity = m_isFrozen || !m_isActive ? sf::Vector2f() : m_currentVelocity;
 	setPosition(getPosition());
 	if (m_isFrozen) {
 		m_frozenTime = FROZEN_TIME;
@@ -222,7 +246,6 @@ void MovingTile::setFrozen(bool frozen, bool permanent) {
 
 void MovingTile::setInitialState(bool on) {
 	m_isActive = on;
-	m_relativeVelocity = m_isFrozen || !m_isActive ? sf::Vector2f() : m_currentVelocity;
 	setPosition(getPosition());
 }
 
@@ -71,7 +71,7 @@ void ParticleTile::loadWaterParticles() {
 	data.emitRate = 100.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_DROP;
-	data.particleTexture = getParticleTexture();
+	data.particlePass = getParticlePass();
 
 	// Generators
 	auto posGen = new particles::BoxSpawner();
@@ -110,7 +110,7 @@ void ParticleTile::loadEmberParticles() {
 	data.emitRate = 5.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = getParticleTexture();
+	data.particlePass = getParticlePass();
 
 	// Generators
 	auto posGen = new particles::DiskSpawner();
@@ -154,7 +154,7 @@ void ParticleTile::loadFlameParticles() {
 	data.emitRate = 60.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_FLAME;
-	data.particleTexture = getParticleTexture();
+	data.particlePass = getParticlePass();
 
 	// Generators
 	auto posGen = new particles::BoxSpawner();
@@ -206,9 +206,9 @@ void ParticleTile::loadParticleSystem(int skinNr) {
 	}
 }
 
-sf::RenderTexture* ParticleTile::getParticleTexture() {
-	return m_isForegroundTile ? &dynamic_cast<LevelScreen*>(getScreen())->getParticleFGRenderTexture()	:
-		&dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+RenderPass* ParticleTile::getParticlePass() {
+	return m_isForegroundTile ? &dynamic_cast<LevelScreen*>(getScreen())->getParticleFGPass()	:
+		&dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 }
 
 particles::ColorGenerator* ParticleTile::getWaterColorGenerator(const std::string& color) {
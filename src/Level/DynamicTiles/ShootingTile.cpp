@@ -9,6 +9,8 @@ REGISTER_LEVEL_DYNAMIC_TILE(LevelDynamicTileID::Shooting, ShootingTile)
 
 ShootingTile::ShootingTile(LevelScreen* levelScreen) :
 	LevelDynamicTile(levelScreen) {
+	// the timers go on off-screen, so a row of traps doesn't get out of sync when the player looks away
+	m_isAlwaysUpdate = true;
 }
 
 bool ShootingTile::init(const LevelTileProperties& properties) {
@@ -156,12 +158,27 @@ void ShootingTile::setInitialState(bool on) {
 }
 
 void ShootingTile::update(const sf::Time& frameTime) {
-	LevelDynamicTile::update(frameTime);
-	if (m_state == GameObjectState::Dead || m_isInactive)
-		return;
+	sf::Time time = getSimulationTime(frameTime);
+	if (time == sf::Time::Zero) return;
+	LevelDynamicTile::update(time);
+
+	// the timers are advanced from one running out to the next, so a tile that catches up
+	// goes through the same states as one that is updated every frame
+	while (m_state != GameObjectState::Dead && !m_isInactive && m_cooldown > sf::Time::Zero) {
+		sf::Time step = std::min(time, m_remainingCooldown);
+		for (auto& timer : { m_remainingRecoveringTime, m_remainingActiveTime, m_remainingSpellOffsetTime }) {
+			if (timer > sf::Time::Zero) step = std::min(step, timer);
+		}
+		time -= step;
+		// only the spells of this frame are cast, and only where they can be seen
+		updateTimers(step, time < frameTime && isViewable());
+		if (time == sf::Time::Zero) return;
+	}
+}
 
+void ShootingTile::updateTimers(const sf::Time& time, bool isCasting) {
 	if (m_remainingRecoveringTime > sf::Time::Zero) {
-		updateTime(m_remainingRecoveringTime, frameTime);
+		updateTime(m_remainingRecoveringTime, time);
 		if (m_remainingRecoveringTime == sf::Time::Zero) {
 			setState(GameObjectState::Idle);
 			m_isBroken = false;
@@ -169,21 +186,21 @@ void ShootingTile::update(const sf::Time& frameTime) {
 	}
 
 	if (m_remainingActiveTime > sf::Time::Zero) {
-		updateTime(m_remainingActiveTime, frameTime);
+		updateTime(m_remainingActiveTime, time);
 		if (m_remainingActiveTime == sf::Time::Zero) {
 			setState(m_isBroken ? GameObjectState::Broken : GameObjectState::Idle);
 		}
 	}
 
 	if (m_remainingSpellOffsetTime > sf::Time::Zero) {
-		updateTime(m_remainingSpellOffsetTime, frameTime);
-		if (m_remainingSpellOffsetTime == sf::Time::Zero) {
+		updateTime(m_remainingSpellOffsetTime, time);
+		if (m_remainingSpellOffsetTime == sf::Time::Zero && isCasting) {
 			executeSpells();
 			m_isInactive = m_isOnce;
 		}
 	}
 
-	updateTime(m_remainingCooldown, frameTime);
+	updateTime(m_remainingCooldown, time);
 	if (m_remainingCooldown == sf::Time::Zero) {
 		m_remainingCooldown = m_cooldown;
 		m_remainingActiveTime = m_activeTime;
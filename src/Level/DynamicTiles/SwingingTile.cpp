@@ -48,6 +48,8 @@ bool SwingingTile::init(const LevelTileProperties& properties) {
 		m_isClockwise = mode != "ccw";
 	}
 
+	m_pendulum.init(m_currentRotation, m_speed / m_length);
+
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 2 * TILE_SIZE_F * (m_size + 1), 2 * TILE_SIZE_F * (m_size + 1)));
 	setSpriteOffset(sf::Vector2f(TILE_SIZE_F * (m_size - 0.5f), TILE_SIZE_F * (m_size + 0.5f)));
 	setPositionOffset(sf::Vector2f(-TILE_SIZE_F * (m_size + 0.5f), -TILE_SIZE_F * (m_size + 0.5f)));
@@ -112,29 +114,24 @@ void SwingingTile::loadAnimation(const int skinNr) {
 }
 
 void SwingingTile::update(const sf::Time& frametime) {
+	sf::Time time = getSimulationTime(frametime);
+	if (time == sf::Time::Zero) return;
+
 	if (!m_isInactive) {
 		switch (m_mode) {
 		case SwingingTileMode::Round:
-			animateRound(frametime);
+			animateRound(time);
 			break;
 		case SwingingTileMode::Pendulum:
 		default:
-			animatePendulum(frametime);
+			m_currentRotation = m_pendulum.advance(time);
 		}
 	}
 
 	m_currentRotation = modAngle(m_currentRotation);
 	m_animatedSprite.setRotation(m_currentRotation + 180.f);
 	m_debugCircle.setPosition(getHeadPosition());
-	LevelDynamicTile::update(frametime);
-}
-
-void SwingingTile::animatePendulum(const sf::Time& frametime) {
-	float rad = degToRad(m_currentRotation);
-	float acc = m_speed / m_length * std::sin(rad);
-	m_pendulumVelocity += acc * frametime.asSeconds();
-	rad += m_pendulumVelocity * frametime.asSeconds();
-	m_currentRotation = radToDeg(rad);
+	LevelDynamicTile::update(time);
 }
 
 void SwingingTile::animateRound(const sf::Time& frametime) {
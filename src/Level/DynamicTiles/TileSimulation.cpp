@@ -0,0 +1,52 @@
+#include "Level/DynamicTiles/TileSimulation.h"
+
+const sf::Time SimulationClock::OFFSCREEN_TICK_TIME = sf::milliseconds(200);
+const sf::Time PendulumMotion::STEP_TIME = sf::microseconds(8000);
+
+sf::Time SimulationClock::tick(const sf::Time& frameTime, bool isFar) {
+	m_missedTime += frameTime;
+	if (isFar && m_missedTime < OFFSCREEN_TICK_TIME) return sf::Time::Zero;
+	sf::Time time = m_missedTime;
+	m_missedTime = sf::Time::Zero;
+	return time;
+}
+
+void BackAndForthMotion::setDistanceTime(const sf::Time& distanceTime) {
+	m_distanceTime = distanceTime;
+	m_time = sf::Time::Zero;
+}
+
+float BackAndForthMotion::advance(const sf::Time& time) {
+	if (m_distanceTime == sf::Time::Zero) return 0.f;
+	float oldOffset = getOffset();
+	m_time = (m_time + time) % (m_distanceTime * static_cast<sf::Int64>(2));
+	return getOffset() - oldOffset;
+}
+
+bool BackAndForthMotion::isBack() const {
+	return m_time >= m_distanceTime;
+}
+
+float BackAndForthMotion::getOffset() const {
+	return isBack() ?
+		(m_distanceTime * static_cast<sf::Int64>(2) - m_time).asSeconds() :
+		m_time.asSeconds();
+}
+
+void PendulumMotion::init(float rotation, float acceleration) {
+	m_rad = degToRad(rotation);
+	m_velocity = 0.f;
+	m_acceleration = acceleration;
+	m_time = sf::Time::Zero;
+}
+
+float PendulumMotion::advance(const sf::Time& time) {
+	m_time += time;
+	float step = STEP_TIME.asSeconds();
+	while (m_time >= STEP_TIME) {
+		m_velocity += m_acceleration * std::sin(m_rad) * step;
+		m_rad += m_velocity * step;
+		m_time -= STEP_TIME;
+	}
+	return radToDeg(m_rad);
+}
\ No newline at end of file
@@ -126,60 +126,61 @@ sf::Time BatEnemy::getConfiguredChasingTime() const {
 void BatEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 50.f, 40.f));
 	setSpriteOffset(sf::Vector2f(-15.f, -30.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
 
 	int width = 80;
 	int height = 90;
 
-	Animation* flyingAnimation = new Animation();
-	flyingAnimation->setSpriteSheet(tex);
-	flyingAnimation->addFrame(sf::IntRect(0 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(2 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(3 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(4 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(5 * width, skinNr * height, width, height));
-	flyingAnimation->addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
-
-	addAnimation(GameObjectState::Flying, flyingAnimation);
-
-	Animation* idleAnimation = new Animation();
-	idleAnimation->setSpriteSheet(tex);
-	idleAnimation->addFrame(sf::IntRect(0 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(2 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(3 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(4 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(5 * width, skinNr * height, width, height));
-	idleAnimation->addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
-
-	addAnimation(GameObjectState::Idle, idleAnimation);
-
-	Animation* fightingAnimation = new Animation();
-	fightingAnimation->setSpriteSheet(tex);
-	fightingAnimation->addFrame(sf::IntRect(8 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(9 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(10 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(11 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(9 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(10 * width, skinNr * height, width, height));
-	fightingAnimation->addFrame(sf::IntRect(11 * width, skinNr * height, width, height));
-
-	addAnimation(GameObjectState::Fighting, fightingAnimation);
-
-	Animation* deadAnimation = new Animation(sf::seconds(10.f));
-	deadAnimation->setSpriteSheet(tex);
-	deadAnimation->addFrame(sf::IntRect(7 * width, skinNr * height, width, height));
-	deadAnimation->setLooped(false);
-
-	addAnimation(GameObjectState::Dead, deadAnimation);
-
-	Animation* hangingAnimation = new Animation(sf::seconds(10.f));
-	hangingAnimation->setSpriteSheet(tex);
-	hangingAnimation->addFrame(sf::IntRect(6 * width, skinNr * height, width, height));
-	hangingAnimation->setLooped(false);
-
-	addAnimation(GameObjectState::Hanging, hangingAnimation);
+	const Animation* flyingAnimation = g_resourceManager->getAnimation(getSpritePath(), "flying", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(2 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(3 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(4 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(5 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
+	});
+
+	addSharedAnimation(GameObjectState::Flying, flyingAnimation);
+
+	const Animation* idleAnimation = g_resourceManager->getAnimation(getSpritePath(), "idle", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(2 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(3 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(4 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(5 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(1 * width, skinNr * height, width, height));
+	});
+
+	addSharedAnimation(GameObjectState::Idle, idleAnimation);
+
+	const Animation* fightingAnimation = g_resourceManager->getAnimation(getSpritePath(), "fighting", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(8 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(9 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(10 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(11 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(9 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(10 * width, skinNr * height, width, height));
+		animation.addFrame(sf::IntRect(11 * width, skinNr * height, width, height));
+	});
+
+	addSharedAnimation(GameObjectState::Fighting, fightingAnimation);
+
+	const Animation* deadAnimation = g_resourceManager->getAnimation(getSpritePath(), "dead", skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(10.f));
+		animation.addFrame(sf::IntRect(7 * width, skinNr * height, width, height));
+		animation.setLooped(false);
+	});
+
+	addSharedAnimation(GameObjectState::Dead, deadAnimation);
+
+	const Animation* hangingAnimation = g_resourceManager->getAnimation(getSpritePath(), "hanging", skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(10.f));
+		animation.addFrame(sf::IntRect(6 * width, skinNr * height, width, height));
+		animation.setLooped(false);
+	});
+
+	addSharedAnimation(GameObjectState::Hanging, hangingAnimation);
 
 	// initial values
 	setState(GameObjectState::Hanging);
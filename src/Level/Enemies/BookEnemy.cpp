@@ -124,7 +124,7 @@ sf::Time BookEnemy::getConfiguredChasingTime() const {
 void BookEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 70.f, 50.f));
 	setSpriteOffset(sf::Vector2f(-20.f, -7.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	int width = 100;
 	int height = 64;
@@ -75,7 +75,7 @@ void CairnEnemy::handleAttackInput() {
 void CairnEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 88.f));
 	setSpriteOffset(sf::Vector2f(-37.f, -32.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	int width = 100;
 	int height = 120;
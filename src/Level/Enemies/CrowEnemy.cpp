@@ -100,39 +100,38 @@ sf::Time CrowEnemy::getConfiguredChasingTime() const {
 void CrowEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 60.f, 54.f));
 	setSpriteOffset(sf::Vector2f(-5.f, -5.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
 
-	Animation* flyingAnimation = new Animation();
-	flyingAnimation->setSpriteSheet(tex);
-	flyingAnimation->addFrame(sf::IntRect(0, 0, 70, 64));
-	flyingAnimation->addFrame(sf::IntRect(70, 0, 70, 64));
-	flyingAnimation->addFrame(sf::IntRect(140, 0, 70, 64));
-	flyingAnimation->addFrame(sf::IntRect(210, 0, 70, 64));
+	const Animation* flyingAnimation = g_resourceManager->getAnimation(getSpritePath(), "flying", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 70, 64));
+		animation.addFrame(sf::IntRect(70, 0, 70, 64));
+		animation.addFrame(sf::IntRect(140, 0, 70, 64));
+		animation.addFrame(sf::IntRect(210, 0, 70, 64));
+	});
 
-	addAnimation(GameObjectState::Flying, flyingAnimation);
+	addSharedAnimation(GameObjectState::Flying, flyingAnimation);
 
-	Animation* idleAnimation = new Animation();
-	idleAnimation->setSpriteSheet(tex);
-	idleAnimation->addFrame(sf::IntRect(0, 0, 70, 64));
-	idleAnimation->addFrame(sf::IntRect(70, 0, 70, 64));
-	idleAnimation->addFrame(sf::IntRect(140, 0, 70, 64));
-	idleAnimation->addFrame(sf::IntRect(210, 0, 70, 64));
+	const Animation* idleAnimation = g_resourceManager->getAnimation(getSpritePath(), "idle", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 70, 64));
+		animation.addFrame(sf::IntRect(70, 0, 70, 64));
+		animation.addFrame(sf::IntRect(140, 0, 70, 64));
+		animation.addFrame(sf::IntRect(210, 0, 70, 64));
+	});
 
-	addAnimation(GameObjectState::Idle, idleAnimation);
+	addSharedAnimation(GameObjectState::Idle, idleAnimation);
 
-	Animation* fightingAnimation = new Animation();
-	fightingAnimation->setSpriteSheet(tex);
-	fightingAnimation->addFrame(sf::IntRect(0, 64, 70, 64));
-	fightingAnimation->addFrame(sf::IntRect(70, 64, 70, 64));
-	fightingAnimation->addFrame(sf::IntRect(140, 64, 70, 64));
+	const Animation* fightingAnimation = g_resourceManager->getAnimation(getSpritePath(), "fighting", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 64, 70, 64));
+		animation.addFrame(sf::IntRect(70, 64, 70, 64));
+		animation.addFrame(sf::IntRect(140, 64, 70, 64));
+	});
 
-	addAnimation(GameObjectState::Fighting, fightingAnimation);
+	addSharedAnimation(GameObjectState::Fighting, fightingAnimation);
 
-	Animation* deadAnimation = new Animation();
-	deadAnimation->setSpriteSheet(tex);
-	deadAnimation->addFrame(sf::IntRect(0, 128, 70, 64));
+	const Animation* deadAnimation = g_resourceManager->getAnimation(getSpritePath(), "dead", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 128, 70, 64));
+	});
 
-	addAnimation(GameObjectState::Dead, deadAnimation);
+	addSharedAnimation(GameObjectState::Dead, deadAnimation);
 
 	// initial values
 	setState(GameObjectState::Idle);
@@ -202,7 +202,7 @@ void DragonWhelpEnemy::loadAnimation(int skinNr) {
 	LightData data(sf::Vector2f(m_boundingBox.width * 0.5f, m_boundingBox.height * 0.5f), 150.f, 0.5f);
 	addComponent(new LightComponent(data, this));
 
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	int width = 70;
 	int height = 90;
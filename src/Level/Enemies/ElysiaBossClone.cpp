@@ -86,7 +86,7 @@ void ElysiaBossClone::handleAttackInput() {
 void ElysiaBossClone::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 80.f, 50.f));
 	setSpriteOffset(sf::Vector2f(-50.f, -50.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 	int width = 180;
 	int height = 150;
 
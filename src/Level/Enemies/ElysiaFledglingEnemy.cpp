@@ -125,7 +125,7 @@ void ElysiaFledglingEnemy::loadAnimation(int skinNr) {
 	setSpriteOffset(sf::Vector2f(-5.f, -50.f));
 	int width = 70;
 	int height = 110;
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* flyingAnimation = new Animation();
 	flyingAnimation->setSpriteSheet(tex);
@@ -146,7 +146,7 @@ void GargoyleEnemy::loadAnimation(int skinNr) {
 	LightData data(sf::Vector2f(m_boundingBox.width * 0.5f, m_boundingBox.height * 0.5f), sf::Vector2f(250.f, 250.f), 0.3f);
 	addComponent(new LightComponent(data, this));
 
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* flyingAnimation = new Animation();
 	flyingAnimation->setSpriteSheet(tex);
@@ -160,7 +160,7 @@ void JanusBoss::setEvil(bool evil) {
 void JanusBoss::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 60.f, 150.f));
 	setSpriteOffset(sf::Vector2f(-70.f, -65.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 	int width = 200;
 	int height = 200;
 
@@ -10,7 +10,6 @@
 #include "GameObjectComponents/ParticleComponent.h"
 #include "Registrar.h"
 #include "GlobalResource.h"
-#include "Steam/AchievementManager.h"
 
 REGISTER_ENEMY(EnemyID::Boss_Jeremy, JeremyBoss)
 
@@ -50,8 +49,6 @@ void JeremyBoss::setDead() {
 			rec.boundingBox.left += 20.f;
 		}
 	}
-
-	g_achievementManager->notifyAchievement(ACH_MERCENARY_ORDER, "jeremy");
 }
 
 void JeremyBoss::loadAttributes() {
@@ -139,7 +136,7 @@ void JeremyBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-45.f, -30.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -245,7 +242,7 @@ void  JeremyBoss::notifyRoyDeath(const sf::Vector2f& newPos) {
 void JeremyBoss::loadComponents() {
 	// add particles
 	ParticleComponentData data;
-	data.particleTexture = &(dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture());
+	data.particlePass = &(dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass());
 	data.emitRate = 30.f;
 	data.particleCount = 60;
 	data.isAdditiveBlendMode = true;
@@ -6,7 +6,6 @@
 #include "Level/MOBBehavior/AttackingBehaviors/AggressiveBehavior.h"
 #include "Level/MOBBehavior/ScriptedBehavior/ScriptedBehavior.h"
 #include "Registrar.h"
-#include "Steam/AchievementManager.h"
 
 REGISTER_ENEMY(EnemyID::Boss_Morgiana, MorgianaBoss)
 
@@ -138,8 +137,6 @@ void MorgianaBoss::setDead() {
 			rec.boundingBox.left += 20.f;
 		}
 	}
-
-	g_achievementManager->notifyAchievement(ACH_MERCENARY_ORDER, "morgiana");
 }
 
 void MorgianaBoss::notifyJeremyDeath(const sf::Vector2f& newPos) {
@@ -189,7 +186,7 @@ void MorgianaBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-45.f, -60.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -110,7 +110,7 @@ sf::Time ObserverEnemy::getConfiguredChasingTime() const {
 
 void ObserverEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 50.f, 40.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	// Idle animation
 	Animation* idleAnimation = new Animation(sf::seconds(10.f));
@@ -77,7 +77,7 @@ void OozeEnemy::loadAnimation(int skinNr) {
 	setSpriteOffset(sf::Vector2f(-5.f, -20.f));
 	int width = 60;
 	int height = 50;
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* idleAnimation = new Animation(sf::milliseconds(200));
 	idleAnimation->setSpriteSheet(tex);
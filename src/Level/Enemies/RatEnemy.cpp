@@ -87,41 +87,41 @@ bool RatEnemy::getFleeCondition() const {
 void RatEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 40.f, 30.f));
 	setSpriteOffset(sf::Vector2f(-5.f, -20.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
 
-	Animation* walkingAnimation = new Animation();
-	walkingAnimation->setSpriteSheet(tex);
-	walkingAnimation->addFrame(sf::IntRect(0, 0, 50, 50));
-	walkingAnimation->addFrame(sf::IntRect(50, 0, 50, 50));
-	walkingAnimation->addFrame(sf::IntRect(100, 0, 50, 50));
-	walkingAnimation->addFrame(sf::IntRect(50, 0, 50, 50));
+	const Animation* walkingAnimation = g_resourceManager->getAnimation(getSpritePath(), "walking", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 50, 50));
+		animation.addFrame(sf::IntRect(50, 0, 50, 50));
+		animation.addFrame(sf::IntRect(100, 0, 50, 50));
+		animation.addFrame(sf::IntRect(50, 0, 50, 50));
+	});
 
-	addAnimation(GameObjectState::Walking, walkingAnimation);
+	addSharedAnimation(GameObjectState::Walking, walkingAnimation);
 
-	Animation* idleAnimation = new Animation();
-	idleAnimation->setSpriteSheet(tex);
-	idleAnimation->addFrame(sf::IntRect(50, 0, 50, 50));
+	const Animation* idleAnimation = g_resourceManager->getAnimation(getSpritePath(), "idle", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(50, 0, 50, 50));
+	});
 
-	addAnimation(GameObjectState::Idle, idleAnimation);
+	addSharedAnimation(GameObjectState::Idle, idleAnimation);
 
-	Animation* jumpingAnimation = new Animation();
-	jumpingAnimation->setSpriteSheet(tex);
-	jumpingAnimation->addFrame(sf::IntRect(150, 0, 50, 50));
+	const Animation* jumpingAnimation = g_resourceManager->getAnimation(getSpritePath(), "jumping", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(150, 0, 50, 50));
+	});
 
-	addAnimation(GameObjectState::Jumping, jumpingAnimation);
+	addSharedAnimation(GameObjectState::Jumping, jumpingAnimation);
 
-	Animation* fightingAnimation = new Animation(sf::seconds(0.08f));
-	fightingAnimation->setSpriteSheet(tex);
-	fightingAnimation->addFrame(sf::IntRect(200, 0, 50, 50));
-	fightingAnimation->addFrame(sf::IntRect(250, 0, 50, 50));
+	const Animation* fightingAnimation = g_resourceManager->getAnimation(getSpritePath(), "fighting", skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(0.08f));
+		animation.addFrame(sf::IntRect(200, 0, 50, 50));
+		animation.addFrame(sf::IntRect(250, 0, 50, 50));
+	});
 
-	addAnimation(GameObjectState::Fighting, fightingAnimation);
+	addSharedAnimation(GameObjectState::Fighting, fightingAnimation);
 
-	Animation* deadAnimation = new Animation();
-	deadAnimation->setSpriteSheet(tex);
-	deadAnimation->addFrame(sf::IntRect(300, 0, 50, 50));
+	const Animation* deadAnimation = g_resourceManager->getAnimation(getSpritePath(), "dead", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(300, 0, 50, 50));
+	});
 
-	addAnimation(GameObjectState::Dead, deadAnimation);
+	addSharedAnimation(GameObjectState::Dead, deadAnimation);
 
 	// initial values
 	setState(GameObjectState::Idle);
@@ -7,7 +7,6 @@
 #include "Level/MOBBehavior/ScriptedBehavior/ScriptedBehavior.h"
 #include "Registrar.h"
 #include "GlobalResource.h"
-#include "Steam/AchievementManager.h"
 
 REGISTER_ENEMY(EnemyID::Boss_Roy, RoyBoss)
 
@@ -95,8 +94,6 @@ void RoyBoss::setDead() {
 			rec.boundingBox.left += 20.f;
 		}
 	}
-
-	g_achievementManager->notifyAchievement(ACH_MERCENARY_ORDER, "roy");
 }
 
 void RoyBoss::notifyJeremyDeath(const sf::Vector2f& newPos) {
@@ -132,7 +129,7 @@ void RoyBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-45.f, -30.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
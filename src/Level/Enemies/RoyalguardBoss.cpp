@@ -107,7 +107,7 @@ void RoyalguardBoss::loadHealingParticles() {
 	ParticleComponentData data;
 	data.particleCount = 20;
 	data.texturePath = GlobalResource::TEX_PARTICLE_BLOB;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(m_screen)->getParticleFGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(m_screen)->getParticleFGPass();
 	data.emitRate = 5.f;
 	data.isAdditiveBlendMode = true;
 
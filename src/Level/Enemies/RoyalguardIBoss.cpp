@@ -136,7 +136,7 @@ void RoyalguardIBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-45.f, -60.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -217,7 +217,7 @@ void RoyalguardIBoss::loadFireParticles() {
 	data.emitRate = 50.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_FLAME;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	auto posGen = new particles::CircleSpawner();
@@ -274,7 +274,7 @@ void RoyalguardIBoss::loadFireLineParticles() {
 	data.emitRate = 400.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_FLAME;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	m_lineSpawner = new particles::LineSpawner();
@@ -394,7 +394,7 @@ void RoyalguardFire::loadParticles() {
 	data.emitRate = 1000.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_FLAME;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	m_posGen = new particles::BoxSpawner();
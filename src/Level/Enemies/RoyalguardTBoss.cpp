@@ -140,7 +140,7 @@ void RoyalguardTBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 30.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-45.f, -60.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -216,7 +216,7 @@ void RoyalguardTBoss::loadParticles() {
 	data.emitRate = 100.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	auto posGen = new particles::EllipseSpawner();
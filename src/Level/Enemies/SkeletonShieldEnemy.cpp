@@ -57,7 +57,7 @@ void SkeletonShieldEnemy::handleAttackInput() {
 void SkeletonShieldEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 40.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-40.f, -30.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation();
 	walkingAnimation->setSpriteSheet(tex);
@@ -765,7 +765,7 @@ void VeliusBoss::loadAnimation(int skinNr) {
 
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 25.f, 115.f));
 	setSpriteOffset(sf::Vector2f(-50.f, -35.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.1f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -921,7 +921,7 @@ void VeliusBoss::loadElementalParticles() {
 	data.emitRate = 400.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	m_elementalSpawner = new particles::LineSpawner();
@@ -37,7 +37,7 @@ void VeliusVictim::update(const sf::Time& frameTime) {
 		updateTime(m_timeUntilDamage, frameTime);
 		if (m_timeUntilDamage == sf::Time::Zero) {
 			m_timeUntilDamage = sf::seconds(1.f);
-			m_damageNumbers->emitNumber(1, sf::Vector2f(getPosition().x + 0.5f * getSize().x, getPosition().y), DamageNumberType::Damage, false);
+			emitDamageNumber(1, DamageNumberType::Damage, false);
 			m_attributes.currentHealthPoints -= 1;
 			if (m_attributes.currentHealthPoints == 0) {
 				setDead();
@@ -81,7 +81,7 @@ void VeliusVictim::loadAnimation(int skinNr) {
 	setSpriteOffset(sf::Vector2f(-45.f, -30.f));
 	int width = 120;
 	int height = 170;
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation();
 	walkingAnimation->setSpriteSheet(tex);
@@ -89,7 +89,7 @@ void WardenEnemy::updateObservedRange() {
 
 void WardenEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 50.f, 50.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	// Idle animation
 	Animation* idleAnimation = new Animation(sf::milliseconds(150));
@@ -113,7 +113,7 @@ sf::Time WispEnemy::getConfiguredChasingTime() const {
 void WispEnemy::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 20.f, 20.f));
 	setSpriteOffset(sf::Vector2f(-30.f, -30.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* flyingAnimation = new Animation();
 	flyingAnimation->setSpriteSheet(tex);
@@ -118,7 +118,7 @@ void WolfBoss::handleAttackInput() {
 void WolfBoss::loadAnimation(int skinNr) {
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 200.f, 90.f));
 	setSpriteOffset(sf::Vector2f(-50.f, -160.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* walkingAnimation = new Animation(sf::seconds(0.05f));
 	walkingAnimation->setSpriteSheet(tex);
@@ -70,7 +70,7 @@ void WolfEnemy::handleAttackInput() {
 }
 
 void WolfEnemy::loadAnimation(int skinNr) {
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 	setBoundingBox(sf::FloatRect(0.f, 0.f, 106.f, 55.f));
 	setSpriteOffset(sf::Vector2f(-17.f, -45.f));
 
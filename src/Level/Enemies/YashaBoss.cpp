@@ -369,7 +369,7 @@ void YashaBoss::loadComponents() {
 	data.emitRate = 300.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_FLAME;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	auto posGen = new particles::EllipseSpawner();
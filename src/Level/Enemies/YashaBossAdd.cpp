@@ -98,7 +98,7 @@ void YashaBossAdd::loadAnimation(int skinNr) {
 	const int width = 300;
 	const int height = 250;
 	
-	const sf::Texture* tex = g_resourceManager->getTexture(getSpritePath());
+	const sf::Texture* tex = g_resourceManager->getSpriteSheet(getSpritePath());
 
 	Animation* idleAnimation = new Animation();
 	idleAnimation->setSpriteSheet(tex);
@@ -139,7 +139,7 @@ void YashaBossAdd::loadComponents() {
 	data.emitRate = 50.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	auto posGen = new particles::EllipseSpawner();
@@ -197,7 +197,7 @@ void YashaBossAdd::loadLineParticles() {
 	data.emitRate = 400.f;
 	data.isAdditiveBlendMode = true;
 	data.texturePath = GlobalResource::TEX_PARTICLE_STAR;
-	data.particleTexture = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGRenderTexture();
+	data.particlePass = &dynamic_cast<LevelScreen*>(getScreen())->getParticleBGPass();
 
 	// Generators
 	m_lineSpawner = new particles::LineSpawner();
@@ -12,6 +12,7 @@
 #include "Enums/EnumNames.h"
 #include "Level/DamageNumbers.h"
 #include "GlobalResource.h"
+#include "GameplayEventBus.h"
 
 const float Enemy::HP_BAR_HEIGHT = 3.f;
 const float Enemy::PICKUP_RANGE = 100.f;
@@ -54,8 +55,7 @@ void Enemy::load(int skinNr) {
 	loadBehavior();
 	m_spellManager->setSpellsAllied(m_isAlly);
 
-	delete m_damageNumbers;
-	m_damageNumbers = new DamageNumbers(this->isAlly());
+	m_damageNumbers = dynamic_cast<LevelScreen*>(m_screen)->getDamageNumbers();
 
 	if (!m_spellManager->getSpellMap().empty() && m_movingBehavior != nullptr) {
 		const SpellData& spellData = m_spellManager->getSpellMap().at(0)->getSpellData();
@@ -120,6 +120,11 @@ void Enemy::update(const sf::Time& frameTime) {
 	m_targetSprite.setPosition(getBoundingBox()->left + 0.5f * getBoundingBox()->width, getBoundingBox()->top + 0.5f * getBoundingBox()->height);
 }
 
+void Enemy::think() {
+	if (m_enemyAttackingBehavior == nullptr) return;
+	m_enemyAttackingBehavior->think();
+}
+
 void Enemy::updateHpBar() {
 	if (!m_isHPBarVisible) return;
 	m_hpBar.setPosition(getBoundingBox()->left, getBoundingBox()->top - getConfiguredDistanceToHPBar());
@@ -449,6 +454,8 @@ void Enemy::setDead() {
 		return;
 	}
 
+	g_gameplayEventBus->publish(GameplayEventType::EnemyKilled, static_cast<int>(getEnemyID()));
+
 	if (m_isUnique && !m_isBoss) {
 		notifyKilled();
 	}
@@ -0,0 +1,132 @@
+#include "Level/EquipmentAtlas.h"
+#include "World/AnimatedGameObject.h"
+#include "Logger.h"
+
+const int EquipmentAtlas::MAX_COLUMNS = 8;
+
+EquipmentAtlas::~EquipmentAtlas() {
+	clearAnimations();
+}
+
+EquipmentAtlasLayer EquipmentAtlas::createLayer(const AnimatedGameObject& object, const sf::Vector2i& offset) {
+	EquipmentAtlasLayer layer;
+	layer.offset = offset;
+
+	const sf::Texture* spriteSheet = nullptr;
+	for (auto& it : object.getAnimations()) {
+		const Animation* animation = it.second;
+		if (animation->getSpriteSheet() == nullptr) continue;
+		if (spriteSheet == nullptr) {
+			spriteSheet = animation->getSpriteSheet();
+		}
+		else if (spriteSheet != animation->getSpriteSheet()) {
+			g_logger->logWarning("EquipmentAtlas", "All animations of a layer must use the same sprite sheet, ignoring the other ones.");
+			continue;
+		}
+
+		std::vector<sf::IntRect>& frames = layer.frames[it.first];
+		for (size_t i = 0; i < animation->getSize(); ++i) {
+			frames.push_back(animation->getFrame(i));
+		}
+	}
+
+	if (spriteSheet != nullptr) {
+		layer.spriteSheet = spriteSheet->copyToImage();
+	}
+	return layer;
+}
+
+void EquipmentAtlas::bake(const std::vector<EquipmentAtlasLayer>& layers, const sf::Vector2i& frameSize) {
+	clear();
+	if (layers.empty() || frameSize.x <= 0 || frameSize.y <= 0) return;
+
+	const EquipmentAtlasLayer& base = layers[0];
+	int frameCount = 0;
+	for (auto& it : base.frames) {
+		frameCount += static_cast<int>(it.second.size());
+	}
+	if (frameCount == 0) return;
+
+	int columns = std::min(frameCount, MAX_COLUMNS);
+	int rows = (frameCount + columns - 1) / columns;
+	m_image.create(columns * frameSize.x, rows * frameSize.y, sf::Color::Transparent);
+
+	int index = 0;
+	for (auto& it : base.frames) {
+		std::vector<sf::IntRect>& composedFrames = m_frames[it.first];
+		for (size_t i = 0; i < it.second.size(); ++i) {
+			sf::IntRect composedFrame((index % columns) * frameSize.x, (index / columns) * frameSize.y, frameSize.x, frameSize.y);
+
+			for (auto& layer : layers) {
+				auto layerFrames = layer.frames.find(it.first);
+				if (layerFrames == layer.frames.end() || layerFrames->second.empty()) continue;
+
+				// clip the frame to the composed frame, so it never bleeds into its neighbours
+				sf::IntRect frame = layerFrames->second[i % layerFrames->second.size()];
+				frame.width = std::min(frame.width, frameSize.x - layer.offset.x);
+				frame.height = std::min(frame.height, frameSize.y - layer.offset.y);
+				if (frame.width <= 0 || frame.height <= 0 || layer.offset.x < 0 || layer.offset.y < 0) continue;
+
+				// alpha blended exactly like a layered draw onto a transparent render texture
+				m_image.copy(layer.spriteSheet, composedFrame.left + layer.offset.x, composedFrame.top + layer.offset.y, frame, true);
+			}
+
+			composedFrames.push_back(composedFrame);
+			++index;
+		}
+	}
+}
+
+bool EquipmentAtlas::load(const std::map<GameObjectState, const Animation*>& baseAnimations) {
+	clearAnimations();
+	if (m_frames.empty() || !m_texture.loadFromImage(m_image)) return false;
+
+	for (auto& it : baseAnimations) {
+		auto frames = m_frames.find(it.first);
+		if (frames == m_frames.end()) continue;
+
+		Animation* animation = new Animation(it.second->getFrameTime());
+		animation->setLooped(it.second->isLooped());
+		animation->setSpriteSheet(&m_texture);
+		for (auto& frame : frames->second) {
+			animation->addFrame(frame);
+		}
+		m_animations.insert({ it.second, animation });
+	}
+
+	return !m_animations.empty();
+}
+
+void EquipmentAtlas::clear() {
+	clearAnimations();
+	m_frames.clear();
+	m_image = sf::Image();
+}
+
+void EquipmentAtlas::clearAnimations() {
+	for (auto& it : m_animations) {
+		delete it.second;
+	}
+	m_animations.clear();
+}
+
+const Animation* EquipmentAtlas::getAnimation(const Animation* baseAnimation) const {
+	auto it = m_animations.find(baseAnimation);
+	if (it == m_animations.end()) return nullptr;
+	return it->second;
+}
+
+const std::vector<sf::IntRect>& EquipmentAtlas::getFrames(GameObjectState state) const {
+	static const std::vector<sf::IntRect> NO_FRAMES;
+	auto it = m_frames.find(state);
+	if (it == m_frames.end()) return NO_FRAMES;
+	return it->second;
+}
+
+const sf::Image& EquipmentAtlas::getImage() const {
+	return m_image;
+}
+
+bool EquipmentAtlas::isLoaded() const {
+	return !m_animations.empty();
+}
\ No newline at end of file
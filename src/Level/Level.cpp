@@ -1,6 +1,7 @@
 #include "Level/Level.h"
 #include "Screens/LevelScreen.h"
 #include "Level/DynamicTiles/MovingTile.h"
+#include "World/LoadingPipeline.h"
 
 const float Level::CAMERA_WINDOW_HEIGHT = 200.f;
 const float Level::CAMERA_WINDOW_WIDTH = 200.f;
@@ -59,36 +60,48 @@ void Level::loadAfterMainChar(MainCharacter* mainChar) {
 
 bool Level::load(const std::string& id, WorldScreen* screen) {
 	m_screen = screen;
-	LevelReader reader;
 	m_levelData.id = id;
-	if (!reader.readWorld(id, m_levelData, m_screen->getCharacterCore())) {
-		return false;
-	}
-	if (m_levelData.isBossLevel) {
-		m_bossLevel = new BossLevel(screen);
-		if (!m_bossLevel->loadLua(m_levelData.bossLevelPath)) {
+
+	LoadingPipeline pipeline("Level " + id);
+	int readStage = pipeline.addStage("read level", [this, &id]() {
+		LevelReader reader;
+		if (!reader.readWorld(id, m_levelData, m_screen->getCharacterCore())) {
 			return false;
 		}
-	}
-	if (m_levelData.isMagicLocked) {
-		for (int type = static_cast<int>(SpellType::VOID) + 1; type < static_cast<int>(SpellType::MAX); type++) {
-			setMagicLocked(static_cast<SpellType>(type));
+		if (m_levelData.isMagicLocked) {
+			for (int type = static_cast<int>(SpellType::VOID) + 1; type < static_cast<int>(SpellType::MAX); type++) {
+				setMagicLocked(static_cast<SpellType>(type));
+			}
 		}
-	}
 
-	// adjust weather
-	if (const WeatherData* weather = m_screen->getCharacterCore()->getWeather(id)) {
-		m_levelData.weather = *weather;
-	}
-
-	// load level
-	m_backgroundTileMap.load(m_levelData, m_levelData.backgroundTileLayers);
-	m_lightedForegroundTileMap.load(m_levelData, m_levelData.lightedForegroundTileLayers);
-	m_foregroundTileMap.load(m_levelData, m_levelData.foregroundTileLayers);
+		// adjust weather
+		if (const WeatherData* weather = m_screen->getCharacterCore()->getWeather(id)) {
+			m_levelData.weather = *weather;
+		}
+		return true;
+	});
 
-	g_resourceManager->loadLevelResources();
+	pipeline.addStage("boss level", [this, screen]() {
+		if (!m_levelData.isBossLevel) return true;
+		m_bossLevel = new BossLevel(screen);
+		return m_bossLevel->loadLua(m_levelData.bossLevelPath);
+	}, { readStage });
 
-	return true;
+	// load level
+	addTileMapStages(pipeline, m_levelData, readStage);
+
+	int decodeStage = pipeline.addStage("decode level resources", []() {
+		g_resourceManager->decodeLevelResources();
+		return true;
+	});
+	pipeline.addStage("upload level resources", []() {
+		g_resourceManager->loadLevelResources();
+		return true;
+	}, { decodeStage }, true);
+
+	bool isLoaded = pipeline.run(LoadingPipeline::getWorkerCount());
+	pipeline.logTimes();
+	return isLoaded;
 }
 
 void Level::loadForRenderTexture() {
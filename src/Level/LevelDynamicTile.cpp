@@ -63,3 +63,17 @@ void LevelDynamicTile::loadResources() {
 	g_resourceManager->loadTexture(getSpritePath(), ResourceType::Level);
 	g_resourceManager->loadSoundbuffer(getSoundPath(), ResourceType::Level);
 }
+
+sf::Time LevelDynamicTile::getSimulationTime(const sf::Time& frameTime) {
+	return m_simulationClock.tick(frameTime, isFarFromMainCharacter());
+}
+
+bool LevelDynamicTile::isFarFromMainCharacter() const {
+	if (m_mainChar == nullptr) return false;
+	// the view is a screen around the main character, so there is at least half a screen left
+	// for the distance a tile moves between two ticks
+	const sf::FloatRect& bb = *getBoundingBox();
+	sf::Vector2f center = m_mainChar->getCenter();
+	return bb.left > center.x + WINDOW_WIDTH || bb.left + bb.width < center.x - WINDOW_WIDTH ||
+		bb.top > center.y + WINDOW_HEIGHT || bb.top + bb.height < center.y - WINDOW_HEIGHT;
+}
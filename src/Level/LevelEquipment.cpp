@@ -55,7 +55,7 @@ void LevelEquipment::load(const ItemEquipmentBean* itemBean, ItemType type) {
 			if (ani.first == GameObjectState::Fighting) {
 				animation->setFrameTime(sf::milliseconds(70));
 			}
-			animation->setSpriteSheet(g_resourceManager->getTexture(eq.texture_path));
+			animation->setSpriteSheet(g_resourceManager->getSpriteSheet(eq.texture_path));
 			for (auto& frame : ani.second) {
 				animation->addFrame(frame);
 			}
@@ -84,7 +84,7 @@ void LevelEquipment::loadComponents(const ItemEquipmentLightBean* light, const I
 		data.emitRate = particles->emit_rate;
 		data.isAdditiveBlendMode = particles->is_additive_blend_mode;
 		data.texturePath = particles->texture_path;
-		data.particleTexture = &dynamic_cast<LevelScreen*>(m_screen)->getParticleEQRenderTexture();
+		data.particlePass = &dynamic_cast<LevelScreen*>(m_screen)->getParticleEQPass();
 
 		// Generators
 		auto posGen = new particles::DiskSpawner();
@@ -129,15 +129,18 @@ void LevelEquipment::loadComponents(const ItemEquipmentLightBean* light, const I
 }
 
 void LevelEquipment::calculatePositionAccordingToMainChar(sf::Vector2f& position) const {
-	sf::Vector2f mainCharPosition(m_mainChar->getPosition().x + (m_mainChar->getBoundingBox()->width / 2), m_mainChar->getPosition().y);
+	position = calculateFramePosition(*m_mainChar);
+}
+
+sf::Vector2f LevelEquipment::calculateFramePosition(const LevelMainCharacter& mainChar) {
+	sf::Vector2f mainCharPosition(mainChar.getPosition().x + (mainChar.getBoundingBox()->width / 2), mainChar.getPosition().y);
 	sf::Vector2f offset(-60.f, -30.f);
-	if (!m_mainChar->isFacingRight())
-		offset.x = -offset.x - getBoundingBox()->width;
-	if (m_mainChar->isUpsideDown())
-		offset.y = m_mainChar->getBoundingBox()->height - offset.y - getBoundingBox()->height;
+	if (!mainChar.isFacingRight())
+		offset.x = -offset.x - EQ_SIZE;
+	if (mainChar.isUpsideDown())
+		offset.y = mainChar.getBoundingBox()->height - offset.y - EQ_SIZE;
 
-	position.x = (mainCharPosition + offset).x;
-	position.y = (mainCharPosition + offset).y;
+	return mainCharPosition + offset;
 }
 
 void LevelEquipment::updateParticlesVisibility() const {
@@ -176,6 +179,17 @@ void LevelEquipment::update(const sf::Time& frameTime) {
 	AnimatedGameObject::update(frameTime);
 }
 
+void LevelEquipment::render(sf::RenderTarget& renderTarget) {
+	// the main character draws the equipment sprites as part of its composed sprite
+	if (m_mainChar->isEquipmentComposed()) {
+		GameObject::render(renderTarget);
+		return;
+	}
+
+	m_animatedSprite.setColor(m_mainChar->getEquipmentColor());
+	AnimatedGameObject::render(renderTarget);
+}
+
 void LevelEquipment::updateAnimation() {
 	GameObjectState newState = m_mainChar->getState();
 	bool newFacingRight = m_mainChar->isFacingRight();
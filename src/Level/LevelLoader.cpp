@@ -96,9 +96,7 @@ void LevelLoader::loadTriggers(LevelData& data, LevelScreen* screen) const {
 	for (auto& it : data.triggers) {
 		if (screen->getCharacterCore()->isTriggerTriggered(it.worldID, it.objectID))
 			continue;
-		Trigger* trigger = new Trigger(screen, it);
-		screen->reloadTrigger(trigger);
-		screen->addObject(trigger);
+		screen->addTrigger(new Trigger(screen, it));
 	}
 }
 
@@ -32,7 +32,7 @@ void LevelMainCharacter::load() {
 	loadAnimation();
 	loadBehavior();
 
-	m_damageNumbers = new DamageNumbers(this->isAlly());
+	m_damageNumbers = dynamic_cast<LevelScreen*>(m_screen)->getDamageNumbers();
 	m_gamepadAimCursor = new GamepadAimCursor(this);
 
 	setGodmode(g_resourceManager->getConfiguration().isGodmode);
@@ -97,6 +97,33 @@ void LevelMainCharacter::update(const sf::Time& frameTime) {
 	handleInteraction();
 }
 
+void LevelMainCharacter::render(sf::RenderTarget& target) {
+	if (!isEquipmentComposed() || !updateComposedSprite()) {
+		LevelMovableGameObject::render(target);
+		return;
+	}
+
+	target.draw(m_composedSprite);
+	GameObject::render(target);
+}
+
+bool LevelMainCharacter::updateComposedSprite() {
+	const Animation* animation = m_equipmentAtlas.getAnimation(m_animatedSprite.getAnimation());
+	if (animation == nullptr) return false;
+	if (animation != m_composedSprite.getAnimation()) {
+		m_composedSprite.setAnimation(animation);
+	}
+	m_composedSprite.setFrame(m_animatedSprite.getCurrentFrame(), false);
+	m_composedSprite.setFlippedX(m_animatedSprite.isFlippedX());
+	m_composedSprite.setFlippedY(m_animatedSprite.isFlippedY());
+
+	// the composed frame covers the equipment frame and flips around its center, like the equipment does
+	sf::Vector2f halfSize(0.5f * LevelEquipment::EQ_SIZE, 0.5f * LevelEquipment::EQ_SIZE);
+	m_composedSprite.setOrigin(halfSize);
+	m_composedSprite.setPosition(LevelEquipment::calculateFramePosition(*this) + halfSize);
+	return true;
+}
+
 void LevelMainCharacter::onHit(Spell* spell) {
 	LevelMovableGameObject::onHit(spell);
 	if (!m_targetManager->getCurrentTargetEnemy()) {
@@ -360,6 +387,24 @@ void LevelMainCharacter::reloadEquipment() {
 	reloadAttributes();
 }
 
+void LevelMainCharacter::bakeEquipment(const std::vector<LevelEquipment*>& equipment) {
+	std::vector<EquipmentAtlasLayer> layers;
+
+	// the main character frames are centered horizontally in the equipment frames
+	const Animation* idleAnimation = getAnimation(GameObjectState::Idle);
+	int frameWidth = idleAnimation != nullptr ? idleAnimation->getFrame(0).width : LevelEquipment::EQ_SIZE;
+	layers.push_back(EquipmentAtlas::createLayer(*this, sf::Vector2i((LevelEquipment::EQ_SIZE - frameWidth) / 2, 0)));
+	for (auto eq : equipment) {
+		layers.push_back(EquipmentAtlas::createLayer(*eq, sf::Vector2i(0, 0)));
+	}
+
+	m_equipmentAtlas.bake(layers, sf::Vector2i(LevelEquipment::EQ_SIZE, LevelEquipment::EQ_SIZE));
+	if (!m_equipmentAtlas.load(m_animations)) {
+		g_logger->logWarning("LevelMainCharacter", "Could not bake the equipment, it is drawn in layers.");
+	}
+	m_composedSprite.setColor(m_equipmentColor);
+}
+
 void LevelMainCharacter::reloadWeapon() {
 	loadWeapon();
 }
@@ -411,10 +456,16 @@ int LevelMainCharacter::getInvisibilityLevel() const {
 }
 
 void LevelMainCharacter::setSpriteColor(const sf::Color& color, const sf::Time& time) {
-	dynamic_cast<LevelScreen*>(m_screen)->setEquipmentColor(color);
+	m_equipmentColor = color;
+	m_composedSprite.setColor(color);
+	m_animatedSprite.setColor(color);
 	m_equipmentColoredTime = time;
 }
 
+const sf::Color& LevelMainCharacter::getEquipmentColor() const {
+	return m_equipmentColor;
+}
+
 void LevelMainCharacter::setDead() {
 	if (m_isDead || m_isImmortal) return;
 	LevelMovableGameObject::setDead();
@@ -600,6 +651,10 @@ bool LevelMainCharacter::isReady() const {
 	return LevelMovableGameObject::isReady() && !m_isInputLock;
 }
 
+bool LevelMainCharacter::isEquipmentComposed() const {
+	return m_equipmentAtlas.isLoaded();
+}
+
 bool LevelMainCharacter::isClimbing() const {
 	return getState() == GameObjectState::Climbing_1 ||
 		getState() == GameObjectState::Climbing_2;
@@ -31,6 +31,7 @@ void LevelMainCharacterLoader::loadEquipment(Screen* screen) {
 	equipmentOrder.push_back(ItemType::Equipment_ring_2);
 	
 	std::vector<std::string> gameData;
+	std::vector<LevelEquipment*> equipment;
 	for (auto& it : equipmentOrder) {
 		if (screen->getCharacterCore()->getEquippedItem(it).empty()) continue;
 		gameData.push_back(screen->getCharacterCore()->getEquippedItem(it));
@@ -52,5 +53,8 @@ void LevelMainCharacterLoader::loadEquipment(Screen* screen) {
 		levelEquipment->load(item.getBean<ItemEquipmentBean>(), item.getType());
 		levelEquipment->loadComponents(item.getBean<ItemEquipmentLightBean>(), item.getBean<ItemEquipmentParticleBean>());
 		screen->addObject(levelEquipment);
+		equipment.push_back(levelEquipment);
 	}
+
+	mainCharacter->bakeEquipment(equipment);
 }
\ No newline at end of file
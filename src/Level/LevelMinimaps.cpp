@@ -0,0 +1,231 @@
+#include "Level/LevelMinimaps.h"
+#include "Structs/WorldData.h"
+#include "FileIO/LevelReader.h"
+#include "FileIO/ResourceFolder.h"
+#include "GUI/MapOverlay.h"
+#include "Logger.h"
+
+#include <fstream>
+#include <sstream>
+
+const std::string LevelMinimaps::MINIMAPS_PATH = "res/level/minimaps.txt";
+
+// FNV-1a
+static const sf::Uint32 CHECKSUM_BASIS = 2166136261u;
+static const sf::Uint32 CHECKSUM_PRIME = 16777619u;
+
+inline void addToChecksum(sf::Uint32& checksum, sf::Uint8 byte) {
+	checksum = (checksum ^ byte) * CHECKSUM_PRIME;
+}
+
+// splits a line at commas
+inline std::vector<std::string> splitLine(const std::string& line) {
+	std::vector<std::string> fields;
+	std::stringstream stream(line);
+	std::string field;
+	while (std::getline(stream, field, ',')) {
+		fields.push_back(field);
+	}
+	return fields;
+}
+
+// parses the unsigned integers from this field on, returns false if one of them is not a number
+inline bool parseUints(const std::vector<std::string>& fields, size_t first, std::vector<sf::Uint32>& values) {
+	values.clear();
+	for (size_t i = first; i < fields.size(); ++i) {
+		char* end = nullptr;
+		unsigned long value = std::strtoul(fields[i].c_str(), &end, 10);
+		if (fields[i].empty() || *end != '\0') return false;
+		values.push_back(static_cast<sf::Uint32>(value));
+	}
+	return true;
+}
+
+bool LevelMinimaps::read(std::istream& stream) {
+	clear();
+	std::string line;
+	std::vector<sf::Uint32> values;
+	int lineNr = 0;
+	while (std::getline(stream, line)) {
+		++lineNr;
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty() || line[0] == '#') continue;
+
+		std::vector<std::string> fields = splitLine(line);
+		if (fields.size() == 7 && fields[0] == "minimap" && parseUints(fields, 3, values)) {
+			LevelMinimap minimap;
+			minimap.imagePath = fields[2];
+			minimap.size = sf::Vector2u(values[0], values[1]);
+			minimap.tilesChecksum = values[2];
+			minimap.imageChecksum = values[3];
+			addMinimap(fields[1], minimap);
+			continue;
+		}
+
+		g_logger->logError("LevelMinimaps", "Invalid line " + std::to_string(lineNr) + " in the minimap table: " + line);
+		clear();
+		return false;
+	}
+	return true;
+}
+
+void LevelMinimaps::write(std::ostream& stream) const {
+	stream << "# written by the minimap baker, do not edit\n";
+	for (auto& it : m_minimaps) {
+		const LevelMinimap& minimap = it.second;
+		stream << "minimap," << it.first << "," << minimap.imagePath << ","
+			<< minimap.size.x << "," << minimap.size.y << ","
+			<< minimap.tilesChecksum << "," << minimap.imageChecksum << "\n";
+	}
+}
+
+bool LevelMinimaps::load(const std::string& filename) {
+	std::ifstream file(filename);
+	if (!file.is_open()) return false;
+	return read(file);
+}
+
+bool LevelMinimaps::save(const std::string& filename) const {
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		g_logger->logError("LevelMinimaps", "Could not write the minimap table to: " + filename);
+		return false;
+	}
+	write(file);
+	return true;
+}
+
+void LevelMinimaps::addMinimap(const std::string& levelID, const LevelMinimap& minimap) {
+	m_minimaps[levelID] = minimap;
+}
+
+void LevelMinimaps::clear() {
+	m_minimaps.clear();
+}
+
+const LevelMinimap* LevelMinimaps::getMinimap(const WorldData& data) const {
+	auto it = m_minimaps.find(data.id);
+	if (it == m_minimaps.end()) return nullptr;
+	if (it->second.tilesChecksum != getTilesChecksum(data)) return nullptr;
+	return &it->second;
+}
+
+bool LevelMinimaps::checkMinimap(const std::string& levelID, const LevelMinimap& minimap) const {
+	auto it = m_minimaps.find(levelID);
+	if (it == m_minimaps.end()) {
+		g_logger->logError("LevelMinimaps", "Not in the minimap table: " + levelID);
+		return false;
+	}
+	const LevelMinimap& baked = it->second;
+	if (baked.imagePath != minimap.imagePath || baked.size != minimap.size ||
+		baked.tilesChecksum != minimap.tilesChecksum || baked.imageChecksum != minimap.imageChecksum) {
+		g_logger->logError("LevelMinimaps", "The minimap has changed: " + levelID);
+		return false;
+	}
+
+	sf::Image image;
+	if (!image.loadFromFile(getResourcePath(baked.imagePath)) || image.getSize() != baked.size ||
+		getChecksum(image.getPixelsPtr(), 4 * baked.size.x * baked.size.y) != baked.imageChecksum) {
+		g_logger->logError("LevelMinimaps", "The baked minimap is missing or does not match the table: " + baked.imagePath);
+		return false;
+	}
+	return true;
+}
+
+const std::map<std::string, LevelMinimap>& LevelMinimaps::getMinimaps() const {
+	return m_minimaps;
+}
+
+bool LevelMinimaps::bake(const std::string& levelID, const CharacterCore* core, LevelMinimap& minimap, std::vector<sf::Uint8>& pixels) {
+	LevelReader reader;
+	LevelData data;
+	data.id = levelID;
+	if (!reader.readWorld(levelID, data, core)) {
+		g_logger->logError("LevelMinimaps", "Could not read the level: " + levelID);
+		return false;
+	}
+	if (data.isBossLevel) {
+		minimap = LevelMinimap();
+		pixels.clear();
+		return true;
+	}
+
+	float scale = MapOverlay::getScale(sf::Vector2f(data.mapSize.x * TILE_SIZE_F, data.mapSize.y * TILE_SIZE_F));
+	minimap.imagePath = getImagePath(levelID);
+	minimap.size = render(data, scale, pixels);
+	minimap.tilesChecksum = getTilesChecksum(data);
+	minimap.imageChecksum = getChecksum(pixels.data(), pixels.size());
+	return true;
+}
+
+std::vector<std::string> LevelMinimaps::getLevelIDs() {
+	return ResourceFolder::findFiles("res/level", ".tmx");
+}
+
+sf::Vector2u LevelMinimaps::getImageSize(const WorldData& data, float scale) {
+	return sf::Vector2u(
+		static_cast<unsigned int>(std::round(data.mapSize.x * TILE_SIZE_F * scale)),
+		static_cast<unsigned int>(std::round(data.mapSize.y * TILE_SIZE_F * scale)));
+}
+
+sf::Vector2u LevelMinimaps::render(const WorldData& data, float scale, std::vector<sf::Uint8>& pixels) {
+	sf::Vector2u size = getImageSize(data, scale);
+	pixels.assign(4 * size.x * size.y, 0);
+	for (size_t i = 0; i < pixels.size(); i += 4) {
+		pixels[i + 0] = COLOR_BLACK.r;
+		pixels[i + 1] = COLOR_BLACK.g;
+		pixels[i + 2] = COLOR_BLACK.b;
+		pixels[i + 3] = COLOR_BLACK.a;
+	}
+
+	// every walkable tile is a rect of pixels, rounded so that the rects of neighbouring tiles don't overlap
+	float pixelSize = TILE_SIZE_F * scale;
+	for (int j = 0; j < data.mapSize.y; ++j) {
+		unsigned int top = static_cast<unsigned int>(std::round(j * pixelSize));
+		unsigned int bottom = std::min(size.y, static_cast<unsigned int>(std::round((j + 1) * pixelSize)));
+		for (int i = 0; i < data.mapSize.x; ++i) {
+			if (data.collidableTilePositions[j][i]) continue;
+			unsigned int left = static_cast<unsigned int>(std::round(i * pixelSize));
+			unsigned int right = std::min(size.x, static_cast<unsigned int>(std::round((i + 1) * pixelSize)));
+			for (unsigned int y = top; y < bottom; ++y) {
+				for (unsigned int x = left; x < right; ++x) {
+					sf::Uint8* pixel = &pixels[4 * (y * size.x + x)];
+					pixel[0] = COLOR_TWILIGHT_INACTIVE.r;
+					pixel[1] = COLOR_TWILIGHT_INACTIVE.g;
+					pixel[2] = COLOR_TWILIGHT_INACTIVE.b;
+					pixel[3] = COLOR_TWILIGHT_INACTIVE.a;
+				}
+			}
+		}
+	}
+
+	return size;
+}
+
+sf::Uint32 LevelMinimaps::getTilesChecksum(const WorldData& data) {
+	sf::Uint32 checksum = CHECKSUM_BASIS;
+	for (int value : { data.mapSize.x, data.mapSize.y }) {
+		for (int shift = 0; shift < 32; shift += 8) {
+			addToChecksum(checksum, static_cast<sf::Uint8>(value >> shift));
+		}
+	}
+	for (int j = 0; j < data.mapSize.y; ++j) {
+		for (int i = 0; i < data.mapSize.x; ++i) {
+			addToChecksum(checksum, data.collidableTilePositions[j][i] ? 1 : 0);
+		}
+	}
+	return checksum;
+}
+
+sf::Uint32 LevelMinimaps::getChecksum(const sf::Uint8* bytes, size_t count) {
+	sf::Uint32 checksum = CHECKSUM_BASIS;
+	for (size_t i = 0; i < count; ++i) {
+		addToChecksum(checksum, bytes[i]);
+	}
+	return checksum;
+}
+
+std::string LevelMinimaps::getImagePath(const std::string& levelID) {
+	if (levelID.size() < 4) return "";
+	return levelID.substr(0, levelID.size() - 4) + "_minimap.png";
+}
\ No newline at end of file
@@ -3,7 +3,8 @@
 #include "Level/Level.h"
 #include "Level/MOBBehavior/MovingBehavior.h"
 #include "Level/MOBBehavior/AttackingBehavior.h"
-#include "Level/DamageNumbers.h"
+
+const sf::Time LevelMovableGameObject::DOT_TICK_TIME = sf::seconds(1.f);
 
 LevelMovableGameObject::LevelMovableGameObject(const Level* level) : MovableGameObject() {
 	m_level = level;
@@ -15,7 +16,6 @@ LevelMovableGameObject::~LevelMovableGameObject() {
 	delete m_spellManager;
 	delete m_movingBehavior;
 	delete m_attackingBehavior;
-	delete m_damageNumbers;
 	delete m_registeredSpellCreators;
 }
 
@@ -39,13 +39,6 @@ void LevelMovableGameObject::update(const sf::Time& frameTime) {
 	setAccelerationX(0.f);
 }
 
-void LevelMovableGameObject::renderAfterForeground(sf::RenderTarget& target) {
-	MovableGameObject::renderAfterForeground(target);
-	if (m_damageNumbers) {
-		m_damageNumbers->render(target);
-	}
-}
-
 void LevelMovableGameObject::updateAttributes(const sf::Time& frameTime) {
 	// update food attributes
 	if (m_foodAttributes.first > sf::Time::Zero) {
@@ -56,38 +49,33 @@ void LevelMovableGameObject::updateAttributes(const sf::Time& frameTime) {
 		}
 	}
 
-	// update buff attributes
-	for (size_t i = 0; i < m_buffAttributes.size();/* don't increment here, we remove on the fly */) {
-		m_buffAttributes[i].first -= frameTime;
-		if (m_buffAttributes[i].first <= sf::Time::Zero) {
-			m_attributes.removeBean(m_buffAttributes[i].second);
-			m_buffAttributes.erase(m_buffAttributes.begin() + i);
-		}
-		else {
-			i++;
-		}
-	}
-
 	// health regeneration
 	updateHealthRegeneration(frameTime);
 
-	// update debuff attributes
-	for (size_t i = 0; i < m_dots.size(); /* don't increment here, we remove on the fly */) {
-		int prevSecond = static_cast<int>(std::floor(m_dots[i].duration.asSeconds()));
-		m_dots[i].duration -= frameTime;
-		int thisSecond = std::max(-1, static_cast<int>(std::floor(m_dots[i].duration.asSeconds())));
-		addDamage(m_dots[i].damage * (prevSecond - thisSecond), m_dots[i].damageType, true, false);
-
-		if (m_isDead) {
-			break;
+	// buffs that run out and dots that tick, in the order they are due
+	if (m_effectScheduler.isEmpty()) return;
+	m_effectScheduler.update(frameTime);
+	StatusEffectEvent event;
+	while (!m_isDead && m_effectScheduler.popDue(event)) {
+		auto buff = m_buffAttributes.find(event.id);
+		if (buff != m_buffAttributes.end()) {
+			m_attributes.removeBean(buff->second);
+			m_buffAttributes.erase(buff);
+			continue;
 		}
 
-		if (m_dots[i].duration <= sf::Time::Zero) {
-			m_dots.erase(m_dots.begin() + i);
+		// the events of cleared dots are skipped
+		auto dot = m_dots.find(event.id);
+		if (dot == m_dots.end()) continue;
+		DamageOverTimeData data = dot->second;
+		if (data.duration <= sf::Time::Zero) {
+			m_dots.erase(dot);
 		}
 		else {
-			i++;
+			dot->second.duration -= DOT_TICK_TIME;
+			m_effectScheduler.schedule(event.id, event.due + DOT_TICK_TIME);
 		}
+		addDamage(data.damage, data.damageType, true, false);
 	}
 }
 
@@ -98,13 +86,15 @@ void LevelMovableGameObject::updateDamageNumbers(const sf::Time& frameTime) {
 	if (m_timeSinceDotNumbers == sf::Time::Zero) {
 		m_timeSinceDotNumbers = sf::seconds(1.f);
 		if (m_currentDotDamage > 0 && !m_isDead) {
-			m_damageNumbers->emitNumber(m_currentDotDamage, 
-				sf::Vector2f(getPosition().x + 0.5f * getSize().x, getPosition().y),
-				DamageNumberType::DamageOverTime, false);
+			emitDamageNumber(m_currentDotDamage, DamageNumberType::DamageOverTime, false);
 			m_currentDotDamage = 0;
 		}
 	}
-	m_damageNumbers->update(frameTime);
+}
+
+void LevelMovableGameObject::emitDamageNumber(int value, DamageNumberType type, bool critical) {
+	if (!m_damageNumbers) return;
+	m_damageNumbers->emitNumber(this, value, sf::Vector2f(getPosition().x + 0.5f * getSize().x, getPosition().y), type, isAlly(), critical);
 }
 
 void LevelMovableGameObject::updateHealthRegeneration(const sf::Time& frameTime) {
@@ -116,17 +106,11 @@ void LevelMovableGameObject::updateHealthRegeneration(const sf::Time& frameTime)
 			m_attributes.currentHealthPoints += m_attributes.healthRegenerationPerS;
 		}
 
-		if (m_damageNumbers) {
-			const sf::Vector2f& pos = getPosition();
-			const sf::Vector2f& size = getSize();
-			sf::Vector2f numberPos = sf::Vector2f(pos.x + 0.5f * size.x, pos.y);
-
-			if (m_attributes.healthRegenerationPerS > 0 && m_damageNumbers) {
-				m_damageNumbers->emitNumber(m_attributes.healthRegenerationPerS, numberPos, DamageNumberType::HealOverTime, false);
-			}
-			else if (m_attributes.healthRegenerationPerS < 0) {
-				m_damageNumbers->emitNumber(std::abs(m_attributes.healthRegenerationPerS), numberPos, DamageNumberType::DamageOverTime, false);
-			}
+		if (m_attributes.healthRegenerationPerS > 0) {
+			emitDamageNumber(m_attributes.healthRegenerationPerS, DamageNumberType::HealOverTime, false);
+		}
+		else if (m_attributes.healthRegenerationPerS < 0) {
+			emitDamageNumber(std::abs(m_attributes.healthRegenerationPerS), DamageNumberType::DamageOverTime, false);
 		}
 
 		if (m_attributes.currentHealthPoints > m_attributes.maxHealthPoints) {
@@ -139,11 +123,6 @@ void LevelMovableGameObject::updateHealthRegeneration(const sf::Time& frameTime)
 	}
 }
 
-void LevelMovableGameObject::addAttributes(const sf::Time& duration, const AttributeData& attributes) {
-	m_attributes.addBean(attributes);
-	m_buffAttributes.push_back(std::pair<sf::Time, AttributeData>(duration, attributes));
-}
-
 void LevelMovableGameObject::calculateUnboundedVelocity(const sf::Time& frameTime, sf::Vector2f& nextVel) const {
 	if (!m_movingBehavior) return;
 	m_movingBehavior->calculateUnboundedVelocity(frameTime, nextVel);
@@ -177,13 +156,13 @@ void LevelMovableGameObject::addDamage(int damage_, DamageType damageType, bool
 		const sf::Vector2f& pos = getPosition();
 		const sf::Vector2f& size = getSize();
 		if (m_isInvincible) {
-			m_damageNumbers->emitString(g_textProvider->getText("Immune"), sf::Vector2f(pos.x + 0.5f * size.x, pos.y), DamageNumberType::DamageOverTime);
+			m_damageNumbers->emitString(this, g_textProvider->getText("Immune"), sf::Vector2f(pos.x + 0.5f * size.x, pos.y), DamageNumberType::DamageOverTime, isAlly());
 			return;
 		}
 		if (overTime) {
 			m_currentDotDamage += damage;
 		} else {
-			m_damageNumbers->emitNumber(damage, sf::Vector2f(pos.x + 0.5f * size.x, pos.y), DamageNumberType::Damage, critical);
+			emitDamageNumber(damage, DamageNumberType::Damage, critical);
 		}
 	}
 
@@ -194,22 +173,31 @@ void LevelMovableGameObject::addDamage(int damage_, DamageType damageType, bool
 	setSpriteColor(COLOR_DAMAGED, sf::milliseconds(400));
 }
 
+void LevelMovableGameObject::addAttributes(const sf::Time& duration, const AttributeData& attributes) {
+	m_attributes.addBean(attributes);
+	int id = m_nextEffectID++;
+	m_buffAttributes.insert({ id, attributes });
+	m_effectScheduler.schedule(id, m_effectScheduler.getTime() + duration);
+}
+
 void LevelMovableGameObject::addDamageOverTime(DamageOverTimeData& data) {
-	if (m_isDead || data.damageType == DamageType::VOID) return;
-	// set the time for the first tick down, the first tick should not
-	// hurt the mob. 
-	data.duration -= sf::milliseconds(1);
-	m_dots.push_back(data);
+	if (m_isDead || data.damageType == DamageType::VOID || data.duration <= sf::Time::Zero) return;
+	// the first tick should not hurt the mob right away, the last one is at the end of the duration
+	// and the ones before a tick time apart. The duration of the stored dot is the time left after its next tick.
+	sf::Int64 ticks = (data.duration.asMicroseconds() + DOT_TICK_TIME.asMicroseconds() - 1) / DOT_TICK_TIME.asMicroseconds();
+	sf::Time firstTick = data.duration - sf::microseconds((ticks - 1) * DOT_TICK_TIME.asMicroseconds());
+
+	int id = m_nextEffectID++;
+	DamageOverTimeData& dot = m_dots[id];
+	dot = data;
+	dot.duration -= firstTick;
+	m_effectScheduler.schedule(id, m_effectScheduler.getTime() + firstTick);
 }
 
 void LevelMovableGameObject::addHeal(int heal, bool overTime, bool critical) {
 	if (m_isDead || heal <= 0) return;
 
-	if (m_damageNumbers) {
-		const sf::Vector2f& pos = getPosition();
-		const sf::Vector2f& size = getSize();
-		m_damageNumbers->emitNumber(heal, sf::Vector2f(pos.x + 0.5f * size.x, pos.y), overTime ? DamageNumberType::HealOverTime : DamageNumberType::Heal, critical);
-	}
+	emitDamageNumber(heal, overTime ? DamageNumberType::HealOverTime : DamageNumberType::Heal, critical);
 
 	m_attributes.currentHealthPoints = std::max(0, std::min(m_attributes.maxHealthPoints, m_attributes.currentHealthPoints + heal));
 	setSpriteColor(COLOR_HEALED, sf::milliseconds(200));
@@ -29,7 +29,15 @@ void AggressiveBehavior::updateAggro() {
 	}
 	if (m_currentTarget || m_enemy->getEnemyState() != EnemyState::Idle) return;
 
-	// search for new target
+	m_currentTarget = findTarget();
+	if (m_currentTarget == nullptr) {
+		m_enemy->setWaiting();
+		return;
+	}
+	m_enemy->setChasing();
+}
+
+LevelMovableGameObject* AggressiveBehavior::searchTarget() const {
 	LevelMovableGameObject* nearest = nullptr;
 	float nearestDistance = 10000.f;
 	if (isInAggroRange(m_mainChar, m_enemy, m_aggroRange)) {
@@ -37,7 +45,6 @@ void AggressiveBehavior::updateAggro() {
 		nearestDistance = dist(m_mainChar->getCenter(), m_enemy->getCenter());
 	}
 
-	// search for new target
 	for (auto& go : *m_enemies) {
 		if (!go->isViewable()) continue;
 		Enemy* enemy = dynamic_cast<Enemy*>(go);
@@ -48,11 +55,6 @@ void AggressiveBehavior::updateAggro() {
 			nearest = enemy;
 		}
 	}
-	if (nearest == nullptr || nearestDistance > m_aggroRange) {
-		m_currentTarget = nullptr;
-		m_enemy->setWaiting();
-		return;
-	}
-	m_currentTarget = nearest;
-	m_enemy->setChasing();
+	if (nearestDistance > m_aggroRange) return nullptr;
+	return nearest;
 }
\ No newline at end of file
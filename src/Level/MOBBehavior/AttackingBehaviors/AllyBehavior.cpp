@@ -45,7 +45,15 @@ void AllyBehavior::updateAggro() {
 	}
 	if (m_currentTarget || m_enemy->getEnemyState() != EnemyState::Idle) return;
 
-	// search for new target
+	m_currentTarget = findTarget();
+	if (m_currentTarget == nullptr) {
+		m_enemy->setWaiting();
+		return;
+	}
+	m_enemy->setChasing();
+}
+
+LevelMovableGameObject* AllyBehavior::searchTarget() const {
 	Enemy* nearest = nullptr;
 	float nearestDistance = 10000.f;
 	for (auto& go : *m_enemies) {
@@ -58,12 +66,7 @@ void AllyBehavior::updateAggro() {
 			nearest = enemy;
 		}
 	}
-	if (nearest == nullptr || nearestDistance > m_aggroRange) {
-		m_currentTarget = nullptr;
-		m_enemy->setWaiting();
-		return;
-	}
-	m_currentTarget = nearest;
-	m_enemy->setChasing();
+	if (nearestDistance > m_aggroRange) return nullptr;
+	return nearest;
 }
 
@@ -11,6 +11,29 @@ EnemyAttackingBehavior::EnemyAttackingBehavior(Enemy* enemy) : AttackingBehavior
 void EnemyAttackingBehavior::update(const sf::Time& frameTime) {
 	AttackingBehavior::update(frameTime);
 	updateAggro();
+	m_hasThought = false;
+}
+
+void EnemyAttackingBehavior::think() {
+	// an enemy with a target only searches if it loses the target during its update, a dead one doesn't search.
+	// the flag is set in every frame, so a target found before the enemy died is never committed.
+	m_hasThought = m_currentTarget == nullptr && !m_enemy->isDead();
+	m_thoughtTarget = m_hasThought ? searchTarget() : nullptr;
+}
+
+LevelMovableGameObject* EnemyAttackingBehavior::searchTarget() const {
+	return nullptr;
+}
+
+LevelMovableGameObject* EnemyAttackingBehavior::findTarget() {
+	if (m_hasThought) {
+		m_hasThought = false;
+		// an enemy updated before this one in the same frame may have killed the target
+		if (m_thoughtTarget == nullptr || !m_thoughtTarget->isDead()) {
+			return m_thoughtTarget;
+		}
+	}
+	return searchTarget();
 }
 
 float EnemyAttackingBehavior::getAggroRange() const {
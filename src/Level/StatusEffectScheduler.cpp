@@ -0,0 +1,106 @@
+#include "Level/StatusEffectScheduler.h"
+
+const int StatusEffectScheduler::WHEEL_SIZE = 64;
+const sf::Time StatusEffectScheduler::SLOT_TIME = sf::milliseconds(50);
+
+static bool isLater(const StatusEffectEvent& a, const StatusEffectEvent& b) {
+	if (a.due != b.due) return a.due > b.due;
+	return a.sequence > b.sequence;
+}
+
+StatusEffectScheduler::StatusEffectScheduler() {
+	m_buckets = std::vector<std::vector<StatusEffectEvent>>(WHEEL_SIZE);
+}
+
+void StatusEffectScheduler::schedule(int id, const sf::Time& due) {
+	StatusEffectEvent event;
+	event.id = id;
+	event.due = due;
+	event.sequence = m_sequence++;
+	m_eventCount++;
+
+	if (due <= m_time) {
+		insertDue(event);
+		return;
+	}
+	sf::Int64 slot = getSlot(due);
+	if (slot / WHEEL_SIZE > getSlot(m_time) / WHEEL_SIZE) {
+		m_overflow.push_back(event);
+		return;
+	}
+	m_buckets[slot % WHEEL_SIZE].push_back(event);
+}
+
+void StatusEffectScheduler::update(const sf::Time& frameTime) {
+	m_touchedCount = 0;
+	sf::Int64 firstSlot = getSlot(m_time);
+	m_time += frameTime;
+	if (m_eventCount == static_cast<int>(m_due.size())) return;
+
+	// the slot of the last update is looked at again, events may have been scheduled into it after that update
+	for (sf::Int64 slot = firstSlot; slot <= getSlot(m_time); ++slot) {
+		if (slot / WHEEL_SIZE != m_turn) {
+			beginTurn(slot / WHEEL_SIZE);
+		}
+		std::vector<StatusEffectEvent>& bucket = m_buckets[slot % WHEEL_SIZE];
+		m_touchedCount += static_cast<int>(bucket.size());
+		for (size_t i = 0; i < bucket.size(); /* don't increment here, we remove on the fly */) {
+			if (bucket[i].due <= m_time) {
+				insertDue(bucket[i]);
+				bucket[i] = bucket.back();
+				bucket.pop_back();
+			}
+			else {
+				i++;
+			}
+		}
+	}
+}
+
+void StatusEffectScheduler::beginTurn(sf::Int64 turn) {
+	m_turn = turn;
+	m_touchedCount += static_cast<int>(m_overflow.size());
+	for (size_t i = 0; i < m_overflow.size(); /* don't increment here, we remove on the fly */) {
+		sf::Int64 slot = getSlot(m_overflow[i].due);
+		if (slot / WHEEL_SIZE <= turn) {
+			m_buckets[slot % WHEEL_SIZE].push_back(m_overflow[i]);
+			m_overflow[i] = m_overflow.back();
+			m_overflow.pop_back();
+		}
+		else {
+			i++;
+		}
+	}
+}
+
+bool StatusEffectScheduler::popDue(StatusEffectEvent& event) {
+	if (m_due.empty()) return false;
+	event = m_due.back();
+	m_due.pop_back();
+	m_eventCount--;
+	return true;
+}
+
+void StatusEffectScheduler::insertDue(const StatusEffectEvent& event) {
+	m_due.insert(std::upper_bound(m_due.begin(), m_due.end(), event, isLater), event);
+}
+
+sf::Int64 StatusEffectScheduler::getSlot(const sf::Time& time) const {
+	return time.asMicroseconds() / SLOT_TIME.asMicroseconds();
+}
+
+const sf::Time& StatusEffectScheduler::getTime() const {
+	return m_time;
+}
+
+bool StatusEffectScheduler::isEmpty() const {
+	return m_eventCount == 0;
+}
+
+int StatusEffectScheduler::getEventCount() const {
+	return m_eventCount;
+}
+
+int StatusEffectScheduler::getTouchedCount() const {
+	return m_touchedCount;
+}
\ No newline at end of file
@@ -1,44 +1,97 @@
 #include "Logger.h"
 
+#include <cstdio>
+#include <cstring>
+
 Logger* g_logger;
 
-Logger::Logger() {
-	m_logLevel = LogLevel::Warning;
+const std::size_t Logger::BUFFER_SIZE;
+const std::size_t Logger::MAX_SOURCE_LENGTH;
+const std::size_t Logger::MAX_MESSAGE_LENGTH;
+const int Logger::MAX_REPEATS;
+const sf::Time Logger::RATE_LIMIT_INTERVAL = sf::seconds(1.f);
+
+// the buffer size must be a power of two, positions are mapped to slots with a mask
+static_assert((Logger::BUFFER_SIZE & (Logger::BUFFER_SIZE - 1)) == 0, "Logger::BUFFER_SIZE must be a power of two");
+
+Logger::Logger() :
+	m_logLevel(LogLevel::Warning),
+	m_maxLogLevel(LogLevel::Warning),
+	m_buffer(new Entry[BUFFER_SIZE]),
+	m_enqueuePos(0),
+	m_droppedCount(0),
+	m_writtenPos(0),
+	m_isRunning(true),
+	m_isWaiting(false) {
+	for (std::size_t i = 0; i < BUFFER_SIZE; ++i) {
+		m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+	}
+	m_thread = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger() {
+	{
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_isRunning = false;
+	}
+	m_wakeCondition.notify_one();
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
 }
 
 void Logger::log(LogLevel level, const std::string& source, const std::string& message) const {
-	if (level <= m_logLevel && level != LogLevel::None) {
-		std::string levelString;
-		std::string color;
-		switch (level) {
-		case LogLevel::Debug:
-			levelString = "[DEBUG]";
-			color = GREEN;
-			break;
-		case LogLevel::Info:
-			levelString = "[INFO]";
-			color = DEFAULT;
-			break;
-		case LogLevel::Warning:
-			levelString = "[WARNING]";
-			color = YELLOW;
-			break;
-		case LogLevel::Error:
-			levelString = "[ERROR]";
-			color = RED;
-			break;
-		case LogLevel::Verbose:
-			levelString = "[VERBOSE]";
-			color = BLUE;
-			break;
-		default:
-			return;
+	if (level == LogLevel::None || level > m_maxLogLevel.load(std::memory_order_relaxed)) return;
+
+	// claim a slot. A slot is free if its sequence equals the position, it holds a message if it equals position + 1.
+	std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+	Entry* entry;
+	while (true) {
+		entry = &m_buffer[pos & (BUFFER_SIZE - 1)];
+		std::size_t sequence = entry->sequence.load(std::memory_order_acquire);
+		std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+		if (diff == 0) {
+			if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+		}
+		else if (diff < 0) {
+			// the writer is behind. Errors wait for a free slot, other messages never block the caller.
+			wakeWriter();
+			if (level != LogLevel::Error) {
+				m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			std::this_thread::yield();
+			pos = m_enqueuePos.load(std::memory_order_relaxed);
 		}
+		else {
+			pos = m_enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	std::size_t sourceLength = std::min(source.size(), MAX_SOURCE_LENGTH);
+	std::memcpy(entry->source, source.data(), sourceLength);
+	entry->source[sourceLength] = '\0';
+	std::size_t messageLength = std::min(message.size(), MAX_MESSAGE_LENGTH);
+	std::memcpy(entry->message, message.data(), messageLength);
+	entry->message[messageLength] = '\0';
+	entry->level = level;
 
-		std::cout << color << levelString << "-[" << source << "]: " << message << DEFAULT << std::endl;
+	// sequentially consistent, so either the writer sees the message or we see that it waits
+	entry->sequence.store(pos + 1);
+	wakeWriter();
+
+	// errors are written before the caller goes on, so they are not lost if the game crashes or exits right after
+	if (level == LogLevel::Error) {
+		waitUntilWritten(pos + 1);
 	}
 }
 
+void Logger::wakeWriter() const {
+	if (!m_isWaiting) return;
+	std::lock_guard<std::mutex> lock(m_wakeMutex);
+	m_wakeCondition.notify_one();
+}
+
 void Logger::logError(const std::string& source, const std::string& message) const {
 	log(LogLevel::Error, source, message);
 }
@@ -52,10 +105,242 @@ void Logger::logInfo(const std::string& source, const std::string& message) cons
 }
 
 void Logger::setLogLevel(LogLevel level) {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_logLevel = level;
+	updateMaxLogLevel();
 }
 
 LogLevel Logger::getLogLevel() const {
 	return m_logLevel;
 }
 
+void Logger::setChannelLogLevel(const std::string& source, LogLevel level) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_channelLogLevels[source.substr(0, MAX_SOURCE_LENGTH)] = level;
+	updateMaxLogLevel();
+}
+
+void Logger::clearChannelLogLevels() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_channelLogLevels.clear();
+	updateMaxLogLevel();
+}
+
+void Logger::updateMaxLogLevel() {
+	LogLevel maxLevel = m_logLevel;
+	for (auto& it : m_channelLogLevels) {
+		maxLevel = std::max(maxLevel, it.second);
+	}
+	m_maxLogLevel = maxLevel;
+}
+
+void Logger::setLogFile(const std::string& path, std::size_t maxSize) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_logFile.is_open()) {
+		m_logFile.close();
+	}
+	m_logFilePath = path;
+	m_maxLogFileSize = maxSize;
+	m_logFileSize = 0;
+	if (path.empty()) return;
+
+	m_logFile.open(path, std::ios::out | std::ios::trunc);
+	if (!m_logFile.is_open()) {
+		m_logFilePath.clear();
+		std::cout << RED << "[ERROR]-[Logger]: Unable to open log file " << path << DEFAULT << "\n";
+	}
+}
+
+void Logger::flush() const {
+	waitUntilWritten(m_enqueuePos.load());
+}
+
+void Logger::waitUntilWritten(std::size_t pos) const {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_flushCondition.wait(lock, [this, pos] { return !m_isRunning || m_writtenPos.load() >= pos; });
+}
+
+void Logger::run() {
+	while (true) {
+		// read the flag before draining, so nothing logged before the destructor call is lost.
+		bool isRunning = m_isRunning;
+		drain();
+		flushRepeats(!isRunning);
+		if (!isRunning) break;
+		waitForMessages();
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_flushCondition.notify_all();
+}
+
+void Logger::waitForMessages() {
+	std::unique_lock<std::mutex> lock(m_wakeMutex);
+	m_isWaiting = true;
+	auto isWoken = [this] {
+		return !m_isRunning || m_droppedCount.load() > 0 ||
+			m_buffer[m_dequeuePos & (BUFFER_SIZE - 1)].sequence.load() == m_dequeuePos + 1;
+	};
+	if (m_repeats.empty()) {
+		m_wakeCondition.wait(lock, isWoken);
+	}
+	else {
+		// wake up in time to report the suppressed repeats
+		m_wakeCondition.wait_for(lock, std::chrono::milliseconds(RATE_LIMIT_INTERVAL.asMilliseconds()), isWoken);
+	}
+	m_isWaiting = false;
+}
+
+void Logger::drain() {
+	bool hasWritten = false;
+	while (true) {
+		Entry& entry = m_buffer[m_dequeuePos & (BUFFER_SIZE - 1)];
+		if (entry.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) break;
+
+		LogLevel level = entry.level;
+		std::string source(entry.source);
+		std::string message(entry.message);
+		entry.sequence.store(m_dequeuePos + BUFFER_SIZE, std::memory_order_release);
+		++m_dequeuePos;
+
+		write(level, source, message);
+		hasWritten = true;
+	}
+
+	std::size_t dropped = m_droppedCount.exchange(0);
+	if (dropped > 0) {
+		writeLine(LogLevel::Warning, "[WARNING]-[Logger]: " + std::to_string(dropped) + " messages were dropped, the log buffer was full.");
+		hasWritten = true;
+	}
+
+	if (hasWritten) {
+		std::cout.flush();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_logFile.is_open()) {
+			m_logFile.flush();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_writtenPos = m_dequeuePos;
+	}
+	m_flushCondition.notify_all();
+}
+
+void Logger::write(LogLevel level, const std::string& source, const std::string& message) {
+	if (!isEnabled(level, source)) return;
+	if (level != LogLevel::Error && !checkRateLimit(source, message)) return;
+
+	std::string levelString;
+	switch (level) {
+	case LogLevel::Debug:
+		levelString = "[DEBUG]";
+		break;
+	case LogLevel::Info:
+		levelString = "[INFO]";
+		break;
+	case LogLevel::Warning:
+		levelString = "[WARNING]";
+		break;
+	case LogLevel::Error:
+		levelString = "[ERROR]";
+		break;
+	case LogLevel::Verbose:
+		levelString = "[VERBOSE]";
+		break;
+	default:
+		return;
+	}
+
+	writeLine(level, levelString + "-[" + source + "]: " + message);
+}
+
+void Logger::writeLine(LogLevel level, const std::string& line) {
+	std::string color;
+	switch (level) {
+	case LogLevel::Debug:
+		color = GREEN;
+		break;
+	case LogLevel::Warning:
+		color = YELLOW;
+		break;
+	case LogLevel::Error:
+		color = RED;
+		break;
+	case LogLevel::Verbose:
+		color = BLUE;
+		break;
+	default:
+		color = DEFAULT;
+		break;
+	}
+
+	std::cout << color << line << DEFAULT << "\n";
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_logFile.is_open()) return;
+	m_logFile << line << "\n";
+	m_logFileSize += line.size() + 1;
+	if (m_maxLogFileSize > 0 && m_logFileSize > m_maxLogFileSize) {
+		rotateLogFile();
+	}
+}
+
+void Logger::rotateLogFile() {
+	m_logFile.close();
+	std::string backupPath = m_logFilePath + ".1";
+	std::remove(backupPath.c_str());
+	std::rename(m_logFilePath.c_str(), backupPath.c_str());
+	m_logFile.open(m_logFilePath, std::ios::out | std::ios::trunc);
+	m_logFileSize = 0;
+}
+
+bool Logger::isEnabled(LogLevel level, const std::string& source) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_channelLogLevels.find(source);
+	LogLevel channelLevel = it != m_channelLogLevels.end() ? it->second : m_logLevel.load();
+	return level <= channelLevel;
+}
+
+bool Logger::checkRateLimit(const std::string& source, const std::string& message) {
+	std::string key = source + "\n" + message;
+	sf::Time now = m_clock.getElapsedTime();
+
+	auto it = m_repeats.find(key);
+	if (it == m_repeats.end()) {
+		RepeatInfo info;
+		info.count = 1;
+		info.intervalStart = now;
+		m_repeats.insert({ key, info });
+		return true;
+	}
+
+	RepeatInfo& info = it->second;
+	info.count++;
+	return info.count <= MAX_REPEATS;
+}
+
+void Logger::flushRepeats(bool force) {
+	sf::Time now = m_clock.getElapsedTime();
+	bool hasWritten = false;
+	for (auto it = m_repeats.begin(); it != m_repeats.end(); /* don't increment here */) {
+		if (!force && now - it->second.intervalStart < RATE_LIMIT_INTERVAL) {
+			++it;
+			continue;
+		}
+
+		int suppressed = it->second.count - MAX_REPEATS;
+		if (suppressed > 0) {
+			std::size_t separator = it->first.find('\n');
+			writeLine(LogLevel::Warning, "[WARNING]-[" + it->first.substr(0, separator) + "]: the message \"" +
+				it->first.substr(separator + 1) + "\" was suppressed " + std::to_string(suppressed) + " times.");
+			hasWritten = true;
+		}
+		it = m_repeats.erase(it);
+	}
+
+	if (hasWritten) {
+		std::cout.flush();
+	}
+}
\ No newline at end of file
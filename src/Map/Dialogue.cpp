@@ -5,19 +5,50 @@
 #include "Map/NPC.h"
 
 void Dialogue::reload(const std::string& id, WorldScreen* screen, DialogueWindow* window) {
-	m_id = id;
+	reset(id, window->getNPC()->getNPCData().textType);
 	m_screen = screen;
 	m_window = window;
-	m_nodes.clear();
-	m_currentNode = nullptr;
 
-	DialogueLoader loader(*this, screen);
-	loader.loadDialogue();
+	// the script only runs if the game state changed in a way it asked about
+	DialogueGraphCache& cache = screen->getDialogueCache();
+	Language language = g_resourceManager->getConfiguration().language;
+	WorldCallback callback(screen);
+	const DialogueGraph* graph = cache.findGraph(id, getTextType(), language, [&callback](const DialogueQuery& query) {
+		return DialogueLoader::isUnchanged(query, callback);
+	});
+
+	if (graph != nullptr) {
+		m_nodes = graph->nodes;
+		setRoot(graph->root);
+	}
+	else {
+		DialogueLoader loader(*this, screen);
+		loader.loadDialogue();
+		if (loader.isCacheable()) {
+			DialogueGraph newGraph;
+			newGraph.textType = getTextType();
+			newGraph.language = language;
+			newGraph.queries = loader.getQueries();
+			newGraph.nodes = m_nodes;
+			newGraph.root = loader.getRoot();
+			cache.addGraph(id, newGraph);
+		}
+	}
+
 	if (m_currentNode == nullptr) {
 		g_logger->logError("Dialogue", "No node in current dialogue, root is not set.");
 	}
 }
 
+void Dialogue::reset(const std::string& id, const std::string& textType) {
+	m_id = id;
+	m_textType = textType;
+	m_screen = nullptr;
+	m_window = nullptr;
+	m_nodes.clear();
+	m_currentNode = nullptr;
+}
+
 void Dialogue::addNode(int tag, const DialogueNode& node) {
 	if (hasNode(tag)) {
 		g_logger->logWarning("Dialogue", "Node with tag [" + std::to_string(tag) + "] already exists in the dialogoue tree.");
@@ -31,7 +62,7 @@ const std::string& Dialogue::getID() const {
 }
 
 const std::string& Dialogue::getTextType() const {
-	return m_window->getNPC()->getNPCData().textType;
+	return m_textType;
 }
 
 bool Dialogue::updateWindow() {
@@ -64,6 +95,10 @@ bool Dialogue::hasNode(int tag) const {
 	return contains(m_nodes, tag);
 }
 
+const std::map<int, DialogueNode>& Dialogue::getNodes() const {
+	return m_nodes;
+}
+
 bool Dialogue::isTradeNode(int nodeTag) const {
 	if (!hasNode(nodeTag)) return false;
 	const DialogueNode* nextNode = &m_nodes.at(nodeTag);
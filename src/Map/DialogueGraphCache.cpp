@@ -0,0 +1,44 @@
+#include "Map/DialogueGraphCache.h"
+
+// a dialogue seldom has more than a few states in a row (before, during and after a quest)
+const int DialogueGraphCache::MAX_GRAPHS = 4;
+
+const DialogueGraph* DialogueGraphCache::findGraph(const std::string& dialogueID, const std::string& textType, Language language, const DialogueQueryCheck& check) const {
+	auto it = m_graphs.find(dialogueID);
+	if (it == m_graphs.end()) return nullptr;
+
+	// the newest graph is the most likely to be valid
+	for (auto graph = it->second.rbegin(); graph != it->second.rend(); ++graph) {
+		if (graph->textType != textType || graph->language != language) continue;
+
+		bool isValid = true;
+		for (auto& query : graph->queries) {
+			if (!check(query)) {
+				isValid = false;
+				break;
+			}
+		}
+		if (isValid) return &(*graph);
+	}
+	return nullptr;
+}
+
+void DialogueGraphCache::addGraph(const std::string& dialogueID, const DialogueGraph& graph) {
+	std::vector<DialogueGraph>& graphs = m_graphs[dialogueID];
+	if (static_cast<int>(graphs.size()) >= MAX_GRAPHS) {
+		graphs.erase(graphs.begin());
+	}
+	graphs.push_back(graph);
+}
+
+void DialogueGraphCache::clear() {
+	m_graphs.clear();
+}
+
+int DialogueGraphCache::getGraphCount() const {
+	int count = 0;
+	for (auto& it : m_graphs) {
+		count += static_cast<int>(it.second.size());
+	}
+	return count;
+}
\ No newline at end of file
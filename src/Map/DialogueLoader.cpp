@@ -8,6 +8,10 @@ DialogueLoader::DialogueLoader(Dialogue& dialogue, WorldScreen* screen) : m_dial
 	m_worldCallback = new WorldCallback(screen);
 }
 
+DialogueLoader::DialogueLoader(Dialogue& dialogue, CharacterCore* core) : m_dialogue(dialogue) {
+	m_worldCallback = new WorldCallback(core);
+}
+
 DialogueLoader::~DialogueLoader() {
 	delete m_currentNode;
 	delete m_worldCallback;
@@ -63,6 +67,9 @@ void DialogueLoader::loadDialogue() {
 		.addFunction("addNode", &DialogueLoader::addNode)
 		.endClass();
 
+	// a script using random numbers builds different nodes for the same game state, so it is marked as not cacheable
+	luaL_dostring(L, "local random = math.random math.random = function(...) isRandomDialogue = true return random(...) end");
+
 	if (luaL_dofile(L, getResourcePath(m_dialogue.getID()).c_str()) != 0) {
 		g_logger->logError("DialogeLoader", "Cannot read lua script: " + getResourcePath(m_dialogue.getID()));
 		return;
@@ -76,6 +83,7 @@ void DialogueLoader::loadDialogue() {
 
 	try {
 		function(this);
+		m_isCacheable = getGlobal(L, "isRandomDialogue").isNil();
 	}
 	catch (LuaException const& e) {
 		g_logger->logError("DialogeLoader", "LuaException: " + std::string(e.what()));
@@ -84,6 +92,124 @@ void DialogueLoader::loadDialogue() {
 	m_dialogue.setRoot(m_root);
 }
 
+const DialogueQuery& DialogueLoader::ask(DialogueQueryType type, const std::string& first, const std::string& second, int number) {
+	DialogueQuery query;
+	query.type = type;
+	query.first = first;
+	query.second = second;
+	query.number = number;
+	answer(query, *m_worldCallback);
+	m_queries.push_back(query);
+	return m_queries.back();
+}
+
+void DialogueLoader::answer(DialogueQuery& query, const WorldCallback& callback) {
+	switch (query.type) {
+	case DialogueQueryType::QuestState:
+		query.value = callback.isQuestState(query.first, query.second);
+		break;
+	case DialogueQueryType::QuestComplete:
+		query.value = callback.isQuestComplete(query.first);
+		break;
+	case DialogueQueryType::Condition:
+		query.value = callback.isConditionFulfilled(query.first, query.second);
+		break;
+	case DialogueQueryType::QuestCondition:
+		query.value = callback.isQuestConditionFulfilled(query.first, query.second);
+		break;
+	case DialogueQueryType::QuestDescription:
+		query.value = callback.isQuestDescriptionUnlocked(query.first, query.number);
+		break;
+	case DialogueQueryType::SpellLearned:
+		query.value = callback.isSpellLearned(query.number);
+		break;
+	case DialogueQueryType::SpellEquipped:
+		query.value = callback.isSpellEquipped(query.number);
+		break;
+	case DialogueQueryType::HasItem:
+		query.value = callback.hasItem(query.first, query.number);
+		break;
+	case DialogueQueryType::ItemEquipped:
+		query.value = callback.isItemEquipped(query.first);
+		break;
+	case DialogueQueryType::ItemAmount:
+		query.value = callback.getItemAmount(query.first);
+		break;
+	case DialogueQueryType::Reputation:
+		query.value = callback.getReputation(query.first);
+		break;
+	case DialogueQueryType::Guild:
+		query.text = callback.getGuild();
+		break;
+	}
+}
+
+bool DialogueLoader::isUnchanged(const DialogueQuery& query, const WorldCallback& callback) {
+	DialogueQuery current = query;
+	answer(current, callback);
+	return current.value == query.value && current.text == query.text;
+}
+
+bool DialogueLoader::isQuestState(const std::string& questID, const std::string& state) {
+	return ask(DialogueQueryType::QuestState, questID, state).value != 0;
+}
+
+bool DialogueLoader::isQuestComplete(const std::string& questID) {
+	return ask(DialogueQueryType::QuestComplete, questID).value != 0;
+}
+
+bool DialogueLoader::isConditionFulfilled(const std::string& conditionType, const std::string& condition) {
+	return ask(DialogueQueryType::Condition, conditionType, condition).value != 0;
+}
+
+bool DialogueLoader::isQuestConditionFulfilled(const std::string& quest, const std::string& condition) {
+	return ask(DialogueQueryType::QuestCondition, quest, condition).value != 0;
+}
+
+bool DialogueLoader::isQuestDescriptionUnlocked(const std::string& quest, int description) {
+	return ask(DialogueQueryType::QuestDescription, quest, "", description).value != 0;
+}
+
+bool DialogueLoader::isSpellLearned(int spellID) {
+	return ask(DialogueQueryType::SpellLearned, "", "", spellID).value != 0;
+}
+
+bool DialogueLoader::isSpellEquipped(int spellID) {
+	return ask(DialogueQueryType::SpellEquipped, "", "", spellID).value != 0;
+}
+
+bool DialogueLoader::hasItem(const std::string& item, int amount) {
+	return ask(DialogueQueryType::HasItem, item, "", amount).value != 0;
+}
+
+bool DialogueLoader::isItemEquipped(const std::string& item) {
+	return ask(DialogueQueryType::ItemEquipped, item).value != 0;
+}
+
+int DialogueLoader::getItemAmount(const std::string& item) {
+	return ask(DialogueQueryType::ItemAmount, item).value;
+}
+
+int DialogueLoader::getReputation(const std::string& fractionID) {
+	return ask(DialogueQueryType::Reputation, fractionID).value;
+}
+
+std::string DialogueLoader::getGuild() {
+	return ask(DialogueQueryType::Guild, "").text;
+}
+
+const std::vector<DialogueQuery>& DialogueLoader::getQueries() const {
+	return m_queries;
+}
+
+int DialogueLoader::getRoot() const {
+	return m_root;
+}
+
+bool DialogueLoader::isCacheable() const {
+	return m_isCacheable;
+}
+
 void DialogueLoader::addChoice(int nextTag, const std::string& text) {
 	if (m_currentNode == nullptr || m_currentNode->type != DialogueNodeType::Choice) {
 		g_logger->logError("DialogueLoader", "Cannot add choice: No choice node created.");
@@ -16,14 +16,14 @@ DoorMapTile::DoorMapTile(MapScreen* mapScreen) : MapDynamicTile(mapScreen) {
 
 void DoorMapTile::open() {
 	m_isOpen = true;
-	m_isCollidable = false;
+	setCollidable(false);
 	setState(GameObjectState::Open);
 	m_interactComponent->setInteractable(false);
 }
 
 void DoorMapTile::close() {
 	m_isOpen = false;
-	m_isCollidable = true;
+	setCollidable(true);
 	setState(GameObjectState::Closed);
 	m_interactComponent->setInteractable(true);
 }
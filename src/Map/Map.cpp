@@ -1,6 +1,7 @@
 #include "Map/Map.h"
 #include "Screens/MapScreen.h"
 #include "Map/MapDynamicTile.h"
+#include "World/LoadingPipeline.h"
 
 Map::Map() : World() {
 	m_worldData = &m_mapData;
@@ -11,24 +12,37 @@ Map::~Map() {
 
 bool Map::load(const std::string& id, WorldScreen* screen) {
 	m_screen = screen;
-	MapReader reader;
 	m_mapData.id = id;
-	if (!reader.readWorld(id.c_str(), m_mapData, m_screen->getCharacterCore())) {
-		return false;
-	}
 
-	// adjust weather
-	if (const WeatherData* weather = m_screen->getCharacterCore()->getWeather(id)) {
-		m_mapData.weather = *weather;
-	}
+	LoadingPipeline pipeline("Map " + id);
+	int readStage = pipeline.addStage("read map", [this, &id]() {
+		MapReader reader;
+		if (!reader.readWorld(id.c_str(), m_mapData, m_screen->getCharacterCore())) {
+			return false;
+		}
 
-	// load map
-	m_backgroundTileMap.load(m_mapData, m_mapData.backgroundTileLayers);
-	m_lightedForegroundTileMap.load(m_mapData, m_mapData.lightedForegroundTileLayers);
-	m_foregroundTileMap.load(m_mapData, m_mapData.foregroundTileLayers);
-	g_resourceManager->loadMapResources();
+		// adjust weather
+		if (const WeatherData* weather = m_screen->getCharacterCore()->getWeather(id)) {
+			m_mapData.weather = *weather;
+		}
+		return true;
+	});
 
-	return true;
+	// load map
+	addTileMapStages(pipeline, m_mapData, readStage);
+
+	int decodeStage = pipeline.addStage("decode map resources", []() {
+		g_resourceManager->decodeMapResources();
+		return true;
+	});
+	pipeline.addStage("upload map resources", []() {
+		g_resourceManager->loadMapResources();
+		return true;
+	}, { decodeStage }, true);
+
+	bool isLoaded = pipeline.run(LoadingPipeline::getWorkerCount());
+	pipeline.logTimes();
+	return isLoaded;
 }
 
 void Map::dispose() {
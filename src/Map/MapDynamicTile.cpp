@@ -11,6 +11,15 @@ bool MapDynamicTile::isCollidable() const {
 	return m_isCollidable;
 }
 
+void MapDynamicTile::setCollidable(bool isCollidable) {
+	if (m_isCollidable == isCollidable) return;
+	m_isCollidable = isCollidable;
+
+	if (MapScreen* mapScreen = dynamic_cast<MapScreen*>(m_screen)) {
+		mapScreen->getPathFinder()->notifyCollidableChanged(*getBoundingBox(), m_isCollidable);
+	}
+}
+
 void MapDynamicTile::setPositionOffset(const sf::Vector2f& offset) {
 	m_positionOffset = offset;
 }
@@ -38,9 +38,7 @@ void MapLoader::loadTriggers(MapData& data, MapScreen* screen) {
 	for (auto& it : data.triggers) {
 		if (screen->getCharacterCore()->isTriggerTriggered(it.worldID, it.objectID))
 			continue;
-		Trigger* trigger = new Trigger(screen, it);
-		screen->reloadTrigger(trigger);
-		screen->addObject(trigger);
+		screen->addTrigger(new Trigger(screen, it));
 	}
 }
 
@@ -1,13 +1,15 @@
 #include "Map/NPCRoutine.h"
 #include "FileIO/NPCRoutineLoader.h"
 #include "Map/NPC.h"
-#include "Screens/WorldScreen.h"
+#include "Screens/MapScreen.h"
 
 void NPCRoutine::load(const std::string& id, NPC* npc, bool initial) {
 	m_id = id;
 	m_npc = npc;
 	m_steps.clear();
 	m_currentStepID = 0;
+	m_isRouteValid = false;
+	m_isPathPending = false;
 
 	NPCRoutineLoader loader(*this, dynamic_cast<WorldScreen*>(m_npc->getScreen()));
 	loader.loadRoutine(initial);
@@ -73,34 +75,9 @@ void NPCRoutine::update(const sf::Time& frameTime) {
 		}
 	}
 	else if (currentStep.state == RoutineState::GoingTo) {
-		sf::Vector2f distance = currentStep.goal - m_npc->getPosition();
-		if (norm(distance) < 1.f) {
+		if (updateGoingTo(currentStep.goal, frameTime)) {
 			updateStep = true;
 		}
-		else {
-			sf::Vector2f newVel(0.f, 0.f);
-			if (std::abs(distance.x) > 1.f) {
-				newVel.x = (distance.x > 0.f) ? m_velocity : -m_velocity;
-			}
-			else if (std::abs(distance.y) > 1.f) {
-				newVel.y = (distance.y > 0.f) ? m_velocity : -m_velocity;
-			}
-			else {
-				newVel.x = (distance.x > 0.f) ? m_velocity : -m_velocity;
-				newVel.y = (distance.y > 0.f) ? m_velocity : -m_velocity;
-			}
-			
-			sf::Vector2f newPos = m_npc->getPosition() + frameTime.asSeconds() * newVel;
-			sf::Vector2f newDistance = currentStep.goal - newPos;
-
-			if (norm(distance) <= norm(newDistance)) {
-				m_npc->setPosition(currentStep.goal);
-				m_npc->setVelocity(sf::Vector2f(0.f, 0.f));
-			}
-			else {
-				m_npc->setVelocity(newVel);
-			}
-		}
 	}
 
 	if (updateStep) {
@@ -121,6 +98,113 @@ void NPCRoutine::update(const sf::Time& frameTime) {
 	}
 }
 
+bool NPCRoutine::updateGoingTo(const sf::Vector2f& goal, const sf::Time& frameTime) {
+	if (!updateRoute(goal)) {
+		m_npc->setVelocity(sf::Vector2f(0.f, 0.f));
+		return false;
+	}
+
+	const sf::Vector2f& target = m_waypoints[m_currentWaypoint];
+	sf::Vector2f distance = target - m_npc->getPosition();
+	if (norm(distance) < 1.f) {
+		if (m_currentWaypoint >= static_cast<int>(m_waypoints.size()) - 1) {
+			m_isRouteValid = false;
+			return true;
+		}
+		m_currentWaypoint++;
+		return false;
+	}
+
+	sf::Vector2f newVel(0.f, 0.f);
+	if (std::abs(distance.x) > 1.f) {
+		newVel.x = (distance.x > 0.f) ? m_velocity : -m_velocity;
+	}
+	else if (std::abs(distance.y) > 1.f) {
+		newVel.y = (distance.y > 0.f) ? m_velocity : -m_velocity;
+	}
+	else {
+		newVel.x = (distance.x > 0.f) ? m_velocity : -m_velocity;
+		newVel.y = (distance.y > 0.f) ? m_velocity : -m_velocity;
+	}
+
+	sf::Vector2f newPos = m_npc->getPosition() + frameTime.asSeconds() * newVel;
+	sf::Vector2f newDistance = target - newPos;
+
+	if (norm(distance) <= norm(newDistance)) {
+		m_npc->setPosition(target);
+		m_npc->setVelocity(sf::Vector2f(0.f, 0.f));
+	}
+	else {
+		m_npc->setVelocity(newVel);
+	}
+
+	return false;
+}
+
+bool NPCRoutine::updateRoute(const sf::Vector2f& goal) {
+	PathFinder* pathFinder = getPathFinder();
+	if (m_isRouteValid && m_routeGoal == goal) {
+		// if our path got invalidated (a door closed), we search again from where we are.
+		if (!m_isFollowingPath || pathFinder == nullptr || pathFinder->getPathState(m_pathKey) != PathState::VOID) {
+			return true;
+		}
+		m_isRouteValid = false;
+	}
+
+	sf::Vector2f halfSize(m_npc->getBoundingBox()->width * 0.5f, m_npc->getBoundingBox()->height * 0.5f);
+	sf::Vector2f center = m_npc->getPosition() + halfSize;
+	sf::Vector2f goalCenter = goal + halfSize;
+
+	if (!m_isPathPending || m_routeGoal != goal) {
+		m_routeGoal = goal;
+		m_isFollowingPath = false;
+		m_isPathPending = false;
+		m_currentWaypoint = 0;
+		m_waypoints.clear();
+
+		if (pathFinder == nullptr || pathFinder->isDirectRouteFree(center, goalCenter)) {
+			m_waypoints.push_back(goal);
+			m_isRouteValid = true;
+			return true;
+		}
+
+		m_pathKey = pathFinder->requestPath(center, goalCenter);
+		m_isPathPending = true;
+	}
+
+	PathState state = pathFinder == nullptr ? PathState::NotFound : pathFinder->getPathState(m_pathKey);
+	if (state == PathState::Pending) {
+		return false;
+	}
+	if (state == PathState::VOID) {
+		m_pathKey = pathFinder->requestPath(center, goalCenter);
+		return false;
+	}
+	if (state == PathState::Found) {
+		for (auto& tile : *pathFinder->getWaypoints(m_pathKey)) {
+			m_waypoints.push_back(getWaypointPosition(tile));
+		}
+		m_isFollowingPath = true;
+	}
+
+	// if there is no path, the npc walks straight to its goal, as it always did.
+	m_waypoints.push_back(goal);
+	m_isPathPending = false;
+	m_isRouteValid = true;
+	return true;
+}
+
+sf::Vector2f NPCRoutine::getWaypointPosition(const sf::Vector2i& tile) const {
+	const sf::FloatRect* bb = m_npc->getBoundingBox();
+	return PathFinder::toPosition(tile) - sf::Vector2f(bb->width * 0.5f, bb->height * 0.5f);
+}
+
+PathFinder* NPCRoutine::getPathFinder() const {
+	MapScreen* screen = dynamic_cast<MapScreen*>(m_npc->getScreen());
+	if (screen == nullptr || !screen->getPathFinder()->isLoaded()) return nullptr;
+	return screen->getPathFinder();
+}
+
 void NPCRoutine::addStep(const RoutineStep& step) {
 	m_steps.push_back(step);
 }
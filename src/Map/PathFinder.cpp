@@ -0,0 +1,426 @@
+#include "Map/PathFinder.h"
+#include "Map/MapDynamicTile.h"
+
+const int PathFinder::SEARCH_BUDGET = 2000;
+const size_t PathFinder::MAX_CACHE_SIZE = 256;
+
+inline int signum(int v) {
+	return (v > 0) - (v < 0);
+}
+
+void PathFinder::load(const MapData& data, const std::vector<GameObject*>* dynamicTiles) {
+	dispose();
+	m_size = data.mapSize;
+	if (m_size.x <= 0 || m_size.y <= 0) return;
+
+	const size_t tileCount = static_cast<size_t>(m_size.x * m_size.y);
+	m_staticBlocked.assign(tileCount, false);
+	m_dynamicBlocked.assign(tileCount, 0);
+	m_jumpRight.assign(tileCount, -1);
+	m_jumpLeft.assign(tileCount, -1);
+	m_gScore.assign(tileCount, 0);
+	m_parent.assign(tileCount, -1);
+	m_stamp.assign(tileCount, 0);
+	m_currentStamp = 0;
+
+	for (int y = 0; y < m_size.y && y < static_cast<int>(data.collidableTilePositions.size()); ++y) {
+		const std::vector<bool>& row = data.collidableTilePositions[y];
+		for (int x = 0; x < m_size.x && x < static_cast<int>(row.size()); ++x) {
+			if (row[x]) {
+				m_staticBlocked[index(x, y)] = true;
+			}
+		}
+	}
+
+	// collidable rects and triangles block a tile if they overlap its inner half
+	for (int y = 0; y < m_size.y; ++y) {
+		for (int x = 0; x < m_size.x; ++x) {
+			if (m_staticBlocked[index(x, y)]) continue;
+			sf::FloatRect inner(
+				x * TILE_SIZE_F + 0.25f * TILE_SIZE_F,
+				y * TILE_SIZE_F + 0.25f * TILE_SIZE_F,
+				0.5f * TILE_SIZE_F,
+				0.5f * TILE_SIZE_F);
+
+			for (auto& rect : data.collidableRects) {
+				if (fastIntersect(rect, inner)) {
+					m_staticBlocked[index(x, y)] = true;
+					break;
+				}
+			}
+			if (m_staticBlocked[index(x, y)]) continue;
+			for (auto& triangle : data.collidableTriangles) {
+				if (triangle.intersects(inner)) {
+					m_staticBlocked[index(x, y)] = true;
+					break;
+				}
+			}
+		}
+	}
+
+	if (dynamicTiles != nullptr) {
+		for (GameObject* go : *dynamicTiles) {
+			MapDynamicTile* tile = dynamic_cast<MapDynamicTile*>(go);
+			if (tile == nullptr || !tile->isCollidable()) continue;
+			markCollidable(*tile->getBoundingBox(), 1);
+		}
+	}
+
+	updateJumpPoints(0, m_size.y - 1);
+	m_isLoaded = true;
+}
+
+void PathFinder::dispose() {
+	m_isLoaded = false;
+	m_staticBlocked.clear();
+	m_dynamicBlocked.clear();
+	m_jumpRight.clear();
+	m_jumpLeft.clear();
+	m_gScore.clear();
+	m_parent.clear();
+	m_stamp.clear();
+	m_cache.clear();
+	m_searches.clear();
+	m_openList = decltype(m_openList)();
+	m_lastUpdateWork = 0;
+}
+
+bool PathFinder::isLoaded() const {
+	return m_isLoaded;
+}
+
+void PathFinder::update() {
+	m_work = 0;
+	int budget = SEARCH_BUDGET;
+	while (m_isLoaded && !m_searches.empty() && budget > 0) {
+		Search& search = m_searches.front();
+		if (!search.isStarted) {
+			startSearch(search);
+		}
+		if (!continueSearch(search, budget)) break;
+		m_searches.pop_front();
+	}
+	m_lastUpdateWork = m_work;
+}
+
+uint64_t PathFinder::requestPath(const sf::Vector2f& start, const sf::Vector2f& goal) {
+	sf::Vector2i startTile = toTile(start);
+	sf::Vector2i goalTile = toTile(goal);
+	uint64_t key = getKey(startTile, goalTile);
+	if (!m_isLoaded || m_cache.find(key) != m_cache.end()) return key;
+
+	if (m_cache.size() >= MAX_CACHE_SIZE) {
+		// evict everything that is not pending, routines that still need their path will request it again.
+		for (auto it = m_cache.begin(); it != m_cache.end(); ) {
+			if (it->second.state != PathState::Pending) {
+				it = m_cache.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+	PathCacheEntry& entry = m_cache[key];
+	if (isBlocked(startTile) || isBlocked(goalTile)) {
+		entry.state = PathState::NotFound;
+	}
+	else if (startTile == goalTile) {
+		entry.state = PathState::Found;
+		entry.waypoints.push_back(startTile);
+	}
+	else {
+		entry.state = PathState::Pending;
+		Search search;
+		search.key = key;
+		search.start = index(startTile.x, startTile.y);
+		search.goal = index(goalTile.x, goalTile.y);
+		m_searches.push_back(search);
+	}
+
+	return key;
+}
+
+PathState PathFinder::getPathState(uint64_t key) const {
+	auto it = m_cache.find(key);
+	if (it == m_cache.end()) return PathState::VOID;
+	return it->second.state;
+}
+
+const std::vector<sf::Vector2i>* PathFinder::getWaypoints(uint64_t key) const {
+	auto it = m_cache.find(key);
+	if (it == m_cache.end() || it->second.state != PathState::Found) return nullptr;
+	return &it->second.waypoints;
+}
+
+bool PathFinder::isDirectRouteFree(const sf::Vector2f& start, const sf::Vector2f& goal) const {
+	if (!m_isLoaded) return true;
+	sf::Vector2i startTile = toTile(start);
+	sf::Vector2i goalTile = toTile(goal);
+
+	int dx = signum(goalTile.x - startTile.x);
+	for (int x = startTile.x; x != goalTile.x; x += dx) {
+		if (isBlocked(x, startTile.y)) return false;
+	}
+	int dy = signum(goalTile.y - startTile.y);
+	for (int y = startTile.y; y != goalTile.y; y += dy) {
+		if (isBlocked(goalTile.x, y)) return false;
+	}
+	return !isBlocked(goalTile);
+}
+
+bool PathFinder::isBlocked(const sf::Vector2i& tile) const {
+	return isBlocked(tile.x, tile.y);
+}
+
+bool PathFinder::isBlocked(int x, int y) const {
+	if (x < 0 || y < 0 || x >= m_size.x || y >= m_size.y) return true;
+	int i = index(x, y);
+	return m_staticBlocked[i] || m_dynamicBlocked[i] > 0;
+}
+
+void PathFinder::notifyCollidableChanged(const sf::FloatRect& boundingBox, bool isCollidable) {
+	if (!m_isLoaded) return;
+	markCollidable(boundingBox, isCollidable ? 1 : -1);
+}
+
+int PathFinder::getLastUpdateWork() const {
+	return m_lastUpdateWork;
+}
+
+int PathFinder::getPendingSearchCount() const {
+	return static_cast<int>(m_searches.size());
+}
+
+sf::Vector2i PathFinder::toTile(const sf::Vector2f& position) {
+	return sf::Vector2i(
+		static_cast<int>(std::floor(position.x / TILE_SIZE_F)),
+		static_cast<int>(std::floor(position.y / TILE_SIZE_F)));
+}
+
+sf::Vector2f PathFinder::toPosition(const sf::Vector2i& tile) {
+	return sf::Vector2f((tile.x + 0.5f) * TILE_SIZE_F, (tile.y + 0.5f) * TILE_SIZE_F);
+}
+
+uint64_t PathFinder::getKey(const sf::Vector2i& start, const sf::Vector2i& goal) {
+	return (static_cast<uint64_t>(start.x & 0xFFFF) << 48) |
+		(static_cast<uint64_t>(start.y & 0xFFFF) << 32) |
+		(static_cast<uint64_t>(goal.x & 0xFFFF) << 16) |
+		static_cast<uint64_t>(goal.y & 0xFFFF);
+}
+
+int PathFinder::heuristic(int from, int to) const {
+	return std::abs(from % m_size.x - to % m_size.x) + std::abs(from / m_size.x - to / m_size.x);
+}
+
+void PathFinder::startSearch(Search& search) {
+	if (++m_currentStamp == 0) {
+		std::fill(m_stamp.begin(), m_stamp.end(), 0);
+		m_currentStamp = 1;
+	}
+	m_openList = decltype(m_openList)();
+
+	m_stamp[search.start] = m_currentStamp;
+	m_gScore[search.start] = 0;
+	m_parent[search.start] = -1;
+	m_openList.push({ heuristic(search.start, search.goal), search.start });
+	search.isStarted = true;
+}
+
+bool PathFinder::continueSearch(Search& search, int& budget) {
+	while (!m_openList.empty()) {
+		if (budget <= 0) return false;
+
+		SearchNode node = m_openList.top();
+		m_openList.pop();
+		if (node.index == search.goal) {
+			finishSearch(search, true);
+			return true;
+		}
+		// skip outdated entries, the node has been pushed again with a lower score
+		if (node.f > m_gScore[node.index] + heuristic(node.index, search.goal)) continue;
+
+		int workBefore = m_work;
+		expand(node.index, search.goal);
+		budget -= m_work - workBefore;
+	}
+
+	finishSearch(search, false);
+	return true;
+}
+
+void PathFinder::finishSearch(Search& search, bool found) {
+	auto it = m_cache.find(search.key);
+	if (it == m_cache.end()) return;
+
+	PathCacheEntry& entry = it->second;
+	entry.waypoints.clear();
+	entry.state = found ? PathState::Found : PathState::NotFound;
+	if (!found) return;
+
+	for (int node = search.goal; node != -1; node = m_parent[node]) {
+		entry.waypoints.push_back(sf::Vector2i(node % m_size.x, node / m_size.x));
+	}
+	std::reverse(entry.waypoints.begin(), entry.waypoints.end());
+}
+
+void PathFinder::expand(int node, int goal) {
+	++m_work;
+	int x = node % m_size.x;
+	int y = node / m_size.x;
+	int parent = m_parent[node];
+
+	if (parent < 0) {
+		addSuccessor(jumpHorizontal(x, y, 1, goal), node, goal);
+		addSuccessor(jumpHorizontal(x, y, -1, goal), node, goal);
+		addSuccessor(jumpVertical(x, y, 1, goal), node, goal);
+		addSuccessor(jumpVertical(x, y, -1, goal), node, goal);
+		return;
+	}
+
+	int dx = signum(x - parent % m_size.x);
+	int dy = signum(y - parent / m_size.x);
+
+	if (dx != 0) {
+		// horizontal moves only turn if there is a forced neighbour
+		addSuccessor(jumpHorizontal(x, y, dx, goal), node, goal);
+		for (int ny = -1; ny <= 1; ny += 2) {
+			if (!isBlocked(x, y + ny) && isBlocked(x - dx, y + ny)) {
+				addSuccessor(jumpVertical(x, y, ny, goal), node, goal);
+			}
+		}
+	}
+	else {
+		addSuccessor(jumpVertical(x, y, dy, goal), node, goal);
+		addSuccessor(jumpHorizontal(x, y, 1, goal), node, goal);
+		addSuccessor(jumpHorizontal(x, y, -1, goal), node, goal);
+	}
+}
+
+void PathFinder::addSuccessor(int jumpPoint, int parent, int goal) {
+	if (jumpPoint < 0) return;
+	int g = m_gScore[parent] + heuristic(parent, jumpPoint);
+	if (m_stamp[jumpPoint] == m_currentStamp && m_gScore[jumpPoint] <= g) return;
+
+	m_stamp[jumpPoint] = m_currentStamp;
+	m_gScore[jumpPoint] = g;
+	m_parent[jumpPoint] = parent;
+	m_openList.push({ g + heuristic(jumpPoint, goal), jumpPoint });
+}
+
+int PathFinder::jumpHorizontal(int x, int y, int dx, int goal) {
+	while (true) {
+		x += dx;
+		++m_work;
+		if (isBlocked(x, y)) return -1;
+		int i = index(x, y);
+		if (i == goal) return i;
+		if (isForcedHorizontal(x, y, dx)) return i;
+	}
+}
+
+int PathFinder::jumpVertical(int x, int y, int dy, int goal) {
+	while (true) {
+		y += dy;
+		++m_work;
+		if (isBlocked(x, y)) return -1;
+		int i = index(x, y);
+		if (i == goal) return i;
+		if ((!isBlocked(x - 1, y) && isBlocked(x - 1, y - dy)) ||
+			(!isBlocked(x + 1, y) && isBlocked(x + 1, y - dy))) {
+			return i;
+		}
+		// vertical moves stop wherever a horizontal move would find a jump point or the goal
+		if (m_jumpRight[i] >= 0 || m_jumpLeft[i] >= 0) return i;
+		if (y == goal / m_size.x) {
+			m_work += std::abs(goal % m_size.x - x);
+			if (isRowFree(x, goal % m_size.x, y)) return i;
+		}
+	}
+}
+
+bool PathFinder::isForcedHorizontal(int x, int y, int dx) const {
+	return (!isBlocked(x, y - 1) && isBlocked(x - dx, y - 1)) ||
+		(!isBlocked(x, y + 1) && isBlocked(x - dx, y + 1));
+}
+
+bool PathFinder::isRowFree(int fromX, int toX, int y) const {
+	int dx = signum(toX - fromX);
+	for (int x = fromX; x != toX; ) {
+		x += dx;
+		if (isBlocked(x, y)) return false;
+	}
+	return true;
+}
+
+void PathFinder::updateJumpPoints(int top, int bottom) {
+	for (int y = std::max(0, top); y <= std::min(m_size.y - 1, bottom); ++y) {
+		// a move stops at the next tile if it is blocked or forced, else it goes on like a move from there
+		for (int x = m_size.x - 1; x >= 0; --x) {
+			m_jumpRight[index(x, y)] = isBlocked(x + 1, y) ? -1 :
+				isForcedHorizontal(x + 1, y, 1) ? index(x + 1, y) : m_jumpRight[index(x + 1, y)];
+		}
+		for (int x = 0; x < m_size.x; ++x) {
+			m_jumpLeft[index(x, y)] = isBlocked(x - 1, y) ? -1 :
+				isForcedHorizontal(x - 1, y, -1) ? index(x - 1, y) : m_jumpLeft[index(x - 1, y)];
+		}
+	}
+}
+
+void PathFinder::markCollidable(const sf::FloatRect& boundingBox, int delta) {
+	int left = std::max(0, static_cast<int>(std::floor((boundingBox.left + Epsilon) / TILE_SIZE_F)));
+	int top = std::max(0, static_cast<int>(std::floor((boundingBox.top + Epsilon) / TILE_SIZE_F)));
+	int right = std::min(m_size.x - 1, static_cast<int>(std::floor((boundingBox.left + boundingBox.width - Epsilon) / TILE_SIZE_F)));
+	int bottom = std::min(m_size.y - 1, static_cast<int>(std::floor((boundingBox.top + boundingBox.height - Epsilon) / TILE_SIZE_F)));
+
+	for (int y = top; y <= bottom; ++y) {
+		for (int x = left; x <= right; ++x) {
+			int i = index(x, y);
+			bool wasBlocked = isBlocked(x, y);
+			m_dynamicBlocked[i] = std::max(0, m_dynamicBlocked[i] + delta);
+			bool blocked = isBlocked(x, y);
+			if (m_isLoaded && wasBlocked != blocked) {
+				invalidate(i, blocked);
+			}
+		}
+	}
+
+	// the tiles above and below decide whether a tile is forced
+	if (m_isLoaded) {
+		updateJumpPoints(top - 1, bottom + 1);
+	}
+}
+
+void PathFinder::invalidate(int tile, bool isBlocked) {
+	sf::Vector2i tilePos(tile % m_size.x, tile / m_size.x);
+
+	// a newly blocked tile breaks the paths crossing it, a newly freed tile may connect unreachable goals.
+	for (auto it = m_cache.begin(); it != m_cache.end(); ) {
+		const PathCacheEntry& entry = it->second;
+		bool isInvalid = isBlocked ?
+			entry.state == PathState::Found && crossesTile(entry.waypoints, tilePos) :
+			entry.state == PathState::NotFound;
+
+		if (isInvalid) {
+			it = m_cache.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	// pending searches restart on the changed grid
+	for (auto& search : m_searches) {
+		search.isStarted = false;
+	}
+}
+
+bool PathFinder::crossesTile(const std::vector<sf::Vector2i>& waypoints, const sf::Vector2i& tile) const {
+	for (size_t i = 0; i < waypoints.size(); ++i) {
+		const sf::Vector2i& a = waypoints[i];
+		const sf::Vector2i& b = i + 1 < waypoints.size() ? waypoints[i + 1] : a;
+		if (a.x == b.x && a.x == tile.x && tile.y >= std::min(a.y, b.y) && tile.y <= std::max(a.y, b.y)) return true;
+		if (a.y == b.y && a.y == tile.y && tile.x >= std::min(a.x, b.x) && tile.x <= std::max(a.x, b.x)) return true;
+	}
+	return false;
+}
\ No newline at end of file
@@ -51,8 +51,18 @@ MapDynamicTile* ObjectFactory::createMapDynamicTile(MapDynamicTileID id, MapScre
 	return instance;
 }
 
-void ObjectFactory::registerAchievement(AchievementID id, AchievementConstructor constructor) {
+void ObjectFactory::registerAchievement(AchievementID id, AchievementConstructor constructor, const std::vector<GameplayEventType>& events) {
 	achievementRegistry.insert({ id, constructor });
+	if (!events.empty()) {
+		achievementEventRegistry.insert({ id, events });
+	}
+}
+
+const std::vector<GameplayEventType>& ObjectFactory::getAchievementEvents(AchievementID id) const {
+	static const std::vector<GameplayEventType> NO_EVENTS;
+	const auto& it = achievementEventRegistry.find(id);
+	if (it == achievementEventRegistry.end()) return NO_EVENTS;
+	return it->second;
 }
 
 Achievement* ObjectFactory::createAchievement(AchievementID id) {
@@ -16,6 +16,10 @@ Registrar::Registrar(AchievementID id, AchievementConstructor constructor) {
 	ObjectFactory::Instance()->registerAchievement(id, constructor);
 }
 
+Registrar::Registrar(AchievementID id, AchievementConstructor constructor, const std::vector<GameplayEventType>& events) {
+	ObjectFactory::Instance()->registerAchievement(id, constructor, events);
+}
+
 Registrar::Registrar(const std::vector<std::pair<AchievementID, AchievementConstructor>>& ids) {
 	for (auto pair : ids) {
 		ObjectFactory::Instance()->registerAchievement(pair.first, pair.second);
@@ -4,15 +4,56 @@
 #include "World/Item.h"
 #include "Controller/InputController.h"
 
+#include <fstream>
+
 const size_t ResourceManager::SOUND_POOL_SIZE = 5;
 
 ResourceManager* g_resourceManager;
 
+static const std::vector<std::string>& getMapTextures() {
+	static const std::vector<std::string> textures = {
+		GlobalResource::TEX_DIALOGUE,
+		GlobalResource::TEX_DIALOGUE_END,
+		GlobalResource::TEX_COOKING
+	};
+	return textures;
+}
+
+static const std::vector<std::string>& getLevelTextures() {
+	static const std::vector<std::string> textures = {
+		// level resources
+		GlobalResource::TEX_DAMAGETYPES,
+		GlobalResource::TEX_DEBUFF_FEAR,
+		GlobalResource::TEX_DEBUFF_STUN,
+		GlobalResource::TEX_SCREEN_GAMEOVER,
+		GlobalResource::TEX_SCREEN_OVERLAY,
+		GlobalResource::TEX_SCREEN_OVERLAY_STUNNED,
+		GlobalResource::TEX_SCREEN_OVERLAY_FEARED,
+		GlobalResource::TEX_SCREEN_OVERLAY_DAMAGED,
+		GlobalResource::TEX_TEXT_GAMEOVER,
+		GlobalResource::TEX_TEXT_GAMEPAUSED,
+		GlobalResource::TEX_TEXT_DEFEATED,
+		GlobalResource::TEX_TEXT_ARRESTED,
+		// level gui resources
+		GlobalResource::TEX_GUI_SPEECHBUBBLE_POINTER,
+		GlobalResource::TEX_GUI_HEALTHBAR_MAINCHAR_BORDER,
+		GlobalResource::TEX_GUI_HEALTHBAR_ENEMY_BORDER,
+		GlobalResource::TEX_GUI_HEALTHBAR_BOSS_BORDER,
+		GlobalResource::TEX_GUI_HEALTHBAR_CONTENT,
+		GlobalResource::TEX_GUI_HEALTHBAR_CONTENT_HIT,
+		GlobalResource::TEX_GUI_HEALTHBAR_CONTENT_HIGHLIGHT,
+		GlobalResource::TEX_GUI_EXIT_ARROW,
+		GlobalResource::TEX_GUI_LADDER_ARROW
+	};
+	return textures;
+}
+
 ResourceManager::ResourceManager() : m_currentError({ ErrorID::VOID, "" }) {
 	init();
 }
 
 ResourceManager::~ResourceManager() {
+	saveUnpackedFrames();
 	for (auto& it : m_textures) {
 		delete it.second;
 	}
@@ -25,7 +66,10 @@ ResourceManager::~ResourceManager() {
 	for (auto& it : m_bitmapFonts) {
 		delete it.second;
 	}
+	m_animationLibrary.clear();
 	m_textures.clear();
+	m_texturePaths.clear();
+	m_pendingSpriteSheets.clear();
 	m_soundBuffers.clear();
 	m_fonts.clear();
 	m_bitmapFonts.clear();
@@ -33,9 +77,18 @@ ResourceManager::~ResourceManager() {
 	m_levelResources.clear();
 	m_mapResources.clear();
 	deleteItemResources();
+	for (auto& it : m_decodedImages) {
+		delete it.second;
+	}
+	m_decodedImages.clear();
 }
 
 void ResourceManager::init() {
+	// the texture atlas is optional, without it every sprite sheet is a texture of its own
+	m_textureAtlas.load(getResourcePath(TextureAtlas::ATLAS_PATH));
+	// so are the baked minimaps, without them the map overlay renders the minimap of a level itself
+	m_levelMinimaps.load(getResourcePath(LevelMinimaps::MINIMAPS_PATH));
+
 	// load global resources
 	loadBitmapFont(GlobalResource::FONT_8, ResourceType::Global);
 	loadBitmapFont(GlobalResource::FONT_8_SHADOWED, ResourceType::Global);
@@ -144,6 +197,7 @@ void ResourceManager::init() {
 
 template<typename T> void ResourceManager::loadResource(std::map<std::string, T*>& holder, const std::string& typeName, const std::string& filename, ResourceType type, void* owner) {
 	if (filename.empty()) return;
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	if (contains(holder, filename)) {
 		return; // resource already loaded
 	}
@@ -156,7 +210,7 @@ template<typename T> void ResourceManager::loadResource(std::map<std::string, T*
 	T* resource = new T();
 
 	// search project's main directory
-	if (resource->loadFromFile(getResourcePath(filename))) {
+	if (loadResourceFromFile(resource, filename, type, owner)) {
 		holder[filename] = resource;
 
 		switch (type) {
@@ -183,6 +237,86 @@ template<typename T> void ResourceManager::loadResource(std::map<std::string, T*
 	}
 }
 
+template<typename T> bool ResourceManager::loadResourceFromFile(T* resource, const std::string& filename, ResourceType type, void* owner) {
+	return resource->loadFromFile(getResourcePath(filename));
+}
+
+bool ResourceManager::loadResourceFromFile(sf::Texture* texture, const std::string& filename, ResourceType type, void* owner) {
+	if (m_textureAtlas.isPacked(filename)) {
+		// the animations draw from the atlas page, so the sprite sheet is only uploaded once something needs its pixels
+		const std::string& pagePath = m_textureAtlas.getPagePath(m_textureAtlas.getPage(filename));
+		loadTexture(pagePath, type, owner);
+		if (contains(m_textures, pagePath)) {
+			m_texturePaths[texture] = filename;
+			m_pendingSpriteSheets.insert(texture);
+			return true;
+		}
+	}
+
+	sf::Image* image = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_decodedImagesMutex);
+		auto it = m_decodedImages.find(filename);
+		if (it != m_decodedImages.end()) {
+			image = it->second;
+			m_decodedImages.erase(it);
+		}
+	}
+
+	bool isLoaded;
+	if (image == nullptr) {
+		isLoaded = texture->loadFromFile(getResourcePath(filename));
+	}
+	else {
+		isLoaded = texture->loadFromImage(*image);
+		delete image;
+	}
+
+	if (isLoaded) {
+		m_texturePaths[texture] = filename;
+	}
+	return isLoaded;
+}
+
+void ResourceManager::decodeTexture(const std::string& filename) {
+	if (filename.empty()) return;
+	if (m_textureAtlas.isPacked(filename)) {
+		// only the atlas page is uploaded when the sprite sheet is loaded
+		decodeTexture(m_textureAtlas.getPagePath(m_textureAtlas.getPage(filename)));
+		return;
+	}
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		if (contains(m_textures, filename)) return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_decodedImagesMutex);
+		if (contains(m_decodedImages, filename)) return;
+	}
+
+	// decoding is the expensive part, it happens without holding a lock. If it fails, loadTexture reports the error.
+	sf::Image* image = new sf::Image();
+	if (!image->loadFromFile(getResourcePath(filename))) {
+		delete image;
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_decodedImagesMutex);
+	if (!m_decodedImages.insert({ filename, image }).second) {
+		delete image;
+	}
+}
+
+void ResourceManager::deleteDecodedImages(const std::vector<std::string>& filenames) {
+	std::lock_guard<std::mutex> lock(m_decodedImagesMutex);
+	for (auto& filename : filenames) {
+		auto it = m_decodedImages.find(filename);
+		if (it == m_decodedImages.end()) continue;
+		delete it->second;
+		m_decodedImages.erase(it);
+	}
+}
+
 void ResourceManager::loadTexture(const std::string& filename, ResourceType type, void* owner) {
 	loadResource<sf::Texture>(m_textures, "texture", filename, type, owner);
 }
@@ -201,6 +335,7 @@ void ResourceManager::loadBitmapFont(const std::string& filename, ResourceType t
 
 Item* ResourceManager::getItem(const std::string& itemID) {
 	if (itemID.empty()) return nullptr;
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	if (!contains(m_items, itemID)) {
 		Item* item = new Item(itemID);
 		if (!item->getCheck().isValid) {
@@ -213,35 +348,137 @@ Item* ResourceManager::getItem(const std::string& itemID) {
 	return m_items.at(itemID);
 }
 
-sf::Texture* ResourceManager::getTexture(const std::string& filename) const {
+sf::Texture* ResourceManager::getTexture(const std::string& filename) {
 	if (filename.empty()) return nullptr;
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	const auto& it = m_textures.find(filename);
 	if (it == m_textures.end()) {
 		g_logger->logError("ResourceManager", "Texture not found, try loading first: " + filename);
 		return nullptr;
 	}
+	// the texture may be drawn directly, so a packed sprite sheet needs its pixels now
+	uploadSpriteSheet(it->second);
 	return it->second;
 }
 
+const sf::Texture* ResourceManager::getSpriteSheet(const std::string& filename) {
+	if (filename.empty()) return nullptr;
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	const auto& it = m_textures.find(filename);
+	if (it == m_textures.end()) {
+		g_logger->logError("ResourceManager", "Texture not found, try loading first: " + filename);
+		return nullptr;
+	}
+	return it->second;
+}
+
+void ResourceManager::uploadSpriteSheet(sf::Texture* texture) {
+	if (m_pendingSpriteSheets.erase(texture) == 0) return;
+	const std::string& filename = m_texturePaths.at(texture);
+	if (!texture->loadFromFile(getResourcePath(filename))) {
+		g_logger->logError("ResourceManager", "texture could not be loaded from file: " + getResourcePath(filename));
+	}
+}
+
+const sf::Texture* ResourceManager::resolveAtlasFrames(const sf::Texture* spriteSheet, std::vector<sf::IntRect>& frames) {
+	if (spriteSheet == nullptr || frames.empty()) return spriteSheet;
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	auto path = m_texturePaths.find(spriteSheet);
+	if (path == m_texturePaths.end()) return spriteSheet;
+
+	int page = m_textureAtlas.getPage(path->second);
+	if (page < 0 && !m_isCollectingSprites) return spriteSheet;
+
+	std::vector<sf::IntRect> pageFrames;
+	for (auto& frame : frames) {
+		const TextureAtlasSprite* sprite = m_textureAtlas.getSprite(path->second, frame);
+		if (sprite != nullptr) {
+			pageFrames.push_back(sf::IntRect(sprite->position.x, sprite->position.y, frame.width, frame.height));
+			continue;
+		}
+		if (m_isCollectingSprites) {
+			std::vector<sf::IntRect>& unpackedFrames = m_unpackedFrames[path->second];
+			if (!contains(unpackedFrames, frame)) {
+				unpackedFrames.push_back(frame);
+			}
+		}
+	}
+
+	if (page < 0) return spriteSheet;
+	const sf::Texture* pageTexture = getSpriteSheet(m_textureAtlas.getPagePath(page));
+	if (pageTexture != nullptr && pageFrames.size() == frames.size()) {
+		frames = pageFrames;
+		return pageTexture;
+	}
+
+	// the texture atlas is outdated or its page is missing, this animation draws from the sprite sheet itself
+	uploadSpriteSheet(m_textures.at(path->second));
+	return spriteSheet;
+}
+
+const Animation* ResourceManager::getAnimation(const std::string& spriteSheet, const std::string& name, int skinNr, const AnimationBuilder& builder) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	return m_animationLibrary.getAnimation(getSpriteSheet(spriteSheet), spriteSheet, name, skinNr, builder);
+}
+
+const LevelMinimaps& ResourceManager::getLevelMinimaps() const {
+	return m_levelMinimaps;
+}
+
+void ResourceManager::setCollectingSprites(bool isCollectingSprites) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
+	m_isCollectingSprites = isCollectingSprites;
+}
+
+void ResourceManager::saveUnpackedFrames() const {
+	if (m_unpackedFrames.empty()) return;
+
+	// merge them into the sprite list for the next run of the atlas packer
+	std::map<std::string, std::vector<sf::IntRect>> sprites;
+	std::ifstream input(getResourcePath(TextureAtlas::SPRITE_LIST_PATH));
+	if (input.is_open() && !TextureAtlas::readSpriteList(input, sprites)) return;
+	input.close();
+
+	for (auto& source : m_unpackedFrames) {
+		std::vector<sf::IntRect>& frames = sprites[source.first];
+		for (auto& frame : source.second) {
+			if (!contains(frames, frame)) {
+				frames.push_back(frame);
+			}
+		}
+	}
+
+	std::ofstream output(getResourcePath(TextureAtlas::SPRITE_LIST_PATH));
+	if (!output.is_open()) {
+		g_logger->logError("ResourceManager", "Could not write the sprite list: " + getResourcePath(TextureAtlas::SPRITE_LIST_PATH));
+		return;
+	}
+	TextureAtlas::writeSpriteList(output, sprites);
+}
+
 sf::SoundBuffer* ResourceManager::getSoundBuffer(const std::string& filename) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	const auto& it = m_soundBuffers.find(filename);
 	if (it == m_soundBuffers.end()) return nullptr;
 	return it->second;
 }
 
 sf::Font* ResourceManager::getFont(const std::string& filename) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	const auto& it = m_fonts.find(filename);
 	if (it == m_fonts.end()) return nullptr;
 	return it->second;
 }
 
 BitmapFont* ResourceManager::getBitmapFont(const std::string& filename) const {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	const auto& it = m_bitmapFonts.find(filename);
 	if (it == m_bitmapFonts.end()) return nullptr;
 	return it->second;
 }
 
 void ResourceManager::deleteUniqueResources(void* owner) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	const auto &it = m_resourceOwners.find(owner);
 	if (it == m_resourceOwners.end()) return;
 
@@ -254,9 +491,13 @@ void ResourceManager::deleteUniqueResources(void* owner) {
 }
 
 void ResourceManager::deleteResource(const std::string& filename) {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	// delete texture
 	auto const &textureIt = m_textures.find(filename);
 	if (textureIt != m_textures.end()) {
+		m_texturePaths.erase(textureIt->second);
+		m_pendingSpriteSheets.erase(textureIt->second);
+		m_animationLibrary.deleteAnimations(filename);
 		delete textureIt->second;
 		m_textures.erase(textureIt);
 		g_logger->logInfo("ResourceManager", getResourcePath(std::string(filename)) + ": releasing texture");
@@ -414,52 +655,49 @@ bool ResourceManager::toggleAutotarget() {
 }
 
 void ResourceManager::deleteLevelResources() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	for (auto& filename : m_levelResources) {
 		deleteResource(filename);
 	}
 	m_levelResources.clear();
+	deleteDecodedImages(getLevelTextures());
 }
 
 void ResourceManager::loadMapResources() {
-	loadTexture(GlobalResource::TEX_DIALOGUE, ResourceType::Map);
-	loadTexture(GlobalResource::TEX_DIALOGUE_END, ResourceType::Map);
-	loadTexture(GlobalResource::TEX_COOKING, ResourceType::Map);
+	for (auto& texture : getMapTextures()) {
+		loadTexture(texture, ResourceType::Map);
+	}
+}
+
+void ResourceManager::decodeMapResources() {
+	for (auto& texture : getMapTextures()) {
+		decodeTexture(texture);
+	}
 }
 
 void ResourceManager::deleteMapResources() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	for (auto& filename : m_mapResources) {
 		deleteResource(filename);
 	}
 	m_mapResources.clear();
+	deleteDecodedImages(getMapTextures());
 }
 
 void ResourceManager::loadLevelResources() {
-	// load level resources
-	loadTexture(GlobalResource::TEX_DAMAGETYPES, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_DEBUFF_FEAR, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_DEBUFF_STUN, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_SCREEN_GAMEOVER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_SCREEN_OVERLAY, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_SCREEN_OVERLAY_STUNNED, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_SCREEN_OVERLAY_FEARED, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_SCREEN_OVERLAY_DAMAGED, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_TEXT_GAMEOVER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_TEXT_GAMEPAUSED, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_TEXT_DEFEATED, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_TEXT_ARRESTED, ResourceType::Level);
-	// load level gui resources
-	loadTexture(GlobalResource::TEX_GUI_SPEECHBUBBLE_POINTER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_MAINCHAR_BORDER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_ENEMY_BORDER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_BOSS_BORDER, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_CONTENT, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_CONTENT_HIT, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_HEALTHBAR_CONTENT_HIGHLIGHT, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_EXIT_ARROW, ResourceType::Level);
-	loadTexture(GlobalResource::TEX_GUI_LADDER_ARROW, ResourceType::Level);
+	for (auto& texture : getLevelTextures()) {
+		loadTexture(texture, ResourceType::Level);
+	}
+}
+
+void ResourceManager::decodeLevelResources() {
+	for (auto& texture : getLevelTextures()) {
+		decodeTexture(texture);
+	}
 }
 
 void ResourceManager::deleteItemResources() {
+	std::lock_guard<std::recursive_mutex> lock(m_mutex);
 	for (auto& item : m_items) {
 		delete item.second;
 	}
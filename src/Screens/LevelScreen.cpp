@@ -7,20 +7,41 @@
 #include "GUI/BookWindow.h"
 #include "Level/LevelMainCharacterLoader.h"
 #include "GUI/Stopwatch.h"
+#include "GameplayEventBus.h"
+#include "World/LoadingPipeline.h"
 
-LevelScreen::LevelScreen(const std::string& levelID, CharacterCore* core) : Screen(core), WorldScreen(core) {
+const int LevelScreen::MIN_PARALLEL_ENEMIES = 30;
+
+static const sf::BlendMode PARTICLE_BLEND_MODE = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Equation::Add,
+	sf::BlendMode::SrcAlpha, sf::BlendMode::One, sf::BlendMode::Add);
+
+LevelScreen::LevelScreen(const std::string& levelID, CharacterCore* core) : Screen(core), WorldScreen(core),
+	m_particleBGPass("ParticleBG", PARTICLE_BLEND_MODE),
+	m_particleEQPass("ParticleEQ", PARTICLE_BLEND_MODE),
+	m_particleFGPass("ParticleFG", PARTICLE_BLEND_MODE),
+	m_lightPass("Light", sf::BlendAlpha, sf::Color::Black) {
 	m_levelID = levelID;
-	m_particleBGRenderTexture.create(WINDOW_WIDTH, WINDOW_HEIGHT);
-	m_particleFGRenderTexture.create(WINDOW_WIDTH, WINDOW_HEIGHT);
-	m_particleEQRenderTexture.create(WINDOW_WIDTH, WINDOW_HEIGHT);
-	m_equipmentRenderTexture.create(WINDOW_WIDTH, WINDOW_HEIGHT);
 
-	m_particleBlendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha, sf::BlendMode::Equation::Add,
-		sf::BlendMode::SrcAlpha, sf::BlendMode::One, sf::BlendMode::Add);
+	m_particleBGPass.create(WINDOW_WIDTH, WINDOW_HEIGHT);
+	m_particleFGPass.create(WINDOW_WIDTH, WINDOW_HEIGHT);
+	// the background particles are composited before the equipment particles are drawn,
+	// and the ones drawn after that (by enemies) are composited in the next frame, as before. So they can share a texture.
+	m_particleEQPass.share(m_particleBGPass);
+	m_lightPass.setTexture(&m_renderTexture);
+
+	m_renderPasses = { &m_particleBGPass, &m_particleEQPass, &m_particleFGPass, &m_lightPass };
+
+	// enemies are drawn over items, items over the dynamic tiles
+	addPickableLayer(_Enemy);
+	addPickableLayer(_LevelItem);
+	addPickableLayer(_DynamicTile);
 }
 
 void LevelScreen::loadSync() {
 	m_currentLevel.loadForRenderTexture();
+	if (m_jobSystem == nullptr) {
+		m_jobSystem = new JobSystem(LoadingPipeline::getWorkerCount());
+	}
 
 	m_interface = new LevelInterface(this, m_mainChar);
 	dynamic_cast<LevelInterface*>(m_interface)->setSpellManager(m_mainChar->getSpellManager());
@@ -92,10 +113,39 @@ void LevelScreen::loadAsync() {
 
 void LevelScreen::cleanUp() {
 	m_currentLevel.dispose();
+	delete m_jobSystem;
+	m_jobSystem = nullptr;
+}
+
+void LevelScreen::updateEnemies(const sf::Time& frameTime) {
+	m_thinkingEnemies.clear();
+	for (auto& go : *getObjects(_Enemy)) {
+		if (go->isUpdatable()) {
+			m_thinkingEnemies.push_back(dynamic_cast<Enemy*>(go));
+		}
+	}
+
+	// the enemies think on the state of the level before any of them is updated, so the order doesn't matter
+	// and the results are the same on the workers and on this thread.
+	int count = static_cast<int>(m_thinkingEnemies.size());
+	auto think = [this](int i) { m_thinkingEnemies[i]->think(); };
+	if (m_jobSystem != nullptr && count >= MIN_PARALLEL_ENEMIES) {
+		m_jobSystem->parallelFor(count, think);
+	}
+	else {
+		for (int i = 0; i < count; ++i) {
+			think(i);
+		}
+	}
+
+	// the updates apply the results in the order of the enemies
+	updateObjects(_Enemy, frameTime);
 }
 
 bool LevelScreen::exitWorld() {
-	return !m_isGameOver;
+	if (m_isGameOver) return false;
+	g_gameplayEventBus->publish(GameplayEventType::LevelFinished, m_levelID);
+	return true;
 }
 
 void LevelScreen::notifyCharacterInfoReload() {
@@ -206,6 +256,7 @@ void LevelScreen::execOnEnter() {
 }
 
 void LevelScreen::execOnExit() {
+	logRenderPassStats();
 	WorldScreen::execOnExit();
 	cleanUp();
 	g_inputController->getCursor().setCursorSkin(Pointer);
@@ -282,20 +333,37 @@ const LevelData* LevelScreen::getWorldData() const {
 	return m_currentLevel.getWorldData();
 }
 
-sf::RenderTexture& LevelScreen::getParticleBGRenderTexture() {
-	return m_particleBGRenderTexture;
+RenderPass& LevelScreen::getParticleBGPass() {
+	return m_particleBGPass;
+}
+
+RenderPass& LevelScreen::getParticleEQPass() {
+	return m_particleEQPass;
 }
 
-sf::RenderTexture& LevelScreen::getParticleEQRenderTexture() {
-	return m_particleEQRenderTexture;
+RenderPass& LevelScreen::getParticleFGPass() {
+	return m_particleFGPass;
 }
 
-sf::RenderTexture& LevelScreen::getParticleFGRenderTexture() {
-	return m_particleFGRenderTexture;
+const std::vector<const RenderPass*>& LevelScreen::getRenderPasses() const {
+	return m_renderPasses;
+}
+
+DamageNumbers* LevelScreen::getDamageNumbers() {
+	return &m_damageNumbers;
+}
+
+void LevelScreen::logRenderPassStats() const {
+	for (auto pass : m_renderPasses) {
+		const RenderPassStats& stats = pass->getStats();
+		LOG_DEBUG("LevelScreen", pass->getName() + ": " + std::to_string(stats.draws) + " draws, " +
+			std::to_string(stats.composites) + " composites, " + std::to_string(stats.skipped) + " skipped, " +
+			std::to_string(stats.filledPixels) + " pixels filled.");
+	}
 }
 
 void LevelScreen::execUpdate(const sf::Time& frameTime) {
-	m_weatherSystem->update(m_mainChar->getPosition(), frameTime);
+	m_weatherSystem->update(frameTime);
 	handleGameOver(frameTime);
 	handleBossDefeated(frameTime);
 	handleBackToCheckpoint();
@@ -310,6 +378,9 @@ void LevelScreen::execUpdate(const sf::Time& frameTime) {
 		WorldScreen::execUpdate(frameTime);
 
 		if (!isUpdateOnlyInterface()) {
+			// before the objects, so that the numbers they emit in this frame are stacked anew
+			m_damageNumbers.update(frameTime);
+
 			// sort Movable Tiles
 			depthSortObjects(_MovableTile, false);
 			// update objects first for relative velocity
@@ -326,10 +397,11 @@ void LevelScreen::execUpdate(const sf::Time& frameTime) {
 
 			updateObjects(_MovableTile, frameTime);
 			updateObjects(_DynamicTile, frameTime);
-			updateObjects(_Enemy, frameTime);
+			updateEnemies(frameTime);
 			updateObjects(_LevelMainCharacter, frameTime);
 			updateObjects(_Equipment, frameTime);
 			updateObjects(_Spell, frameTime);
+			updateTriggers();
 			updateObjects(_Overlay, frameTime);
 			updateObjects(_Interface, frameTime);
 			if (!m_isGameOver) {
@@ -369,22 +441,6 @@ void LevelScreen::execUpdate(const sf::Time& frameTime) {
 	}
 }
 
-void LevelScreen::setEquipmentColor(const sf::Color& color) {
-	m_equipmentColor = color;
-}
-
-void LevelScreen::flushTexture(sf::RenderTarget& renderTarget, sf::RenderTexture& renderTexture, const sf::View& oldView, const sf::BlendMode& mode = sf::BlendAlpha) {
-	sf::RenderStates renderStates = sf::RenderStates::Default;
-	renderStates.blendMode = mode;
-
-	renderTexture.display();
-	m_sprite.setTexture(renderTexture.getTexture());
-	renderTarget.setView(renderTarget.getDefaultView());
-	renderTarget.draw(m_sprite, renderStates);
-	renderTarget.setView(oldView);
-	renderTexture.clear(sf::Color(0, 0, 0, 0));
-}
-
 void LevelScreen::render(sf::RenderTarget& renderTarget) {
 	sf::Vector2f focus = m_mainChar->getCenter();
 	
@@ -395,37 +451,35 @@ void LevelScreen::render(sf::RenderTarget& renderTarget) {
 	sf::View oldView = renderTarget.getView();
 	renderObjects(_DynamicTile, renderTarget);
 	renderObjects(_MovableTile, renderTarget);
-	flushTexture(renderTarget, m_particleBGRenderTexture, oldView, m_particleBlendMode);
+	m_particleBGPass.flush(renderTarget, m_sprite);
 	renderObjects(_LevelItem, renderTarget);
 
-	// the main character and the equipment are rendered on one texture
-	m_equipmentRenderTexture.setView(oldView);
-	renderObjects(_LevelMainCharacter, m_equipmentRenderTexture);
-	renderObjects(_Equipment, m_equipmentRenderTexture);
-	m_sprite.setColor(m_equipmentColor);
-	flushTexture(renderTarget, m_equipmentRenderTexture, oldView, sf::BlendAlpha);
-	m_sprite.setColor(COLOR_WHITE);
-	flushTexture(renderTarget, m_particleEQRenderTexture, oldView, m_particleBlendMode);
+	// the main character draws its equipment as one composed sprite, the equipment only renders its components
+	renderObjects(_LevelMainCharacter, renderTarget);
+	renderObjects(_Equipment, renderTarget);
+	m_particleEQPass.flush(renderTarget, m_sprite);
 
 	renderObjects(_Enemy, renderTarget);
 	renderObjects(_Spell, renderTarget);
-	flushTexture(renderTarget, m_particleFGRenderTexture, oldView, m_particleBlendMode);
+	m_particleFGPass.flush(renderTarget, m_sprite);
 	m_currentLevel.drawLightedForeground(renderTarget, sf::RenderStates::Default);
 	renderObjects(_DynamicTile, renderTarget); // dynamic tiles get rendered twice, this one is for the fluid tiles.
 	m_currentLevel.drawForeground(renderTarget, sf::RenderStates::Default);
 
 	// Render light sprites to extra buffer							(Buffer contains light levels as grayscale colors)
-	m_renderTexture.clear();
-	m_renderTexture.setView(oldView);
-	renderObjects(_Light, m_renderTexture);
-	m_renderTexture.display();
-
-	// Render extra buffer with light level shader to window		(Dimming level + lights added as transparent layer on top of map)
-	m_sprite.setTexture(m_renderTexture.getTexture());
-	m_lightLayerShader.setUniform("ambientLevel", m_currentLevel.getWeather().ambientDimming);
-	m_lightLayerShader.setUniform("lightDimming", m_currentLevel.getWeather().lightDimming);
-	renderTarget.setView(renderTarget.getDefaultView());
-	renderTarget.draw(m_sprite, &m_lightLayerShader);
+	// lights can only brighten the dimming, so the light layer is invisible without any dimming.
+	const WeatherData& weather = m_currentLevel.getWeather();
+	if (weather.ambientDimming > 0.f || weather.lightDimming > 0.f) {
+		renderObjects(_Light, m_lightPass.getTarget(oldView));
+
+		// Render extra buffer with light level shader to window		(Dimming level + lights added as transparent layer on top of map)
+		m_lightLayerShader.setUniform("ambientLevel", weather.ambientDimming);
+		m_lightLayerShader.setUniform("lightDimming", weather.lightDimming);
+		m_lightPass.flush(renderTarget, m_sprite, &m_lightLayerShader);
+	}
+	else {
+		m_lightPass.flush(renderTarget, m_sprite);
+	}
 
 	// Render overlays on top of level; no light levels here		(GUI stuff on top of everything)
 	renderTarget.setView(oldView);
@@ -438,6 +492,7 @@ void LevelScreen::render(sf::RenderTarget& renderTarget) {
 	renderObjectsAfterForeground(_Equipment, renderTarget);
 	renderObjectsAfterForeground(_Enemy, renderTarget);
 	renderObjectsAfterForeground(_Spell, renderTarget);
+	m_damageNumbers.render(renderTarget);
 	renderObjectsAfterForeground(_Light, renderTarget);
 	renderObjectsAfterForeground(_Interface, renderTarget);
 
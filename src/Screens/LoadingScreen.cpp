@@ -49,13 +49,19 @@ void LoadingScreen::execUpdate(const sf::Time& frameTime) {
 		delete m_thread;
 	}
 
-	if (g_resourceManager->pollError()->first == ErrorID::VOID) m_worldToLoad->loadSync();
+	if (g_resourceManager->pollError()->first == ErrorID::VOID) {
+		sf::Clock clock;
+		m_worldToLoad->loadSync();
+		g_logger->logInfo("LoadingScreen", "Synchronous loading took " + std::to_string(clock.getElapsedTime().asMilliseconds()) + " ms.");
+	}
 	setNextScreen(m_worldToLoad);
 	m_characterCore->autosave();
 }
 
 void LoadingScreen::loadAsync() const {
+	sf::Clock clock;
 	m_worldToLoad->loadAsync();
+	g_logger->logInfo("LoadingScreen", "Asynchronous loading took " + std::to_string(clock.getElapsedTime().asMilliseconds()) + " ms.");
 }
 
 void LoadingScreen::render(sf::RenderTarget& renderTarget) {
@@ -8,10 +8,15 @@
 
 MapScreen::MapScreen(const std::string& mapId, CharacterCore* core) : Screen(core), WorldScreen(core) {
 	m_mapID = mapId;
+
+	// the foreground tiles are drawn over the npcs, the npcs over the dynamic tiles
+	addPickableLayer(_ForegroundDynamicTile);
+	addPickableLayer(_MapMovableGameObject);
+	addPickableLayer(_DynamicTile);
 }
 
 void MapScreen::execUpdate(const sf::Time& frameTime) {
-	m_weatherSystem->update(m_mainChar->getPosition(), frameTime);
+	m_weatherSystem->update(frameTime);
 	if (m_currentMap.getWorldData()->explorable) {
 		updateFogOfWar();
 	}
@@ -45,10 +50,12 @@ void MapScreen::execUpdate(const sf::Time& frameTime) {
 	if (!isUpdateOnlyInterface()) {
 		updateObjects(_DynamicTile, frameTime);
 		updateObjects(_ForegroundDynamicTile, frameTime);
+		m_pathFinder.update();
 		updateObjects(_MapMovableGameObject, frameTime);
 		depthSortObjects(_MapMovableGameObject, true);
 		updateObjects(_Equipment, frameTime);
 		updateObjects(_Light, frameTime);
+		updateTriggers();
 		updateObjects(_Overlay, frameTime);
 	}
 	
@@ -57,6 +64,7 @@ void MapScreen::execUpdate(const sf::Time& frameTime) {
 
 void MapScreen::loadSync() {
 	m_currentMap.loadForRenderTexture();
+	m_pathFinder.load(*m_currentMap.getWorldData(), getObjects(_DynamicTile));
 
 	m_interface = new MapInterface(this);
 	m_progressLog = new ProgressLog(getCharacterCore());
@@ -135,6 +143,7 @@ void MapScreen::notifyEquipmentReload() {
 void MapScreen::execOnExit() {
 	WorldScreen::execOnExit();
 	m_currentMap.dispose();
+	m_pathFinder.dispose();
 	clearOverlays();
 }
 
@@ -150,6 +159,10 @@ MapMainCharacter* MapScreen::getMainCharacter() const {
 	return m_mainChar;
 }
 
+PathFinder* MapScreen::getPathFinder() {
+	return &m_pathFinder;
+}
+
 bool MapScreen::exitWorld() {
 	m_characterCore->setMap(m_mainChar->getPreviousPosition(), m_currentMap.getID());
 	return true;
@@ -280,31 +293,44 @@ void MapScreen::handleDialogueWindow(const sf::Time& frameTime) {
 }
 
 void MapScreen::updateFogOfWar() {
-	std::pair<sf::Vector2i, std::vector<bool>>* tilesExplored = nullptr;
-	for (auto& it : m_characterCore->getExploredTiles()) {
-		if (it.first == m_mapID) {
-			tilesExplored = &it.second;
-		}
-	}
-	if (!tilesExplored) return;
+	sf::Vector2f pos = m_mainChar->getPosition();
+	int x = static_cast<int>(pos.x / TILE_SIZE_F);
+	int y = static_cast<int>(pos.y / TILE_SIZE_F);
+
+	// the revealed area only changes when the main character enters another tile
+	if (m_lastFogOfWarTile.x == x && m_lastFogOfWarTile.y == y) return;
+
+	auto it = m_characterCore->getExploredTiles().find(m_mapID);
+	if (it == m_characterCore->getExploredTiles().end()) return;
+	m_lastFogOfWarTile = sf::Vector2i(x, y);
+	std::vector<bool>& tilesExplored = it->second.second;
 
 	int range = 6;
 
 	sf::Vector2i size = m_currentMap.getWorldData()->mapSize;
 
-	sf::Vector2f pos = m_mainChar->getPosition();
-	int x = static_cast<int>(pos.x / TILE_SIZE_F);
-	int y = static_cast<int>(pos.y / TILE_SIZE_F);
+	// bounds of the tiles that have been newly revealed
+	sf::Vector2i dirtyMin(size.x, size.y);
+	sf::Vector2i dirtyMax(-1, -1);
 
 	for (int i = x - range; i <= x + range; ++i) {
 		for (int j = y - range; j < y + range; ++j) {
 			if (i < 0 || i >= size.x || j < 0 || j >= size.y) continue;
 
-			if ((x - i) * (x - i) + (y - j) * (y - j) < range * range) {
-				tilesExplored->second[i + j * size.x] = true;
+			if ((x - i) * (x - i) + (y - j) * (y - j) < range * range && !tilesExplored[i + j * size.x]) {
+				tilesExplored[i + j * size.x] = true;
+				dirtyMin.x = std::min(dirtyMin.x, i);
+				dirtyMin.y = std::min(dirtyMin.y, j);
+				dirtyMax.x = std::max(dirtyMax.x, i);
+				dirtyMax.y = std::max(dirtyMax.y, j);
 			}
 		}
 	}
+
+	if (dirtyMax.x >= 0) {
+		m_interface->notifyFogOfWarRevealed(sf::IntRect(dirtyMin.x, dirtyMin.y, 
+			dirtyMax.x - dirtyMin.x + 1, dirtyMax.y - dirtyMin.y + 1));
+	}
 }
 
 void MapScreen::renderEquipment(sf::RenderTarget& renderTarget) {
@@ -38,6 +38,9 @@ void Screen::addObject(GameObject* object) {
 }
 
 void Screen::update(const sf::Time& frameTime) {
+	bool isMouseButtonDown = g_inputController->isMouseJustPressedLeft() || g_inputController->isMouseJustPressedRight() ||
+		g_inputController->isMouseClickedLeft() || g_inputController->isMouseClickedRight();
+	m_mousePicker.update(g_inputController->getMousePosition(), g_inputController->isMouseInsideView(), isMouseButtonDown);
 	execUpdate(frameTime);
 	deleteDisposedObjects();
 	for (auto& obj : m_toAdd) {
@@ -45,12 +48,21 @@ void Screen::update(const sf::Time& frameTime) {
 			delete obj;
 		}
 		else {
-			m_objects[obj->getConfiguredType()].push_back(obj);
+			insertObject(obj);
 		}
 	}
 	m_toAdd.clear();
 }
 
+void Screen::insertObject(GameObject* object) {
+	GameObjectType type = object->getConfiguredType();
+	m_objects[type].push_back(object);
+	if (m_mousePicker.hasLayer(type)) {
+		object->setMousePicker(&m_mousePicker);
+		m_mousePicker.setDirty();
+	}
+}
+
 std::vector<GameObject*>* Screen::getObjects(GameObjectType type) {
 	return &m_objects[type];
 }
@@ -62,7 +74,7 @@ std::vector<GameObject*>& Screen::getToAddObjects() {
 void Screen::onEnter() {
 	execOnEnter();
 	for (auto& obj : m_toAdd) {
-		m_objects[obj->getConfiguredType()].push_back(obj);
+		insertObject(obj);
 	}
 	m_toAdd.clear();
 }
@@ -84,6 +96,7 @@ void Screen::deleteDisposedObjects() {
 	for (GameObjectType t = _Undefined; t < _MAX; t = GameObjectType(t + 1)) {
 		for (std::vector<GameObject*>::iterator it = m_objects[t].begin(); it != m_objects[t].end(); /*don't increment here*/) {
 			if ((*it)->isDisposed()) {
+				m_mousePicker.removeObject(*it);
 				delete (*it);
 				it = m_objects[t].erase(it);
 			}
@@ -117,6 +130,7 @@ void Screen::deleteAllObjects() {
 
 void Screen::deleteObjects(GameObjectType type) {
 	for (std::vector<GameObject*>::iterator it = m_objects[type].begin(); it != m_objects[type].end(); /*don't increment here*/) {
+		m_mousePicker.removeObject(*it);
 		delete (*it);
 		it = m_objects[type].erase(it);
 	}
@@ -135,21 +149,12 @@ void Screen::updateObjects(GameObjectType type, const sf::Time& frameTime) {
 	}
 }
 
-inline bool compareYCoordAsc(const GameObject* go1, const GameObject* go2) { 
-	return (go1->getPosition().y + go1->getBoundingBox()->height < 
-		go2->getPosition().y + go2->getBoundingBox()->height);
-}
-
-inline bool compareYCoordDesc(const GameObject* go1, const GameObject* go2) {
-	return (go1->getPosition().y + go1->getBoundingBox()->height >
-		go2->getPosition().y + go2->getBoundingBox()->height);
+void Screen::depthSortObjects(GameObjectType type, bool asc) {
+	m_depthOrders[type].sort(m_objects[type], asc);
 }
 
-void Screen::depthSortObjects(GameObjectType type, bool asc) {
-	if (asc)
-		std::sort(m_objects[type].begin(), m_objects[type].end(), compareYCoordAsc);
-	else
-		std::sort(m_objects[type].begin(), m_objects[type].end(), compareYCoordDesc);
+void Screen::addPickableLayer(GameObjectType type) {
+	m_mousePicker.addLayer(type, &m_objects[type]);
 }
 
 void Screen::renderObjects(GameObjectType type, sf::RenderTarget& renderTarget) {
@@ -203,7 +203,7 @@ void WorldScreen::notifyQuestDescriptionAdded(const std::string& questID, int de
 
 void WorldScreen::notifyConditionAdded(const Condition& condition) {
 	if (getCharacterCore()->setConditionFulfilled(condition.type, condition.name)) {
-		reloadTriggers();
+		reloadTriggers(condition);
 
 		for (auto& it : *getObjects(_DynamicTile)) {
 			if (DoorTile* door = dynamic_cast<DoorTile*>(it)) {
@@ -240,14 +240,43 @@ void WorldScreen::notifyHintAdded(const std::string& hintKey) {
 	m_interface->reloadCharacterInfo();
 }
 
+void WorldScreen::addTrigger(Trigger* trigger) {
+	trigger->setIndexID(m_triggerIndex.addTrigger(trigger->getData().triggerRect, trigger->getData().conditions));
+	m_triggers.push_back(trigger);
+	reloadTrigger(trigger);
+	addObject(trigger);
+}
+
 void WorldScreen::reloadTriggers() {
-	for (GameObject* go : *getObjects(_Overlay)) {
-		Trigger* trigger = dynamic_cast<Trigger*>(go);
+	for (Trigger* trigger : m_triggers) {
 		if (trigger == nullptr) continue;
 		reloadTrigger(trigger);
 	}
 }
 
+void WorldScreen::reloadTriggers(const Condition& condition) {
+	for (int id : m_triggerIndex.getTriggers(condition.type, condition.name)) {
+		if (m_triggers[id] == nullptr) continue;
+		reloadTrigger(m_triggers[id]);
+	}
+}
+
+void WorldScreen::updateTriggers() {
+	m_triggerEvents.clear();
+	m_triggerIndex.update(*getMainCharacter()->getBoundingBox(), m_triggerEvents);
+
+	for (auto& event : m_triggerEvents) {
+		Trigger* trigger = m_triggers[event.trigger];
+		if (trigger == nullptr) continue;
+		trigger->notifyTriggerEvent(event.type);
+		if (trigger->isDisposed()) {
+			// the screen deletes it with the other disposed objects
+			m_triggerIndex.removeTrigger(event.trigger);
+			m_triggers[event.trigger] = nullptr;
+		}
+	}
+}
+
 void WorldScreen::toggleGodmode() {
 	if (!g_resourceManager->getConfiguration().isGodmode) {
 		g_resourceManager->getConfiguration().isGodmode = true;
@@ -354,6 +383,10 @@ bool WorldScreen::isUpdateOnlyInterface() const {
 	return shouldPause && isOverlay;
 }
 
+DialogueGraphCache& WorldScreen::getDialogueCache() {
+	return m_dialogueCache;
+}
+
 void WorldScreen::execUpdate(const sf::Time& frameTime) {
 	updateOverlayQueue();
 
@@ -6,12 +6,13 @@ void AureolaSpell::load(const SpellData& bean, LevelMovableGameObject* mob, cons
 
 	setSpriteOffset(sf::Vector2f(-10.f, -10.f));
 
-	Animation* spellAnimation = new Animation(sf::seconds(0.3f));
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(bean.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, bean.skinNr * 40, 40, 40));
-	spellAnimation->addFrame(sf::IntRect(40, bean.skinNr * 40, 40, 40));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "aureola", bean.skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(0.3f));
+		animation.addFrame(sf::IntRect(0, bean.skinNr * 40, 40, 40));
+		animation.addFrame(sf::IntRect(40, bean.skinNr * 40, 40, 40));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -20,11 +20,11 @@ void BoomerangSpell::load(const SpellData& data, LevelMovableGameObject* mob, co
 void BoomerangSpell::init(const SpellData& data) {
 	setSpriteOffset(sf::Vector2f(-30.f, -5.f));
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(data.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, data.skinNr * 30, 90, 30));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "boomerang", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, data.skinNr * 30, 90, 30));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -8,20 +8,18 @@ DivineShieldSpell::DivineShieldSpell(const AttributeData& additionalResistance)
 
 void DivineShieldSpell::load(const SpellData& bean, LevelMovableGameObject* mob, const sf::Vector2f& target) {
 	setSpriteOffset(sf::Vector2f(-12.f, -12.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(bean.spritesheetPath);
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(tex);
-
-	for (int i = 0; i < 8; i++) {
-		spellAnimation->addFrame(sf::IntRect(i * 120, 0, 120, 120));
-	}
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "divineshield", bean.skinNr, [&](Animation& animation) {
+		for (int i = 0; i < 8; i++) {
+			animation.addFrame(sf::IntRect(i * 120, 0, 120, 120));
+		}
 
-	for (int i = 7; i > -1; i--) {
-		spellAnimation->addFrame(sf::IntRect(i * 120, 0, 120, 120));
-	}
+		for (int i = 7; i > -1; i--) {
+			animation.addFrame(sf::IntRect(i * 120, 0, 120, 120));
+		}
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -3,15 +3,14 @@
 
 void FireBallSpell::init(const SpellData& data) {
 	setSpriteOffset(sf::Vector2f(-20.f, -20.f));
-	const sf::Texture* tex = g_resourceManager->getTexture(data.spritesheetPath);
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(tex);
-	for (int i = 0; i < 4; ++i) {
-		spellAnimation->addFrame(sf::IntRect(i * 50, data.skinNr * 50, 50, 50));
-	}
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "fireball", data.skinNr, [&](Animation& animation) {
+		for (int i = 0; i < 4; ++i) {
+			animation.addFrame(sf::IntRect(i * 50, data.skinNr * 50, 50, 50));
+		}
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
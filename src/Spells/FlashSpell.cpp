@@ -8,14 +8,14 @@ FlashSpell::FlashSpell() : Spell() {
 void FlashSpell::load(const SpellData& data, LevelMovableGameObject* mob, const sf::Vector2f& target) {
 	setSpriteOffset(sf::Vector2f(-10.f, 0.f));
 	m_mob = mob;
-	const sf::Texture* tex = g_resourceManager->getTexture(data.spritesheetPath);
 	
-	Animation* spellAnimation = new Animation(sf::milliseconds(200));
-	spellAnimation->setSpriteSheet(tex);
-	spellAnimation->addFrame(sf::IntRect(0, 0, 120, 120));
-	spellAnimation->addFrame(sf::IntRect(120, 0, 120, 120));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "flash", data.skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::milliseconds(200));
+		animation.addFrame(sf::IntRect(0, 0, 120, 120));
+		animation.addFrame(sf::IntRect(120, 0, 120, 120));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -6,12 +6,12 @@ void IceBallSpell::load(const SpellData& data, LevelMovableGameObject* mob, cons
 	setBoundingBox(sf::FloatRect(0, 0, 10, 10));
 	int size = 30;
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(data.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, data.skinNr * size, size, size));
-	spellAnimation->addFrame(sf::IntRect(size, data.skinNr * size, size, size));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "iceball", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, data.skinNr * size, size, size));
+		animation.addFrame(sf::IntRect(size, data.skinNr * size, size, size));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -11,11 +11,11 @@ LeapOfFaithSpell::LeapOfFaithSpell(float gravityScale) : Spell() {
 
 void LeapOfFaithSpell::load(const SpellData& bean, LevelMovableGameObject* mob, const sf::Vector2f& target) {
 	m_mob = mob;
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(bean.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, 0, 80, 120));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "leapoffaith", bean.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 80, 120));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	m_isFacingRight = m_mob->isFacingRight();
 	m_isUpsideDown = false;
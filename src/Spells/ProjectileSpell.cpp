@@ -13,11 +13,11 @@ void ProjectileSpell::load(const SpellData& data, LevelDynamicTile* tile, const
 void ProjectileSpell::init(const SpellData& data) {
 	setSpriteOffset(sf::Vector2f(-35.f, -2.f));
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(data.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, data.skinNr * 15, 80, 15));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "projectile", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, data.skinNr * 15, 80, 15));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
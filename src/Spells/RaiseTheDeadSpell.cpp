@@ -7,13 +7,13 @@ void RaiseTheDeadSpell::load(const SpellData& bean, LevelMovableGameObject* mob,
 	Spell::load(bean, mob, target);
 	setSpriteOffset(sf::Vector2f(-27.f, -27.f));
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(bean.spritesheetPath));
-	for (int i = 0; i < 16; ++i) {
-		spellAnimation->addFrame(sf::IntRect(i * 64, bean.skinNr * 64, 64, 64));
-	}
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "raisethedead", bean.skinNr, [&](Animation& animation) {
+		for (int i = 0; i < 16; ++i) {
+			animation.addFrame(sf::IntRect(i * 64, bean.skinNr * 64, 64, 64));
+		}
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
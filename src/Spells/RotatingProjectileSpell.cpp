@@ -24,11 +24,11 @@ bool RotatingProjectileSpell::getConfiguredRotateSprite() const {
 void RotatingProjectileSpell::init(const SpellData& data) {
 	setSpriteOffset(sf::Vector2f(0.f, 0.f));
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(data.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, data.skinNr * 45, 45, 45));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "rotatingprojectile", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, data.skinNr * 45, 45, 45));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
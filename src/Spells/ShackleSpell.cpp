@@ -27,13 +27,12 @@ void ShackleSpell::load(const SpellData& data, LevelMovableGameObject* mob, cons
 	setSpriteOffset(sf::Vector2f(-20.f, -20.f));
 
 	// load animation
-	const sf::Texture* tex = g_resourceManager->getTexture(data.spritesheetPath);
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(tex);
-	spellAnimation->addFrame(sf::IntRect(0, 50, 50, 50));
-	spellAnimation->setLooped(false);
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "shackle", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 50, 50, 50));
+		animation.setLooped(false);
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	setState(GameObjectState::Idle);
 }
@@ -157,13 +156,12 @@ void ShackleSprite::load(float angle, const sf::Vector2f& pos) {
 	m_isAlwaysUpdate = true;
 	m_boundingBox = sf::FloatRect(0.f, 0.f, 50.f, 50.f);
 
-	const sf::Texture* tex = g_resourceManager->getTexture("res/texture/spells/spritesheet_spell_shackle.png");
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(tex);
-	spellAnimation->addFrame(sf::IntRect(0, 0, 50, 50));
-	spellAnimation->setLooped(false);
+	const Animation* spellAnimation = g_resourceManager->getAnimation("res/texture/spells/spritesheet_spell_shackle.png", "shacklesprite", 0, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 50, 50));
+		animation.setLooped(false);
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	setState(GameObjectState::Idle);
 
@@ -7,11 +7,12 @@ void ShadowTrapSpell::load(const SpellData& bean, LevelMovableGameObject* mob, c
 	setSpriteOffset(sf::Vector2f(-10.f, -20.f));
 	m_stunDuration = sf::seconds(2.f);
 
-	Animation* spellAnimation = new Animation(sf::seconds(10.f));
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(bean.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, 0, 45, 30));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "shadowtrap", bean.skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(10.f));
+		animation.addFrame(sf::IntRect(0, 0, 45, 30));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
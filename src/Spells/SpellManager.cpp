@@ -79,7 +79,7 @@ void SpellManager::addSpell(const SpellData& spell, const std::vector<SpellModif
 template <typename T>
 bool SpellManager::_executeCurrentSpell(T target, bool force) {
 	if (m_currentSpell < 0) return false;
-	auto data = m_spellMap[m_currentSpell]->getSpellData();
+	const SpellData& data = m_spellMap[m_currentSpell]->getSpellData();
 	if (!force) {
 		// check if execution is ready.
 		if (m_remainingGlobalCooldown.asMilliseconds() != 0) return false;
@@ -92,9 +92,9 @@ bool SpellManager::_executeCurrentSpell(T target, bool force) {
 	}
 
 	// spell has been cast. set cooldown.
-	sf::Time cooldown = m_spellMap[m_currentSpell]->getSpellData().cooldown * m_owner->getAttributes()->cooldownMultiplier;
-	if (m_spellSelection &&  m_spellMap[m_currentSpell]->getSpellData().attachedToMob) {
-		cooldown = std::max(m_spellMap[m_currentSpell]->getSpellData().activeDuration, cooldown);
+	sf::Time cooldown = data.cooldown * m_owner->getAttributes()->cooldownMultiplier;
+	if (m_spellSelection && data.attachedToMob) {
+		cooldown = std::max(data.activeDuration, cooldown);
 	}
 	m_coolDownMap[data.id] = cooldown;
 	m_remainingGlobalCooldown = m_globalCooldown;
@@ -12,11 +12,11 @@ void TargetingProjectileSpell::load(const SpellData& data, LevelMovableGameObjec
 void TargetingProjectileSpell::init(const SpellData& data) {
 	setSpriteOffset(sf::Vector2f(-10.f, -10.f));
 
-	Animation* spellAnimation = new Animation();
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(data.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, data.skinNr * 39, 39, 39));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(data.spritesheetPath, "targetingprojectile", data.skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, data.skinNr * 39, 39, 39));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setCurrentAnimation(getAnimation(GameObjectState::Idle), false);
@@ -8,11 +8,12 @@ TelekinesisSpell::TelekinesisSpell() : Spell() {
 void TelekinesisSpell::load(const SpellData& bean, LevelMovableGameObject* mob, const sf::Vector2f& target) {
 	setSpriteOffset(sf::Vector2f(-10.f, -10.f));
 
-	Animation* spellAnimation = new Animation(sf::seconds(10.f));
-	spellAnimation->setSpriteSheet(g_resourceManager->getTexture(bean.spritesheetPath));
-	spellAnimation->addFrame(sf::IntRect(0, 0, 40, 30));
+	const Animation* spellAnimation = g_resourceManager->getAnimation(bean.spritesheetPath, "telekinesis", bean.skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(10.f));
+		animation.addFrame(sf::IntRect(0, 0, 40, 30));
+	});
 
-	addAnimation(GameObjectState::Idle, spellAnimation);
+	addSharedAnimation(GameObjectState::Idle, spellAnimation);
 
 	// initial values
 	setState(GameObjectState::Idle);
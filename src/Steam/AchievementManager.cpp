@@ -3,6 +3,7 @@
 #include "ObjectFactory.h"
 #include "Steam/Achievement.h"
 #include "Steam/CendricAchievements.h"
+#include "GameplayEventBus.h"
 
 #ifdef STEAM
 #include "Steam/SteamAchievements.h"
@@ -14,6 +15,8 @@
 AchievementManager* g_achievementManager;
 
 AchievementManager::AchievementManager() {
+	m_achievements.resize(static_cast<int>(MAX), nullptr);
+	m_subscriptions.resize(static_cast<int>(MAX));
 	m_cendricAchievements = createAchievementsArray();
 #ifdef STEAM
 	const bool isSuccess = SteamAPI_Init();
@@ -59,80 +62,100 @@ void AchievementManager::initAchievements() {
 			continue;
 		}
 
-		if (contains(m_achievements, achName)) {
-			continue;
-		}
-
 		auto achievement = ObjectFactory::Instance()->createAchievement(achId);
 		if (achievement == nullptr) {
 			continue;
 		}
 
-		m_achievements.insert({ achName, achievement });
+		m_achievements[i] = achievement;
+		for (auto type : ObjectFactory::Instance()->getAchievementEvents(achId)) {
+			m_subscriptions[i].push_back(g_gameplayEventBus->subscribe(type, [this, achId](const GameplayEvent& event) {
+				notifyEvent(achId, event);
+			}));
+		}
 	}
 }
 
 void AchievementManager::clearAchievements() {
-	for (auto kv : m_achievements) {
-		delete kv.second;
+	for (int i = static_cast<int>(VOID) + 1; i < static_cast<int>(MAX); ++i) {
+		removeAchievement(static_cast<AchievementID>(i));
 	}
-	m_achievements.clear();
 }
 
-void AchievementManager::notifyAchievement(AchievementID achievementId, const std::string& message) {
-	if (!contains(AchievementNames, achievementId)) return;
-	notifyAchievement(AchievementNames.at(achievementId), message);
+void AchievementManager::removeAchievement(AchievementID achievementId) {
+	int i = static_cast<int>(achievementId);
+	for (int subscription : m_subscriptions[i]) {
+		g_gameplayEventBus->unsubscribe(subscription);
+	}
+	m_subscriptions[i].clear();
+	delete m_achievements[i];
+	m_achievements[i] = nullptr;
 }
 
-void AchievementManager::notifyAchievement(const std::string& achievement, const std::string& message) {
-	if (!m_characterCore) return;
-	if (!contains(m_achievements, achievement)) return;
+Achievement* AchievementManager::getAchievement(AchievementID achievementId) const {
+	if (!m_characterCore) return nullptr;
+	if (achievementId <= VOID || achievementId >= MAX) return nullptr;
+	return m_achievements[static_cast<int>(achievementId)];
+}
 
-	if (m_achievements.at(achievement)->notify(message)) {
-		unlockAchievement(achievement);
+AchievementID AchievementManager::getAchievementID(const std::string& achievement) {
+	for (auto& it : AchievementNames) {
+		if (it.second == achievement) return it.first;
 	}
+	return VOID;
 }
 
-void AchievementManager::notifyAchievementCore(AchievementID achievementId) {
-	if (!contains(AchievementNames, achievementId)) return;
-	notifyAchievementCore(AchievementNames.at(achievementId));
+void AchievementManager::notifyEvent(AchievementID achievementId, const GameplayEvent& event) {
+	Achievement* achievement = getAchievement(achievementId);
+	if (achievement == nullptr) return;
+
+	if (achievement->notifyEvent(event, m_characterCore)) {
+		unlockAchievement(achievementId);
+	}
 }
 
-void AchievementManager::notifyAchievementCore(const std::string& achievement) {
-	if (!m_characterCore) return;
-	if (!contains(m_achievements, achievement)) return;
+void AchievementManager::notifyAchievement(AchievementID achievementId, const std::string& message) {
+	Achievement* achievement = getAchievement(achievementId);
+	if (achievement == nullptr) return;
 
-	if (m_achievements.at(achievement)->notifyCore(m_characterCore)) {
-		unlockAchievement(achievement);
+	if (achievement->notify(message)) {
+		unlockAchievement(achievementId);
 	}
 }
 
-void AchievementManager::unlockAchievement(AchievementID achievementId) {
-	if (!contains(AchievementNames, achievementId)) return;
-	unlockAchievement(AchievementNames.at(achievementId));
+void AchievementManager::notifyAchievement(const std::string& achievement, const std::string& message) {
+	notifyAchievement(getAchievementID(achievement), message);
+}
+
+void AchievementManager::notifyAchievementCore(AchievementID achievementId) {
+	Achievement* achievement = getAchievement(achievementId);
+	if (achievement == nullptr) return;
+
+	if (achievement->notifyCore(m_characterCore)) {
+		unlockAchievement(achievementId);
+	}
+}
+
+void AchievementManager::notifyAchievementCore(const std::string& achievement) {
+	notifyAchievementCore(getAchievementID(achievement));
 }
 
 void AchievementManager::unlockAchievement(const std::string& achievement) {
-	if (!m_characterCore) return;
+	unlockAchievement(getAchievementID(achievement));
+}
+
+void AchievementManager::unlockAchievement(AchievementID achievementId) {
+	if (getAchievement(achievementId) == nullptr) return;
 	if (!m_characterCore->getData().hashValid) return;
-	if (!contains(m_achievements, achievement)) return;
 
-	auto it = m_achievements.find(achievement);
-	delete (*it).second;
-	m_achievements.erase(it);
+	auto achievement = getAchievementName(achievementId);
+	removeAchievement(achievementId);
 	m_characterCore->setAchievementUnlocked(achievement);
 #ifdef STEAM
 	if (m_steamAchievements)
 		m_steamAchievements->setAchievement(achievement.c_str());
 #endif // STEAM
 #ifdef GAMERZILLA
-	for (int i = static_cast<int>(VOID) + 1; i < static_cast<int>(MAX); ++i) {
-		auto achId = static_cast<AchievementID>(i);
-		auto achName = getAchievementName(achId);
-		if (achName == achievement) {
-			GamerzillaSetTrophy(m_gameId, getAchievementGamerzilla(achId).c_str());
-			break;
-		}
-	}
+	GamerzillaSetTrophy(m_gameId, getAchievementGamerzilla(achievementId).c_str());
 #endif
-}
+}
\ No newline at end of file
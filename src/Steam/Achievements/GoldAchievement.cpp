@@ -2,7 +2,7 @@
 #include "CharacterCore.h"
 #include "Registrar.h"
 
-REGISTER_ACHIEVEMENT(AchievementID::ACH_GOLD_1000, GoldAchievement)
+REGISTER_ACHIEVEMENT_EVENTS(AchievementID::ACH_GOLD_1000, GoldAchievement, GameplayEventType::GoldChanged)
 
 bool GoldAchievement::notifyCore(const CharacterCore* core) {
 	return core->hasItem("gold", 1000);
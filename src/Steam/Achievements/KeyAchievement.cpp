@@ -2,7 +2,7 @@
 #include "CharacterCore.h"
 #include "Registrar.h"
 
-REGISTER_ACHIEVEMENT(AchievementID::ACH_ALL_KEYS, KeyAchievement)
+REGISTER_ACHIEVEMENT_EVENTS(AchievementID::ACH_ALL_KEYS, KeyAchievement, GameplayEventType::ItemAdded)
 
 bool KeyAchievement::notifyCore(const CharacterCore* core) {
 	auto const& items = core->getData().items;
@@ -24,3 +24,9 @@ bool KeyAchievement::notifyCore(const CharacterCore* core) {
 		contains(items, std::string("ke_cathedral")) &&
 		contains(items, std::string("ke_tower"));
 }
+
+bool KeyAchievement::notifyEvent(const GameplayEvent& event, const CharacterCore* core) {
+	// only a new key can complete the collection
+	if (event.id.compare(0, 3, "ke_") != 0) return false;
+	return notifyCore(core);
+}
\ No newline at end of file
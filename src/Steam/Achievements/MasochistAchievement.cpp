@@ -2,7 +2,7 @@
 #include "CharacterCore.h"
 #include "Registrar.h"
 
-REGISTER_ACHIEVEMENT(AchievementID::ACH_MASOCHIST, MasochistAchievement)
+REGISTER_ACHIEVEMENT_EVENTS(AchievementID::ACH_MASOCHIST, MasochistAchievement, GameplayEventType::ItemAdded)
 
 bool MasochistAchievement::notifyCore(const CharacterCore* core) {
 	auto const& items = core->getData().items;
@@ -10,3 +10,7 @@ bool MasochistAchievement::notifyCore(const CharacterCore* core) {
 	return
 		contains(items, std::string("eq_lavaback"));
 }
+
+bool MasochistAchievement::notifyEvent(const GameplayEvent& event, const CharacterCore* core) {
+	return event.id == "eq_lavaback" && notifyCore(core);
+}
\ No newline at end of file
@@ -1,8 +1,22 @@
 #include "Steam/Achievements/MercenariesOrderAchievement.h"
 #include "CharacterCore.h"
 #include "Registrar.h"
+#include "Enums/EnemyID.h"
 
-REGISTER_ACHIEVEMENT(AchievementID::ACH_MERCENARY_ORDER, MercenariesOrderAchievement)
+REGISTER_ACHIEVEMENT_EVENTS(AchievementID::ACH_MERCENARY_ORDER, MercenariesOrderAchievement, GameplayEventType::EnemyKilled)
+
+bool MercenariesOrderAchievement::notifyEvent(const GameplayEvent& event, const CharacterCore* core) {
+	switch (static_cast<EnemyID>(event.value)) {
+	case EnemyID::Boss_Morgiana:
+		return notify("morgiana");
+	case EnemyID::Boss_Roy:
+		return notify("roy");
+	case EnemyID::Boss_Jeremy:
+		return notify("jeremy");
+	default:
+		return false;
+	}
+}
 
 bool MercenariesOrderAchievement::notify(const std::string& message) {
 	if (message == "morgiana" && m_correctOrderState == 0) {
@@ -32,7 +32,43 @@
 #include "SpellCreators/DefaultSpellCreator.h"
 #include "SpellCreators/BuffSpellCreator.h"
 
-std::vector<SpellModifierType> SpellData::getAllowedModifiers(SpellID id) {
+const SpellData& SpellData::getSpellData(SpellID id) {
+	static const std::vector<SpellData> table = createSpellTable();
+	int index = static_cast<int>(id);
+	if (index < 0 || index >= static_cast<int>(table.size())) {
+		return table[static_cast<int>(SpellID::VOID)];
+	}
+	return table[index];
+}
+
+const std::vector<SpellModifierType>& SpellData::getAllowedModifiers(SpellID id) {
+	static const std::vector<std::vector<SpellModifierType>> table = createAllowedModifiersTable();
+	int index = static_cast<int>(id);
+	if (index < 0 || index >= static_cast<int>(table.size())) {
+		return table[static_cast<int>(SpellID::VOID)];
+	}
+	return table[index];
+}
+
+std::vector<SpellData> SpellData::createSpellTable() {
+	std::vector<SpellData> table;
+	table.reserve(static_cast<size_t>(SpellID::MAX));
+	for (int i = 0; i < static_cast<int>(SpellID::MAX); ++i) {
+		table.push_back(createSpellData(static_cast<SpellID>(i)));
+	}
+	return table;
+}
+
+std::vector<std::vector<SpellModifierType>> SpellData::createAllowedModifiersTable() {
+	std::vector<std::vector<SpellModifierType>> table;
+	table.reserve(static_cast<size_t>(SpellID::MAX));
+	for (int i = 0; i < static_cast<int>(SpellID::MAX); ++i) {
+		table.push_back(createAllowedModifiers(static_cast<SpellID>(i)));
+	}
+	return table;
+}
+
+std::vector<SpellModifierType> SpellData::createAllowedModifiers(SpellID id) {
 	std::vector<SpellModifierType> types;
 	switch (id) {
 	case SpellID::Chop:
@@ -243,7 +279,7 @@ SpellCreator* SpellData::getSpellCreator(const SpellData& data, const std::vecto
 	return creator;
 }
 
-SpellData SpellData::getSpellData(SpellID id) {
+SpellData SpellData::createSpellData(SpellID id) {
 	switch (id) {
 	case SpellID::Chop:
 		return getChopSpellData();
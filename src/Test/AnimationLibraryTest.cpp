@@ -0,0 +1,81 @@
+#include "Test/AnimationLibraryTest.h"
+
+const std::string AnimationLibraryTest::SPRITE_SHEET = "res/texture/enemies/spritesheet_enemy_test.png";
+const int AnimationLibraryTest::SPAWN_COUNT = 20;
+
+TestResult AnimationLibraryTest::runTest() {
+	TestResult result;
+	result.testName = "AnimationLibraryTest";
+
+	check(result, testShared(), "shared");
+	check(result, testSkins(), "skins");
+	check(result, testDefinition(), "definition");
+	check(result, testDeleted(), "deleted");
+
+	return result;
+}
+
+std::vector<const Animation*> AnimationLibraryTest::spawn(AnimationLibrary& library, int skinNr) {
+	std::vector<const Animation*> animations;
+	animations.push_back(library.getAnimation(nullptr, SPRITE_SHEET, "walking", skinNr, [&](Animation& animation) {
+		for (int i = 0; i < 4; ++i) {
+			animation.addFrame(sf::IntRect(i * 50, skinNr * 50, 50, 50));
+		}
+	}));
+	animations.push_back(library.getAnimation(nullptr, SPRITE_SHEET, "fighting", skinNr, [&](Animation& animation) {
+		animation.setFrameTime(sf::seconds(0.08f));
+		animation.addFrame(sf::IntRect(200, skinNr * 50, 50, 50));
+		animation.addFrame(sf::IntRect(250, skinNr * 50, 50, 50));
+	}));
+	animations.push_back(library.getAnimation(nullptr, SPRITE_SHEET, "dead", skinNr, [&](Animation& animation) {
+		animation.addFrame(sf::IntRect(300, skinNr * 50, 50, 50));
+		animation.setLooped(false);
+	}));
+	return animations;
+}
+
+bool AnimationLibraryTest::testShared() {
+	AnimationLibrary library;
+	std::vector<const Animation*> first = spawn(library, 0);
+	for (int i = 1; i < SPAWN_COUNT; ++i) {
+		if (spawn(library, 0) != first) return false;
+	}
+	return library.getBuildCount() == 3 && library.getAnimationCount() == 3;
+}
+
+bool AnimationLibraryTest::testSkins() {
+	AnimationLibrary library;
+	std::vector<const Animation*> skin0 = spawn(library, 0);
+	std::vector<const Animation*> skin1 = spawn(library, 1);
+	for (size_t i = 0; i < skin0.size(); ++i) {
+		if (skin0[i] == skin1[i]) return false;
+	}
+	return spawn(library, 1) == skin1 && library.getBuildCount() == 6;
+}
+
+bool AnimationLibraryTest::testDefinition() {
+	AnimationLibrary library;
+	std::vector<const Animation*> animations = spawn(library, 2);
+	const Animation* walking = animations[0];
+	const Animation* fighting = animations[1];
+	const Animation* dead = animations[2];
+
+	if (walking->getSize() != 4 || walking->getFrame(3) != sf::IntRect(150, 100, 50, 50)) return false;
+	if (walking->getFrameTime() != sf::milliseconds(100) || !walking->isLooped()) return false;
+	if (fighting->getSize() != 2 || fighting->getFrameTime() != sf::seconds(0.08f)) return false;
+	return dead->getSize() == 1 && !dead->isLooped();
+}
+
+bool AnimationLibraryTest::testDeleted() {
+	AnimationLibrary library;
+	spawn(library, 0);
+	library.getAnimation(nullptr, "res/texture/spells/spritesheet_spell_test.png", "projectile", 0, [](Animation& animation) {
+		animation.addFrame(sf::IntRect(0, 0, 80, 15));
+	});
+
+	// releasing the sprite sheet only deletes its own animations, they are built again on the next request
+	library.deleteAnimations(SPRITE_SHEET);
+	if (library.getAnimationCount() != 1) return false;
+	spawn(library, 0);
+	return library.getAnimationCount() == 4 && library.getBuildCount() == 7;
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "Test/AtlasPackerTest.h"
+#include "ResourceManager.h"
+#include "Logger.h"
+
+#include <fstream>
+#include <sstream>
+
+const int AtlasPackerTest::PAGE_SIZE = 64;
+
+// creates an image where every pixel gets a different color and one of a few alpha values
+inline sf::Image createPatternImage(int width, int height, int seed) {
+	static const sf::Uint8 ALPHAS[] = { 0, 40, 128, 200, 255 };
+	sf::Image image;
+	image.create(width, height);
+	for (int x = 0; x < width; ++x) {
+		for (int y = 0; y < height; ++y) {
+			int value = seed * 31 + x * 7 + y * 13;
+			image.setPixel(x, y, sf::Color(
+				static_cast<sf::Uint8>(value * 3 % 256),
+				static_cast<sf::Uint8>(value * 5 % 256),
+				static_cast<sf::Uint8>(value * 11 % 256),
+				ALPHAS[value % 5]));
+		}
+	}
+	return image;
+}
+
+inline bool isSamePixels(const sf::Image& image1, const sf::IntRect& rect1, const sf::Image& image2, const sf::Vector2i& position2) {
+	for (int x = 0; x < rect1.width; ++x) {
+		for (int y = 0; y < rect1.height; ++y) {
+			if (image1.getPixel(rect1.left + x, rect1.top + y) != image2.getPixel(position2.x + x, position2.y + y)) return false;
+		}
+	}
+	return true;
+}
+
+inline std::string writeAtlas(const TextureAtlas& atlas) {
+	std::stringstream stream;
+	atlas.write(stream);
+	return stream.str();
+}
+
+TestResult AtlasPackerTest::runTest() {
+	TestResult result;
+	result.testName = "AtlasPackerTest";
+
+	check(result, testPixels(), "pixels");
+	check(result, testLayout(), "layout");
+	check(result, testDeterministic(), "deterministic");
+	check(result, testInvalidFrames(), "invalid frames");
+	check(result, testCommittedAtlas(), "committed atlas");
+	check(result, testPendingSpriteSheet(), "pending sprite sheet");
+
+	return result;
+}
+
+std::map<std::string, sf::Image> AtlasPackerTest::createSpriteSheets() const {
+	std::map<std::string, sf::Image> spriteSheets;
+	spriteSheets["enemy"] = createPatternImage(60, 20, 1);
+	spriteSheets["spell"] = createPatternImage(40, 40, 2);
+	spriteSheets["weapon"] = createPatternImage(28, 50, 3);
+	return spriteSheets;
+}
+
+std::map<std::string, std::vector<sf::IntRect>> AtlasPackerTest::createSprites() const {
+	std::map<std::string, std::vector<sf::IntRect>> sprites;
+	// a walking animation showing a frame twice
+	sprites["enemy"] = { sf::IntRect(0, 0, 20, 20), sf::IntRect(20, 0, 20, 20), sf::IntRect(40, 0, 20, 20), sf::IntRect(20, 0, 20, 20) };
+	// frames of different sizes, some overlapping in the sheet
+	sprites["spell"] = { sf::IntRect(0, 0, 10, 10), sf::IntRect(5, 5, 30, 12), sf::IntRect(0, 20, 16, 8) };
+	// too large to share a page with the others
+	sprites["weapon"] = { sf::IntRect(0, 0, 28, 50), sf::IntRect(0, 0, 28, 25) };
+	return sprites;
+}
+
+bool AtlasPackerTest::testPixels() {
+	std::map<std::string, sf::Image> spriteSheets = createSpriteSheets();
+	std::map<std::string, std::vector<sf::IntRect>> sprites = createSprites();
+	AtlasPacker packer(PAGE_SIZE);
+	if (!packer.pack(sprites, spriteSheets, "atlas_")) return false;
+
+	const TextureAtlas& atlas = packer.getAtlas();
+	for (auto& source : sprites) {
+		int page = atlas.getPage(source.first);
+		if (page < 0 || page >= static_cast<int>(packer.getPages().size())) return false;
+		for (auto& frame : source.second) {
+			const TextureAtlasSprite* sprite = atlas.getSprite(source.first, frame);
+			if (sprite == nullptr) return false;
+			if (!isSamePixels(spriteSheets[source.first], frame, packer.getPages()[page], sprite->position)) return false;
+		}
+	}
+
+	return atlas.getSpriteCount() == 8;
+}
+
+bool AtlasPackerTest::testLayout() {
+	std::map<std::string, std::vector<sf::IntRect>> sprites = createSprites();
+	AtlasPacker packer(PAGE_SIZE);
+	if (!packer.pack(sprites, createSpriteSheets(), "atlas_")) return false;
+
+	const TextureAtlas& atlas = packer.getAtlas();
+	if (atlas.getPageCount() != 2 || atlas.getPagePath(1) != "atlas_1.png") return false;
+
+	// the frames of a page, grown by the padding, must not overlap and must stay inside the page
+	std::vector<std::vector<sf::IntRect>> pageRects(atlas.getPageCount());
+	for (auto& source : sprites) {
+		int page = atlas.getPage(source.first);
+		const sf::Image& image = packer.getPages()[page];
+		for (auto& frame : source.second) {
+			const TextureAtlasSprite* sprite = atlas.getSprite(source.first, frame);
+			sf::IntRect rect(sprite->position.x, sprite->position.y, frame.width, frame.height);
+			if (rect.left < AtlasPacker::PADDING || rect.top < AtlasPacker::PADDING
+				|| rect.left + rect.width + AtlasPacker::PADDING > static_cast<int>(image.getSize().x)
+				|| rect.top + rect.height + AtlasPacker::PADDING > static_cast<int>(image.getSize().y)) return false;
+
+			sf::IntRect padded(rect.left - AtlasPacker::PADDING / 2, rect.top - AtlasPacker::PADDING / 2,
+				rect.width + AtlasPacker::PADDING, rect.height + AtlasPacker::PADDING);
+			for (auto& other : pageRects[page]) {
+				// a frame shown twice is only packed once
+				if (other == padded) continue;
+				if (other.intersects(padded)) return false;
+			}
+			if (!contains(pageRects[page], padded)) {
+				pageRects[page].push_back(padded);
+			}
+		}
+	}
+
+	// no page is larger than it needs to be
+	return pageRects[0].size() == 6 && pageRects[1].size() == 2 && packer.getPages()[1].getSize() == sf::Vector2u(62, 54);
+}
+
+bool AtlasPackerTest::testDeterministic() {
+	std::map<std::string, sf::Image> spriteSheets = createSpriteSheets();
+	AtlasPacker packer1(PAGE_SIZE);
+	AtlasPacker packer2(PAGE_SIZE);
+	packer1.pack(createSprites(), spriteSheets, "atlas_");
+
+	// the order of the frames in the sprite list doesn't matter
+	std::map<std::string, std::vector<sf::IntRect>> sprites = createSprites();
+	for (auto& source : sprites) {
+		std::reverse(source.second.begin(), source.second.end());
+	}
+	packer2.pack(sprites, spriteSheets, "atlas_");
+
+	std::string table = writeAtlas(packer1.getAtlas());
+	if (table != writeAtlas(packer2.getAtlas())) return false;
+	for (size_t i = 0; i < packer1.getPages().size(); ++i) {
+		const sf::Image& page = packer1.getPages()[i];
+		if (page.getSize() != packer2.getPages()[i].getSize()) return false;
+		sf::IntRect rect(0, 0, page.getSize().x, page.getSize().y);
+		if (!isSamePixels(page, rect, packer2.getPages()[i], sf::Vector2i(0, 0))) return false;
+	}
+
+	// the table reads back to the same table
+	TextureAtlas atlas;
+	std::stringstream stream(table);
+	return atlas.read(stream) && writeAtlas(atlas) == table;
+}
+
+bool AtlasPackerTest::testInvalidFrames() {
+	std::map<std::string, std::vector<sf::IntRect>> sprites = createSprites();
+	sprites["enemy"].push_back(sf::IntRect(50, 0, 20, 20));
+	sprites["missing"] = { sf::IntRect(0, 0, 10, 10) };
+	sprites["large"] = { sf::IntRect(0, 0, 70, 10) };
+	std::map<std::string, sf::Image> spriteSheets = createSpriteSheets();
+	spriteSheets["large"] = createPatternImage(70, 10, 4);
+
+	AtlasPacker packer(PAGE_SIZE);
+	if (packer.pack(sprites, spriteSheets, "atlas_")) return false;
+
+	// the valid frames are still packed
+	const TextureAtlas& atlas = packer.getAtlas();
+	return atlas.getSpriteCount() == 8 && atlas.getPageCount() == 2 && !atlas.isPacked("missing") && !atlas.isPacked("large")
+		&& atlas.getSprite("enemy", sf::IntRect(50, 0, 20, 20)) == nullptr;
+}
+
+bool AtlasPackerTest::testCommittedAtlas() {
+	std::map<std::string, std::vector<sf::IntRect>> sprites;
+	std::ifstream spriteList(getResourcePath(TextureAtlas::SPRITE_LIST_PATH));
+	TextureAtlas atlas;
+	if (!spriteList.is_open() || !TextureAtlas::readSpriteList(spriteList, sprites) || sprites.empty()
+		|| !atlas.load(getResourcePath(TextureAtlas::ATLAS_PATH))) return false;
+
+	// the packer has to run again whenever the sprite list changes
+	for (auto& source : sprites) {
+		for (auto& frame : source.second) {
+			if (atlas.getSprite(source.first, frame) == nullptr) {
+				g_logger->logError("[AtlasPackerTest]", "The texture atlas is outdated, a frame is missing: " + source.first);
+				return false;
+			}
+		}
+	}
+
+	for (int i = 0; i < atlas.getPageCount(); ++i) {
+		sf::Image page;
+		if (!page.loadFromFile(getResourcePath(atlas.getPagePath(i)))) return false;
+	}
+	return true;
+}
+
+bool AtlasPackerTest::testPendingSpriteSheet() {
+	// only drawn through its animation
+	const std::string source = "res/texture/spells/spritesheet_spell_unlock.png";
+	const sf::IntRect frame(0, 0, 30, 10);
+	TextureAtlas atlas;
+	if (!atlas.load(getResourcePath(TextureAtlas::ATLAS_PATH)) || atlas.getSprite(source, frame) == nullptr) return false;
+
+	g_resourceManager->loadTexture(source, ResourceType::Unique, this);
+	const sf::Texture* spriteSheet = g_resourceManager->getSpriteSheet(source);
+	if (spriteSheet == nullptr || spriteSheet->getSize().x != 0) return false;
+
+	// the animation draws from the page, the sprite sheet is only uploaded once it is drawn directly
+	Animation animation;
+	animation.setSpriteSheet(spriteSheet);
+	animation.addFrame(frame);
+	bool isPending = animation.getSpriteSheet() != spriteSheet && animation.getSpriteSheet()->getSize().x > 0
+		&& spriteSheet->getSize().x == 0;
+	bool isUploaded = g_resourceManager->getTexture(source)->getSize().x > 0;
+
+	g_resourceManager->deleteUniqueResources(this);
+	return isPending && isUploaded;
+}
\ No newline at end of file
@@ -1,11 +1,53 @@
 #include "Test/CendricTests.h"
 #include "Test/WorldReaderTest.h"
 #include "Test/DialogueTranslationTest.h"
+#include "Test/PathFinderTest.h"
+#include "Test/SpellDataTest.h"
+#include "Test/InputSnapshotTest.h"
+#include "Test/EquipmentAtlasTest.h"
+#include "Test/TriggerIndexTest.h"
+#include "Test/GameplayEventBusTest.h"
+#include "Test/CutsceneStreamerTest.h"
+#include "Test/AtlasPackerTest.h"
+#include "Test/JobSystemTest.h"
+#include "Test/SaveGameIndexTest.h"
+#include "Test/AnimationLibraryTest.h"
+#include "Test/WeatherSystemTest.h"
+#include "Test/MousePickerTest.h"
+#include "Test/InteractionIndexTest.h"
+#include "Test/DialogueGraphCacheTest.h"
+#include "Test/DamageNumbersTest.h"
+#include "Test/StatusEffectSchedulerTest.h"
+#include "Test/LevelMinimapsTest.h"
+#include "Test/TileSimulationTest.h"
+#include "Test/LoadingPipelineTest.h"
+#include "Test/InventorySlotGridTest.h"
 #include "Logger.h"
 
 void CendricTests::runTests() {
 	runTest<WorldReaderTest>();
 	runTest<DialogueTranslationTest>();
+	runTest<PathFinderTest>();
+	runTest<SpellDataTest>();
+	runTest<InputSnapshotTest>();
+	runTest<EquipmentAtlasTest>();
+	runTest<TriggerIndexTest>();
+	runTest<GameplayEventBusTest>();
+	runTest<CutsceneStreamerTest>();
+	runTest<AtlasPackerTest>();
+	runTest<JobSystemTest>();
+	runTest<SaveGameIndexTest>();
+	runTest<AnimationLibraryTest>();
+	runTest<WeatherSystemTest>();
+	runTest<MousePickerTest>();
+	runTest<InteractionIndexTest>();
+	runTest<DialogueGraphCacheTest>();
+	runTest<DamageNumbersTest>();
+	runTest<StatusEffectSchedulerTest>();
+	runTest<LevelMinimapsTest>();
+	runTest<TileSimulationTest>();
+	runTest<LoadingPipelineTest>();
+	runTest<InventorySlotGridTest>();
 }
 
 template<typename T>
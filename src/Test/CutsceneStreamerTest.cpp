@@ -0,0 +1,81 @@
+#include "Test/CutsceneStreamerTest.h"
+#include "Cutscene/CutsceneStreamer.h"
+
+const unsigned int IMAGE_SIZE = 100;
+const size_t IMAGE_BYTES = IMAGE_SIZE * IMAGE_SIZE * 4;
+
+// generates an image instead of loading it
+inline bool decodeImage(const std::string& path, sf::Image& image) {
+	if (path == "missing") return false;
+	image.create(IMAGE_SIZE, IMAGE_SIZE, sf::Color::Black);
+	return true;
+}
+
+TestResult CutsceneStreamerTest::runTest() {
+	TestResult result;
+	result.testName = "CutsceneStreamerTest";
+
+	check(result, testNoBlockingPlayback(), "no blocking playback");
+	check(result, testMemoryBudget(), "memory budget");
+	check(result, testMissingImage(), "missing image");
+
+	return result;
+}
+
+bool CutsceneStreamerTest::testNoBlockingPlayback() {
+	// a background shown in every step and two images per step
+	std::vector<std::vector<std::string>> steps;
+	for (int i = 0; i < 8; ++i) {
+		steps.push_back({ "background", "step" + std::to_string(i) + "a", "step" + std::to_string(i) + "b" });
+	}
+
+	CutsceneStreamer streamer(steps, decodeImage);
+	streamer.waitForStep(0);
+
+	for (int step = 0; step < static_cast<int>(steps.size()); ++step) {
+		streamer.setCurrentStep(step);
+		for (auto& path : steps[step]) {
+			if (streamer.waitForImage(path) == nullptr) return false;
+		}
+		// while the step is shown, the next steps are prefetched
+		streamer.waitForPrefetch();
+		if (step + 1 < static_cast<int>(steps.size()) && !streamer.isStepDecoded(step + 1)) return false;
+	}
+
+	if (streamer.getImage("background") == nullptr || streamer.getImage("step0a") != nullptr) return false;
+	return streamer.getBlockCount() == 0;
+}
+
+bool CutsceneStreamerTest::testMemoryBudget() {
+	std::vector<std::vector<std::string>> steps;
+	for (int i = 0; i < 6; ++i) {
+		steps.push_back({ "step" + std::to_string(i) });
+	}
+
+	// enough for two and a half images. Prefetching exceeds it by the half image it decodes last,
+	// so it keeps the current step and the two next ones until the cutscene runs out of steps.
+	size_t budget = 5 * IMAGE_BYTES / 2;
+	CutsceneStreamer streamer(steps, decodeImage, budget);
+	for (int step = 0; step < static_cast<int>(steps.size()); ++step) {
+		streamer.setCurrentStep(step);
+		if (streamer.waitForImage(steps[step][0]) == nullptr) return false;
+		streamer.waitForPrefetch();
+		size_t prefetchedSteps = std::min(3, static_cast<int>(steps.size()) - step);
+		if (streamer.getMemoryUsage() != prefetchedSteps * IMAGE_BYTES) return false;
+	}
+
+	// after the last step, only its image is left
+	return streamer.getMaxMemoryUsage() <= budget + IMAGE_BYTES && streamer.getMemoryUsage() == IMAGE_BYTES;
+}
+
+bool CutsceneStreamerTest::testMissingImage() {
+	std::vector<std::vector<std::string>> steps = { { "missing", "step0" }, { "step1" } };
+
+	CutsceneStreamer streamer(steps, decodeImage);
+	streamer.waitForStep(0);
+	if (streamer.waitForImage("missing") != nullptr || streamer.waitForImage("step0") == nullptr) return false;
+	if (streamer.isStepDecoded(0) || streamer.waitForImage("unknown") != nullptr) return false;
+
+	streamer.setCurrentStep(1);
+	return streamer.waitForImage("step1") != nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "Test/DamageNumbersTest.h"
+#include "Level/DamageNumbers.h"
+
+TestResult DamageNumbersTest::runTest() {
+	TestResult result;
+	result.testName = "DamageNumbersTest";
+
+	check(result, testMerge(), "merge");
+	check(result, testTargets(), "targets");
+	check(result, testCap(), "cap");
+	check(result, testPool(), "pool");
+
+	return result;
+}
+
+const GameObject* DamageNumbersTest::getTarget(int i) const {
+	return reinterpret_cast<const GameObject*>(&m_targets[i]);
+}
+
+bool DamageNumbersTest::testMerge() {
+	DamageNumbers numbers;
+	sf::Vector2f position(100.f, 100.f);
+
+	// three ticks in quick succession end up in one number
+	numbers.emitNumber(getTarget(0), 5, position, DamageNumberType::DamageOverTime, false, false);
+	numbers.update(sf::milliseconds(50));
+	numbers.emitNumber(getTarget(0), 7, position, DamageNumberType::DamageOverTime, false, false);
+	numbers.update(sf::milliseconds(50));
+	numbers.emitNumber(getTarget(0), 8, position, DamageNumberType::DamageOverTime, false, false);
+	if (numbers.getActiveCount() != 1) return false;
+
+	const DamageNumberData* merged = nullptr;
+	for (auto& data : numbers.getNumbers()) {
+		if (data.active) merged = &data;
+	}
+	if (merged->value != 20 || merged->str != "20") return false;
+
+	// but not after the merge time
+	numbers.update(sf::seconds(DamageNumbers::MERGE_TIME));
+	numbers.emitNumber(getTarget(0), 3, position, DamageNumberType::DamageOverTime, false, false);
+	if (numbers.getActiveCount() != 2) return false;
+
+	// strings are never merged
+	numbers.emitString(getTarget(0), "Immune", position, DamageNumberType::DamageOverTime, false);
+	numbers.emitString(getTarget(0), "Immune", position, DamageNumberType::DamageOverTime, false);
+	return numbers.getActiveCount() == 4;
+}
+
+bool DamageNumbersTest::testTargets() {
+	DamageNumbers numbers;
+	sf::Vector2f position(100.f, 100.f);
+
+	// other targets and other types get their own numbers
+	numbers.emitNumber(getTarget(0), 5, position, DamageNumberType::Damage, false, false);
+	numbers.emitNumber(getTarget(1), 5, position, DamageNumberType::Damage, true, false);
+	numbers.emitNumber(getTarget(0), 5, position, DamageNumberType::Heal, false, false);
+	if (numbers.getActiveCount() != 3) return false;
+
+	// the numbers of the first target are stacked, the one of the second target starts at the bottom
+	const std::vector<DamageNumberData>& data = numbers.getNumbers();
+	if (data[0].color != COLOR_DAMAGE_ENEMY || data[1].color != COLOR_DAMAGE_ALLY || data[2].color != COLOR_HEAL_ENEMY) return false;
+	return data[2].position.y < data[0].position.y && data[1].position.y == data[0].position.y;
+}
+
+bool DamageNumbersTest::testCap() {
+	DamageNumbers numbers;
+	sf::Vector2f position(100.f, 100.f);
+
+	// a big area of effect hit in one frame
+	for (int i = 0; i < 3 * DamageNumbers::MAX_EMITS_PER_FRAME; ++i) {
+		numbers.emitNumber(getTarget(i % 2), 5, position, i % 4 < 2 ? DamageNumberType::Damage : DamageNumberType::Heal, false, false);
+		numbers.emitString(getTarget(i % 2), "Immune", position, DamageNumberType::DamageOverTime, false);
+	}
+	if (numbers.getActiveCount() != DamageNumbers::MAX_EMITS_PER_FRAME) return false;
+
+	// the next frame can emit again
+	numbers.update(sf::milliseconds(16));
+	numbers.emitString(getTarget(0), "Immune", position, DamageNumberType::DamageOverTime, false);
+	return numbers.getActiveCount() == DamageNumbers::MAX_EMITS_PER_FRAME + 1;
+}
+
+bool DamageNumbersTest::testPool() {
+	DamageNumbers numbers;
+	sf::Vector2f position(100.f, 100.f);
+
+	// more numbers than the pool holds, the oldest ones are overwritten
+	for (int frame = 0; frame < 2 * DamageNumbers::MAX_NUMBERS / DamageNumbers::MAX_EMITS_PER_FRAME; ++frame) {
+		for (int i = 0; i < DamageNumbers::MAX_EMITS_PER_FRAME; ++i) {
+			numbers.emitString(getTarget(0), std::to_string(frame), position, DamageNumberType::Damage, false);
+		}
+		numbers.update(sf::milliseconds(1));
+	}
+	if (static_cast<int>(numbers.getNumbers().size()) != DamageNumbers::MAX_NUMBERS) return false;
+	if (numbers.getActiveCount() != DamageNumbers::MAX_NUMBERS) return false;
+	for (auto& data : numbers.getNumbers()) {
+		if (std::stoi(data.str) < DamageNumbers::MAX_NUMBERS / DamageNumbers::MAX_EMITS_PER_FRAME) return false;
+	}
+
+	// all of them fade out
+	numbers.update(sf::seconds(DamageNumbers::TIME));
+	return numbers.getActiveCount() == 0;
+}
\ No newline at end of file
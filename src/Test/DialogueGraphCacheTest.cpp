@@ -0,0 +1,195 @@
+#include "Test/DialogueGraphCacheTest.h"
+#include "Map/DialogueLoader.h"
+#include "FileIO/ResourceFolder.h"
+#include "CharacterCore.h"
+#include "ResourceManager.h"
+#include "Logger.h"
+
+static const std::string DIALOGUE_ID = "res/npc/npc_test/dl_npc_test.lua";
+static const std::string TEXT_TYPE = "dl_npc_test";
+
+// answers the queries on this game state
+inline DialogueQueryCheck checkState(const std::map<std::string, int>& state) {
+	return [&state](const DialogueQuery& query) {
+		auto it = state.find(query.second);
+		return query.value == (it == state.end() ? 0 : it->second);
+	};
+}
+
+TestResult DialogueGraphCacheTest::runTest() {
+	TestResult result;
+	result.testName = "DialogueGraphCacheTest";
+
+	check(result, testFound(), "found");
+	check(result, testChanged(), "changed");
+	check(result, testStates(), "states");
+	check(result, testTextType(), "text type");
+	check(result, testScripts(), "scripts");
+
+	return result;
+}
+
+DialogueGraph DialogueGraphCacheTest::createGraph(const std::map<std::string, int>& conditions) {
+	DialogueGraph graph;
+	graph.textType = TEXT_TYPE;
+	graph.language = Language::Lang_EN;
+	graph.root = 0;
+	for (auto& condition : conditions) {
+		DialogueQuery query;
+		query.type = DialogueQueryType::Condition;
+		query.first = "npc_test";
+		query.second = condition.first;
+		query.value = condition.second;
+		graph.queries.push_back(query);
+		graph.root = 10 * graph.root + condition.second;
+	}
+
+	DialogueNode node;
+	node.tag = graph.root;
+	node.nextTag = -1;
+	node.type = DialogueNodeType::NPCTalking;
+	node.text = "DL_Test_" + std::to_string(graph.root);
+	graph.nodes.insert({ node.tag, node });
+	return graph;
+}
+
+bool DialogueGraphCacheTest::testFound() {
+	DialogueGraphCache cache;
+	std::map<std::string, int> state = { { "talked_to", 1 }, { "quest_done", 0 } };
+	if (cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(state)) != nullptr) return false;
+
+	cache.addGraph(DIALOGUE_ID, createGraph(state));
+	const DialogueGraph* graph = cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(state));
+	return graph != nullptr && graph->root == 1 && graph->nodes.at(1).text == "DL_Test_1";
+}
+
+bool DialogueGraphCacheTest::testChanged() {
+	DialogueGraphCache cache;
+	std::map<std::string, int> state = { { "talked_to", 1 }, { "quest_done", 0 } };
+	cache.addGraph(DIALOGUE_ID, createGraph(state));
+
+	// a condition the script asked about is fulfilled now, it has to run again
+	state["quest_done"] = 1;
+	if (cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(state)) != nullptr) return false;
+
+	// a condition it never asked about doesn't matter
+	state["quest_done"] = 0;
+	state["other_npc"] = 1;
+	return cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(state)) != nullptr;
+}
+
+bool DialogueGraphCacheTest::testStates() {
+	DialogueGraphCache cache;
+	std::map<std::string, int> before = { { "talked_to", 1 }, { "quest_done", 0 } };
+	std::map<std::string, int> after = { { "talked_to", 1 }, { "quest_done", 1 } };
+	cache.addGraph(DIALOGUE_ID, createGraph(before));
+	cache.addGraph(DIALOGUE_ID, createGraph(after));
+
+	// both states of the dialogue are kept
+	const DialogueGraph* graph = cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(before));
+	if (graph == nullptr || graph->root != 1) return false;
+	graph = cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(after));
+	if (graph == nullptr || graph->root != 11) return false;
+
+	// the oldest graphs are dropped
+	for (int i = 0; i < DialogueGraphCache::MAX_GRAPHS; ++i) {
+		cache.addGraph(DIALOGUE_ID, createGraph({ { "talked_to", 0 }, { "step_" + std::to_string(i), 1 } }));
+	}
+	return cache.getGraphCount() == DialogueGraphCache::MAX_GRAPHS &&
+		cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_EN, checkState(after)) == nullptr;
+}
+
+bool DialogueGraphCacheTest::testTextType() {
+	DialogueGraphCache cache;
+	std::map<std::string, int> state = { { "talked_to", 1 } };
+	cache.addGraph(DIALOGUE_ID, createGraph(state));
+
+	// crafting choices are translated while the script runs, another language or npc text needs its own graph
+	if (cache.findGraph(DIALOGUE_ID, TEXT_TYPE, Language::Lang_DE, checkState(state)) != nullptr) return false;
+	if (cache.findGraph(DIALOGUE_ID, "dl_npc_test2", Language::Lang_EN, checkState(state)) != nullptr) return false;
+	return cache.findGraph("res/npc/npc_test2/dl_npc_test2.lua", TEXT_TYPE, Language::Lang_EN, checkState(state)) == nullptr;
+}
+
+std::string DialogueGraphCacheTest::getNodeSequence(const std::map<int, DialogueNode>& nodes, int root) {
+	std::string sequence;
+	std::set<int> visited;
+	std::vector<int> open = { root };
+	while (!open.empty()) {
+		int tag = open.back();
+		open.pop_back();
+		auto it = nodes.find(tag);
+		if (it == nodes.end() || !visited.insert(tag).second) continue;
+
+		const DialogueNode& node = it->second;
+		sequence += std::to_string(node.tag) + ":" + std::to_string(static_cast<int>(node.type)) + ":" + node.text + ":" +
+			std::to_string(node.nextTag) + ":" + std::to_string(node.reloadTag) + ":" + node.merchantID;
+		for (auto& content : node.content) {
+			sequence += "|" + std::to_string(static_cast<int>(content.type)) + "," + content.s1 + "," + content.s2 + "," +
+				std::to_string(content.i1) + "," + std::to_string(content.i2);
+		}
+		for (auto& choice : node.choices) {
+			sequence += "|" + choice.first.text + "," + choice.first.item.first + "," + std::to_string(choice.first.item.second) + "," +
+				choice.first.crafting.item + "," + std::to_string(choice.first.crafting.materials.size()) + "," + std::to_string(choice.second);
+		}
+		sequence += "\n";
+
+		// the choices are walked in their order, after the next node
+		for (auto choice = node.choices.rbegin(); choice != node.choices.rend(); ++choice) {
+			open.push_back(choice->second);
+		}
+		open.push_back(node.nextTag);
+	}
+	return sequence;
+}
+
+bool DialogueGraphCacheTest::testScripts() {
+	CharacterCore* core = new CharacterCore();
+	core->loadNew();
+	Language language = g_resourceManager->getConfiguration().language;
+	WorldCallback callback(core);
+	DialogueGraphCache cache;
+
+	std::vector<std::string> paths = ResourceFolder::findFiles("res/npc", ".lua", "dl_");
+	int cachedCount = 0;
+	bool isEqual = !paths.empty();
+	for (auto& path : paths) {
+		std::string textType = path.substr(path.find_last_of('/') + 1);
+		textType = textType.substr(0, textType.size() - 4);
+
+		Dialogue dialogue;
+		dialogue.reset(path, textType);
+		DialogueLoader loader(dialogue, core);
+		loader.loadDialogue();
+		if (!loader.isCacheable()) continue;
+
+		DialogueGraph graph;
+		graph.textType = textType;
+		graph.language = language;
+		graph.queries = loader.getQueries();
+		graph.nodes = dialogue.getNodes();
+		graph.root = loader.getRoot();
+		cache.addGraph(path, graph);
+
+		// the game state is the same, so the cache must find the graph and the script must build it again
+		Dialogue scripted;
+		scripted.reset(path, textType);
+		DialogueLoader scriptedLoader(scripted, core);
+		scriptedLoader.loadDialogue();
+
+		const DialogueGraph* cached = cache.findGraph(path, textType, language, [&callback](const DialogueQuery& query) {
+			return DialogueLoader::isUnchanged(query, callback);
+		});
+		if (cached == nullptr ||
+			getNodeSequence(cached->nodes, cached->root) != getNodeSequence(scripted.getNodes(), scriptedLoader.getRoot())) {
+			g_logger->logError("DialogueGraphCacheTest", "The cached graph differs from the script: " + path);
+			isEqual = false;
+			continue;
+		}
+		cachedCount++;
+	}
+
+	g_logger->logInfo("DialogueGraphCacheTest", "Compared the cached graphs of " + std::to_string(cachedCount) + " of " +
+		std::to_string(paths.size()) + " dialogue scripts.");
+	delete core;
+	return isEqual;
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "Test/EquipmentAtlasTest.h"
+#include "Logger.h"
+
+const sf::Vector2i EquipmentAtlasTest::FRAME_SIZE = sf::Vector2i(8, 6);
+
+// creates a sprite sheet with frameCount frames in a row. Every pixel gets a different color and one of a few alpha values.
+inline sf::Image createSpriteSheet(int frameCount, const sf::Vector2i& frameSize, int seed) {
+	static const sf::Uint8 ALPHAS[] = { 0, 40, 128, 200, 255 };
+	sf::Image image;
+	image.create(frameCount * frameSize.x, frameSize.y);
+	for (unsigned int x = 0; x < image.getSize().x; ++x) {
+		for (unsigned int y = 0; y < image.getSize().y; ++y) {
+			int value = seed * 31 + static_cast<int>(x) * 7 + static_cast<int>(y) * 13;
+			image.setPixel(x, y, sf::Color(
+				static_cast<sf::Uint8>(value * 3 % 256),
+				static_cast<sf::Uint8>(value * 5 % 256),
+				static_cast<sf::Uint8>(value * 11 % 256),
+				ALPHAS[value % 5]));
+		}
+	}
+	return image;
+}
+
+inline std::vector<sf::IntRect> createFrames(int first, int count, const sf::Vector2i& frameSize) {
+	std::vector<sf::IntRect> frames;
+	for (int i = first; i < first + count; ++i) {
+		frames.push_back(sf::IntRect(i * frameSize.x, 0, frameSize.x, frameSize.y));
+	}
+	return frames;
+}
+
+TestResult EquipmentAtlasTest::runTest() {
+	TestResult result;
+	result.testName = "EquipmentAtlasTest";
+
+	check(result, testFrameLayout(), "frame layout");
+	check(result, testComposedPixels(), "composed pixels");
+	check(result, testEmptyLayers(), "empty layers");
+
+	return result;
+}
+
+std::vector<EquipmentAtlasLayer> EquipmentAtlasTest::createLayers() const {
+	std::vector<EquipmentAtlasLayer> layers;
+
+	// the base is narrower than the composed frame and centered, like the main character
+	sf::Vector2i baseSize(4, 6);
+	EquipmentAtlasLayer base;
+	base.spriteSheet = createSpriteSheet(4, baseSize, 1);
+	base.frames[GameObjectState::Walking] = createFrames(0, 3, baseSize);
+	base.frames[GameObjectState::Idle] = createFrames(3, 1, baseSize);
+	base.offset = sf::Vector2i(2, 0);
+	layers.push_back(base);
+
+	// fewer walking frames than the base and a state the base does not have
+	EquipmentAtlasLayer body;
+	body.spriteSheet = createSpriteSheet(3, FRAME_SIZE, 2);
+	body.frames[GameObjectState::Walking] = createFrames(0, 2, FRAME_SIZE);
+	body.frames[GameObjectState::Jumping] = createFrames(2, 1, FRAME_SIZE);
+	layers.push_back(body);
+
+	// frames larger than the composed frame must be clipped
+	sf::Vector2i largeSize(10, 9);
+	EquipmentAtlasLayer head;
+	head.spriteSheet = createSpriteSheet(4, largeSize, 3);
+	head.frames[GameObjectState::Walking] = createFrames(0, 3, largeSize);
+	head.frames[GameObjectState::Idle] = createFrames(3, 1, largeSize);
+	head.offset = sf::Vector2i(1, 1);
+	layers.push_back(head);
+
+	return layers;
+}
+
+sf::Image EquipmentAtlasTest::drawLayered(const std::vector<EquipmentAtlasLayer>& layers, GameObjectState state, size_t index) const {
+	sf::Image target;
+	target.create(FRAME_SIZE.x, FRAME_SIZE.y, sf::Color::Transparent);
+
+	for (auto& layer : layers) {
+		auto frames = layer.frames.find(state);
+		if (frames == layer.frames.end() || frames->second.empty()) continue;
+		const sf::IntRect& frame = frames->second[index % frames->second.size()];
+
+		for (int x = 0; x < frame.width; ++x) {
+			for (int y = 0; y < frame.height; ++y) {
+				int targetX = layer.offset.x + x;
+				int targetY = layer.offset.y + y;
+				if (targetX >= FRAME_SIZE.x || targetY >= FRAME_SIZE.y) continue;
+
+				// sf::BlendAlpha: color = src * srcAlpha + dst * (1 - srcAlpha), alpha = srcAlpha + dstAlpha * (1 - srcAlpha)
+				sf::Color src = layer.spriteSheet.getPixel(frame.left + x, frame.top + y);
+				sf::Color dst = target.getPixel(targetX, targetY);
+				float srcAlpha = src.a / 255.f;
+				auto blend = [srcAlpha](sf::Uint8 s, sf::Uint8 d) {
+					return static_cast<sf::Uint8>(std::round(s * srcAlpha + d * (1.f - srcAlpha)));
+				};
+				sf::Color result(blend(src.r, dst.r), blend(src.g, dst.g), blend(src.b, dst.b),
+					static_cast<sf::Uint8>(std::round(src.a + dst.a * (1.f - srcAlpha))));
+				target.setPixel(targetX, targetY, result);
+			}
+		}
+	}
+
+	return target;
+}
+
+bool EquipmentAtlasTest::testFrameLayout() {
+	std::vector<EquipmentAtlasLayer> layers = createLayers();
+	EquipmentAtlas atlas;
+	atlas.bake(layers, FRAME_SIZE);
+
+	// one composed frame per base frame, the other layers' states are ignored
+	if (atlas.getFrames(GameObjectState::Walking).size() != 3) return false;
+	if (atlas.getFrames(GameObjectState::Idle).size() != 1) return false;
+	if (!atlas.getFrames(GameObjectState::Jumping).empty()) return false;
+
+	std::vector<sf::IntRect> all = atlas.getFrames(GameObjectState::Walking);
+	all.push_back(atlas.getFrames(GameObjectState::Idle)[0]);
+	sf::IntRect imageRect(0, 0, atlas.getImage().getSize().x, atlas.getImage().getSize().y);
+	for (size_t i = 0; i < all.size(); ++i) {
+		if (all[i].width != FRAME_SIZE.x || all[i].height != FRAME_SIZE.y) return false;
+		if (!imageRect.contains(all[i].left, all[i].top) || !imageRect.contains(all[i].left + all[i].width - 1, all[i].top + all[i].height - 1)) return false;
+		for (size_t j = i + 1; j < all.size(); ++j) {
+			if (all[i].intersects(all[j])) return false;
+		}
+	}
+
+	return true;
+}
+
+bool EquipmentAtlasTest::testComposedPixels() {
+	std::vector<EquipmentAtlasLayer> layers = createLayers();
+	EquipmentAtlas atlas;
+	atlas.bake(layers, FRAME_SIZE);
+
+	for (GameObjectState state : { GameObjectState::Walking, GameObjectState::Idle }) {
+		const std::vector<sf::IntRect>& frames = atlas.getFrames(state);
+		for (size_t i = 0; i < frames.size(); ++i) {
+			sf::Image layered = drawLayered(layers, state, i);
+			for (int x = 0; x < FRAME_SIZE.x; ++x) {
+				for (int y = 0; y < FRAME_SIZE.y; ++y) {
+					sf::Color expected = layered.getPixel(x, y);
+					sf::Color composed = atlas.getImage().getPixel(frames[i].left + x, frames[i].top + y);
+					// the atlas uses integer math, allow one rounding step per layer
+					const int tolerance = static_cast<int>(layers.size());
+					if (std::abs(expected.r - composed.r) > tolerance || std::abs(expected.g - composed.g) > tolerance ||
+						std::abs(expected.b - composed.b) > tolerance || std::abs(expected.a - composed.a) > tolerance) {
+						g_logger->logError("[EquipmentAtlasTest]", "Pixel (" + std::to_string(x) + ", " + std::to_string(y) + ") of frame " +
+							std::to_string(i) + " differs from the layered result");
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool EquipmentAtlasTest::testEmptyLayers() {
+	EquipmentAtlas atlas;
+	atlas.bake(std::vector<EquipmentAtlasLayer>(), FRAME_SIZE);
+	if (!atlas.getFrames(GameObjectState::Idle).empty() || atlas.getImage().getSize().x != 0) return false;
+
+	// a base layer without frames bakes nothing, nothing can be loaded
+	std::vector<EquipmentAtlasLayer> layers(1);
+	atlas.bake(layers, FRAME_SIZE);
+	std::map<GameObjectState, const Animation*> animations;
+	return atlas.getFrames(GameObjectState::Idle).empty() && !atlas.load(animations) && !atlas.isLoaded() && atlas.getAnimation(nullptr) == nullptr;
+}
\ No newline at end of file
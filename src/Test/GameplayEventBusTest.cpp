@@ -0,0 +1,80 @@
+#include "Test/GameplayEventBusTest.h"
+#include "GameplayEventBus.h"
+
+TestResult GameplayEventBusTest::runTest() {
+	TestResult result;
+	result.testName = "GameplayEventBusTest";
+
+	check(result, testPublish(), "publish");
+	check(result, testUnsubscribe(), "unsubscribe");
+	check(result, testUnsubscribeInCallback(), "unsubscribe in callback");
+	check(result, testSubscribeInCallback(), "subscribe in callback");
+
+	return result;
+}
+
+bool GameplayEventBusTest::testPublish() {
+	GameplayEventBus bus;
+	if (bus.hasSubscribers(GameplayEventType::ItemAdded)) return false;
+	bus.publish(GameplayEventType::ItemAdded, "ke_tower", 1);
+
+	std::vector<GameplayEvent> events;
+	bus.subscribe(GameplayEventType::ItemAdded, [&events](const GameplayEvent& event) { events.push_back(event); });
+	if (!bus.hasSubscribers(GameplayEventType::ItemAdded) || bus.hasSubscribers(GameplayEventType::Death)) return false;
+
+	bus.publish(GameplayEventType::Death, "testlevel");
+	bus.publish(GameplayEventType::ItemAdded, "ke_tower", 2);
+	return events.size() == 1 && events[0].type == GameplayEventType::ItemAdded &&
+		events[0].id == "ke_tower" && events[0].value == 2;
+}
+
+bool GameplayEventBusTest::testUnsubscribe() {
+	GameplayEventBus bus;
+	int first = 0;
+	int second = 0;
+	int a = bus.subscribe(GameplayEventType::GoldChanged, [&first](const GameplayEvent&) { first++; });
+	bus.subscribe(GameplayEventType::GoldChanged, [&second](const GameplayEvent&) { second++; });
+
+	bus.publish(GameplayEventType::GoldChanged, 10);
+	bus.unsubscribe(a);
+	// a second unsubscribe and unknown IDs are ignored
+	bus.unsubscribe(a);
+	bus.unsubscribe(42);
+	bus.publish(GameplayEventType::GoldChanged, 20);
+
+	return first == 1 && second == 2 && bus.hasSubscribers(GameplayEventType::GoldChanged);
+}
+
+bool GameplayEventBusTest::testUnsubscribeInCallback() {
+	GameplayEventBus bus;
+	// like an achievement that unlocks and unsubscribes itself on the third kill
+	int kills = 0;
+	int subscription = -1;
+	subscription = bus.subscribe(GameplayEventType::EnemyKilled, [&](const GameplayEvent&) {
+		if (++kills == 3) bus.unsubscribe(subscription);
+	});
+	int allKills = 0;
+	bus.subscribe(GameplayEventType::EnemyKilled, [&allKills](const GameplayEvent&) { allKills++; });
+
+	for (int i = 0; i < 5; ++i) {
+		bus.publish(GameplayEventType::EnemyKilled, i);
+	}
+	return kills == 3 && allKills == 5;
+}
+
+bool GameplayEventBusTest::testSubscribeInCallback() {
+	GameplayEventBus bus;
+	int levels = 0;
+	bool isSubscribed = false;
+	bus.subscribe(GameplayEventType::LevelFinished, [&](const GameplayEvent&) {
+		if (isSubscribed) return;
+		isSubscribed = true;
+		bus.subscribe(GameplayEventType::LevelFinished, [&levels](const GameplayEvent&) { levels++; });
+	});
+
+	// the new subscriber only gets the following events
+	bus.publish(GameplayEventType::LevelFinished, "level1");
+	if (levels != 0) return false;
+	bus.publish(GameplayEventType::LevelFinished, "level2");
+	return levels == 1;
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "Test/InputSnapshotTest.h"
+#include "Controller/KeyboardState.h"
+#include "Controller/InputSnapshot.h"
+
+inline sf::Event keyEvent(sf::Event::EventType type, sf::Keyboard::Key code) {
+	sf::Event e;
+	e.type = type;
+	e.key.code = code;
+	e.key.alt = false;
+	e.key.control = false;
+	e.key.shift = false;
+	e.key.system = false;
+	return e;
+}
+
+// takes the snapshot of one frame, with the key "Jump" bound to space.
+inline void nextFrame(KeyboardState& keyboard, InputSnapshot& snapshot) {
+	keyboard.snapshot();
+	snapshot.update(Key::Jump, keyboard.isPressed(sf::Keyboard::Space));
+}
+
+TestResult InputSnapshotTest::runTest() {
+	TestResult result;
+	result.testName = "InputSnapshotTest";
+
+	check(result, testPressAndHold(), "press and hold");
+	check(result, testRelease(), "release");
+	check(result, testTapWithinFrame(), "tap within one frame");
+	check(result, testPolledThisFrame(), "polled in this frame");
+	check(result, testLostFocus(), "lost focus");
+	check(result, testInvalidKeys(), "invalid keys");
+
+	return result;
+}
+
+bool InputSnapshotTest::testPressAndHold() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+
+	nextFrame(keyboard, snapshot);
+	if (snapshot.isActive(Key::Jump) || snapshot.isJustPressed(Key::Jump)) return false;
+
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	if (!snapshot.isActive(Key::Jump) || !snapshot.isJustPressed(Key::Jump)) return false;
+
+	// key repeat events must not create new edges
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	if (!snapshot.isActive(Key::Jump) || snapshot.isJustPressed(Key::Jump)) return false;
+
+	nextFrame(keyboard, snapshot);
+	return snapshot.isActive(Key::Jump) && !snapshot.isJustPressed(Key::Jump);
+}
+
+bool InputSnapshotTest::testRelease() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	keyboard.handleEvent(keyEvent(sf::Event::KeyReleased, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	if (snapshot.isActive(Key::Jump) || snapshot.isJustPressed(Key::Jump)) return false;
+
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	return snapshot.isActive(Key::Jump) && snapshot.isJustPressed(Key::Jump);
+}
+
+bool InputSnapshotTest::testTapWithinFrame() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+
+	// pressed and released between two frames: active for exactly one frame
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	keyboard.handleEvent(keyEvent(sf::Event::KeyReleased, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	if (!snapshot.isActive(Key::Jump) || !snapshot.isJustPressed(Key::Jump)) return false;
+
+	nextFrame(keyboard, snapshot);
+	return !snapshot.isActive(Key::Jump) && !snapshot.isJustPressed(Key::Jump);
+}
+
+bool InputSnapshotTest::testPolledThisFrame() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+	nextFrame(keyboard, snapshot);
+
+	// the game loop polls the window events of frame N and takes the snapshot afterwards,
+	// so the screens updated in frame N already see the press.
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	if (!snapshot.isActive(Key::Jump) || !snapshot.isJustPressed(Key::Jump)) return false;
+
+	// the release of frame N + 1 is visible in frame N + 1 as well
+	keyboard.handleEvent(keyEvent(sf::Event::KeyReleased, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+	return !snapshot.isActive(Key::Jump);
+}
+
+bool InputSnapshotTest::testLostFocus() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Space));
+	nextFrame(keyboard, snapshot);
+
+	// the release event never arrives if the window loses focus
+	sf::Event e;
+	e.type = sf::Event::LostFocus;
+	keyboard.handleEvent(e);
+	nextFrame(keyboard, snapshot);
+	return !snapshot.isActive(Key::Jump) && !keyboard.isPressed(sf::Keyboard::Space);
+}
+
+bool InputSnapshotTest::testInvalidKeys() {
+	KeyboardState keyboard;
+	InputSnapshot snapshot;
+
+	keyboard.handleEvent(keyEvent(sf::Event::KeyPressed, sf::Keyboard::Unknown));
+	keyboard.snapshot();
+	if (keyboard.isPressed(sf::Keyboard::Unknown) || keyboard.isPressed(sf::Keyboard::KeyCount)) return false;
+
+	snapshot.update(Key::MAX, true);
+	return !snapshot.isActive(Key::MAX) && !snapshot.isJustPressed(Key::VOID);
+}
\ No newline at end of file
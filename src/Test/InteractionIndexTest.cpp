@@ -0,0 +1,93 @@
+#include "Test/InteractionIndexTest.h"
+#include "World/InteractionIndex.h"
+
+TestResult InteractionIndexTest::runTest() {
+	TestResult result;
+	result.testName = "InteractionIndexTest";
+
+	check(result, testNearest(), "nearest");
+	check(result, testHysteresis(), "hysteresis");
+	check(result, testDenseRoom(), "dense room");
+	check(result, testMoveAndRemove(), "move and remove");
+
+	return result;
+}
+
+bool InteractionIndexTest::testNearest() {
+	InteractionIndex index;
+	int chest = index.addObject(sf::Vector2f(100.f, 100.f), 80.f);
+	int sign = index.addObject(sf::Vector2f(200.f, 100.f), 50.f);
+	int npc = index.addObject(sf::Vector2f(-150.f, 100.f), 100.f);
+
+	if (index.getNearest(sf::Vector2f(120.f, 100.f), -1) != chest) return false;
+	// the sign is nearer, but the character is only in range of the chest
+	if (index.getNearest(sf::Vector2f(145.f, 100.f), -1) != chest) return false;
+	if (index.getNearest(sf::Vector2f(160.f, 100.f), -1) != sign) return false;
+	// the objects in the cells left of the origin are found as well
+	if (index.getNearest(sf::Vector2f(-80.f, 120.f), -1) != npc) return false;
+	if (index.getNearest(sf::Vector2f(40.f, 300.f), -1) != -1) return false;
+
+	// a disabled object, like an opened chest, is never the nearest
+	index.setEnabled(chest, false);
+	if (index.getNearest(sf::Vector2f(120.f, 100.f), -1) != -1) return false;
+	index.setEnabled(chest, true);
+	if (index.getNearest(sf::Vector2f(120.f, 100.f), -1) != chest) return false;
+
+	index.setRange(sign, 100.f);
+	return index.getNearest(sf::Vector2f(210.f, 170.f), -1) == sign;
+}
+
+bool InteractionIndexTest::testHysteresis() {
+	InteractionIndex index;
+	int left = index.addObject(sf::Vector2f(0.f, 0.f), 100.f);
+	int right = index.addObject(sf::Vector2f(100.f, 0.f), 100.f);
+
+	// equidistant objects are decided by their id
+	int focused = index.getNearest(sf::Vector2f(50.f, 0.f), -1);
+	if (focused != left) return false;
+
+	// the character walks to the right, the focus only moves once the other object is clearly nearer
+	for (float x = 50.f; x < 54.f; x += 0.5f) {
+		focused = index.getNearest(sf::Vector2f(x, 0.f), focused);
+		if (focused != left) return false;
+	}
+	focused = index.getNearest(sf::Vector2f(56.f, 0.f), focused);
+	if (focused != right) return false;
+
+	// and it doesn't flicker back when the character stands in the middle again
+	focused = index.getNearest(sf::Vector2f(50.f, 0.f), focused);
+	return focused == right;
+}
+
+bool InteractionIndexTest::testDenseRoom() {
+	InteractionIndex index;
+	// a treasure room with a chest every 25 pixels over 2000x2000 pixels
+	for (int y = 0; y < 80; ++y) {
+		for (int x = 0; x < 80; ++x) {
+			index.addObject(sf::Vector2f(x * 25.f, y * 25.f), 80.f);
+		}
+	}
+	int nearest = index.getNearest(sf::Vector2f(1005.f, 1005.f), -1);
+
+	// only the chests in the cells around the character are measured
+	return nearest == 40 * 80 + 40 && index.getTestedCount() <= 16 * 16 && index.getObjectCount() == 6400;
+}
+
+bool InteractionIndexTest::testMoveAndRemove() {
+	InteractionIndex index;
+	int npc = index.addObject(sf::Vector2f(0.f, 0.f), 100.f);
+	int door = index.addObject(sf::Vector2f(500.f, 0.f), 50.f);
+
+	if (index.getNearest(sf::Vector2f(480.f, 0.f), -1) != door) return false;
+
+	// the npc walks over to the door, into another cell
+	index.moveObject(npc, sf::Vector2f(470.f, 0.f));
+	if (index.getNearest(sf::Vector2f(480.f, 0.f), -1) != npc) return false;
+	if (index.getNearest(sf::Vector2f(0.f, 0.f), -1) != -1) return false;
+
+	// the npc is disposed, the focus goes back to the door
+	index.removeObject(npc);
+	index.moveObject(npc, sf::Vector2f(480.f, 0.f));
+	if (index.getNearest(sf::Vector2f(480.f, 0.f), npc) != door) return false;
+	return index.getObjectCount() == 1;
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "Test/InventorySlotGridTest.h"
+#include "GUI/InventorySlotGrid.h"
+#include "GUI/InventorySlot.h"
+#include "GUI/ButtonGroup.h"
+#include "GUI/SelectableWindow.h"
+#include "DatabaseManager.h"
+
+#include <algorithm>
+
+const int InventorySlotGridTest::COLUMNS = 5;
+const int InventorySlotGridTest::VISIBLE_ROWS = 3;
+const int InventorySlotGridTest::ITEM_COUNT = 40;
+
+static const float MARGIN = 4.f;
+
+// the grid only asks its window whether it is selected
+class SlotGridTestWindow final : public SelectableWindow {
+protected:
+	void updateWindowSelected() override {}
+};
+
+TestResult InventorySlotGridTest::runTest() {
+	TestResult result;
+	result.testName = "InventorySlotGridTest";
+
+	check(result, testScroll(), "scroll");
+	check(result, testScrollWhileDragging(), "scroll while dragging");
+	check(result, testRemoveWhileScrolledAway(), "remove while scrolled away");
+
+	return result;
+}
+
+std::vector<std::string> InventorySlotGridTest::getItemIDs() {
+	std::vector<std::string> itemIDs;
+	ResultSet rs = g_databaseManager->query("SELECT item_id FROM item ORDER BY item_id LIMIT " + std::to_string(ITEM_COUNT) + ";");
+	for (auto& row : rs) {
+		itemIDs.push_back(row[0]);
+	}
+	std::sort(itemIDs.begin(), itemIDs.end());
+	return itemIDs;
+}
+
+void InventorySlotGridTest::setItems(InventorySlotGrid& grid, const std::vector<std::string>& itemIDs) {
+	std::vector<SlotGridEntry> entries;
+	for (auto& itemID : itemIDs) {
+		entries.push_back({ itemID, 1 });
+	}
+	grid.setItems(entries);
+}
+
+void InventorySlotGridTest::scrollToRow(InventorySlotGrid& grid, int row) {
+	grid.calculateSlotPositions(sf::Vector2f(), row * (MARGIN + InventorySlot::SIZE));
+}
+
+int InventorySlotGridTest::getLastFirstIndex(int itemCount) {
+	const int liveSlots = (VISIBLE_ROWS + 2 * InventorySlotGrid::MARGIN_ROWS) * COLUMNS;
+	const int rows = (itemCount + COLUMNS - 1) / COLUMNS;
+	return std::max(0, rows * COLUMNS - liveSlots);
+}
+
+bool InventorySlotGridTest::isBoundInOrder(const InventorySlotGrid& grid, const std::vector<std::string>& itemIDs, int firstIndex) {
+	const auto& buttons = grid.getButtonGroup()->getButtons();
+	const int capacity = (VISIBLE_ROWS + 2 * InventorySlotGrid::MARGIN_ROWS) * COLUMNS;
+	if (static_cast<int>(buttons.size()) != std::min(capacity, static_cast<int>(itemIDs.size()) - firstIndex)) return false;
+
+	for (size_t i = 0; i < buttons.size(); ++i) {
+		const InventorySlot* slot = dynamic_cast<const InventorySlot*>(buttons[i]);
+		if (slot == nullptr || slot->getItemID() != itemIDs[firstIndex + i]) return false;
+		if (grid.getSlot(itemIDs[firstIndex + i]) != slot) return false;
+	}
+	return true;
+}
+
+bool InventorySlotGridTest::testScroll() {
+	std::vector<std::string> itemIDs = getItemIDs();
+	if (static_cast<int>(itemIDs.size()) < ITEM_COUNT) return false;
+
+	SlotGridTestWindow window;
+	InventorySlotGrid grid(COLUMNS, VISIBLE_ROWS, MARGIN, &window);
+	setItems(grid, itemIDs);
+
+	// the first bound row is one margin row above the visible ones, the last rows can't scroll further
+	const int lastFirstIndex = getLastFirstIndex(ITEM_COUNT);
+	for (int row : { 0, 1, 2, 3, 7, 2, 0 }) {
+		scrollToRow(grid, row);
+		int firstIndex = std::max(0, std::min(lastFirstIndex, (row - InventorySlotGrid::MARGIN_ROWS) * COLUMNS));
+		if (!isBoundInOrder(grid, itemIDs, firstIndex)) return false;
+		// items outside of the live rows have no slot
+		if (firstIndex > 0 && grid.getSlot(itemIDs[0]) != nullptr) return false;
+	}
+	return true;
+}
+
+bool InventorySlotGridTest::testScrollWhileDragging() {
+	std::vector<std::string> itemIDs = getItemIDs();
+	if (static_cast<int>(itemIDs.size()) < ITEM_COUNT) return false;
+
+	SlotGridTestWindow window;
+	InventorySlotGrid grid(COLUMNS, VISIBLE_ROWS, MARGIN, &window);
+	setItems(grid, itemIDs);
+	scrollToRow(grid, 0);
+
+	// select an item in the first row and start dragging it, like the inventory does
+	const std::string& draggedID = itemIDs[2];
+	InventorySlot* dragged = grid.getSlot(draggedID);
+	if (dragged == nullptr) return false;
+	grid.setSelectedItemID(draggedID);
+	dragged->select();
+	dragged->deactivate();
+
+	// scrolled out of view, the dragged slot keeps its item and the live slots show the other items
+	scrollToRow(grid, 7);
+	if (grid.getSlot(draggedID) != dragged || dragged->getItemID() != draggedID || dragged->isActive()) return false;
+	if (!isBoundInOrder(grid, itemIDs, getLastFirstIndex(ITEM_COUNT))) return false;
+	for (auto button : grid.getButtonGroup()->getButtons()) {
+		if (button == dragged) return false;
+	}
+
+	// scrolled back, it is live again at its place
+	scrollToRow(grid, 0);
+	if (!isBoundInOrder(grid, itemIDs, 0)) return false;
+	if (grid.getButtonGroup()->getButton(2) != dragged || dragged->isActive()) return false;
+
+	// dropped and deselected, it is rebound like any other slot
+	dragged->activate();
+	grid.setSelectedItemID("");
+	scrollToRow(grid, 7);
+	if (!isBoundInOrder(grid, itemIDs, getLastFirstIndex(ITEM_COUNT)) || grid.getSlot(draggedID) != nullptr) return false;
+	scrollToRow(grid, 0);
+	return isBoundInOrder(grid, itemIDs, 0);
+}
+
+bool InventorySlotGridTest::testRemoveWhileScrolledAway() {
+	std::vector<std::string> itemIDs = getItemIDs();
+	if (static_cast<int>(itemIDs.size()) < ITEM_COUNT) return false;
+
+	SlotGridTestWindow window;
+	InventorySlotGrid grid(COLUMNS, VISIBLE_ROWS, MARGIN, &window);
+	setItems(grid, itemIDs);
+	scrollToRow(grid, 0);
+
+	const std::string selectedID = itemIDs[3];
+	grid.setSelectedItemID(selectedID);
+	scrollToRow(grid, 7);
+	if (grid.getSlot(selectedID) == nullptr) return false;
+
+	// the item is used up while it is scrolled out of view
+	grid.removeItem(selectedID);
+	itemIDs.erase(itemIDs.begin() + 3);
+	if (grid.getSlot(selectedID) != nullptr) return false;
+	if (!isBoundInOrder(grid, itemIDs, getLastFirstIndex(static_cast<int>(itemIDs.size())))) return false;
+
+	scrollToRow(grid, 0);
+	return isBoundInOrder(grid, itemIDs, 0) && grid.getSlot(selectedID) == nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "Test/JobSystemTest.h"
+#include "Screens/LevelScreen.h"
+#include "Level/Enemy.h"
+#include "CharacterCore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+const std::string JobSystemTest::LEVEL_ID = "res/level/ratcave/ratcave.tmx";
+const sf::Vector2f JobSystemTest::LEVEL_POSITION = sf::Vector2f(535.f, 1210.f);
+
+static const int FRAME_COUNT = 300;
+static const sf::Time FRAME_TIME = sf::milliseconds(16);
+
+TestResult JobSystemTest::runTest() {
+	TestResult result;
+	result.testName = "JobSystemTest";
+
+	check(result, testAllJobs(), "all jobs");
+	check(result, testDeterministic(), "deterministic");
+
+	return result;
+}
+
+LevelScreen* JobSystemTest::loadLevel(CharacterCore* core, int workerCount) {
+	// the enemies draw their decision times from rand() when they load, both levels get the same ones
+	std::srand(0);
+	core->setLevel(LEVEL_POSITION, LEVEL_ID);
+	LevelScreen* screen = new LevelScreen(LEVEL_ID, core);
+	screen->loadAsync();
+	if (g_resourceManager->pollError()->first == ErrorID::VOID) {
+		screen->loadSync();
+		delete screen->m_jobSystem;
+		screen->m_jobSystem = new JobSystem(workerCount);
+
+		// enough enemies to think on the workers, a third of them fights for the main character
+		for (int i = 0; i < LevelScreen::MIN_PARALLEL_ENEMIES + 10; ++i) {
+			sf::Vector2f offset((i % 10) * 40.f - 200.f, -50.f * (i / 10));
+			Enemy* enemy = screen->spawnEnemy(EnemyID::Skeleton_Default, LEVEL_POSITION + offset);
+			if (enemy != nullptr && i % 3 == 0) {
+				enemy->setAlly(sf::seconds(60.f));
+			}
+		}
+	}
+
+	// adds the loaded and spawned objects to the screen, like the screen manager does
+	screen->onEnter();
+	return screen;
+}
+
+void JobSystemTest::unloadLevel(LevelScreen* screen) {
+	screen->onExit();
+	// the enemies only update themselves, so the objects they created in the last frames were never added
+	for (auto object : screen->getToAddObjects()) {
+		delete object;
+	}
+	screen->getToAddObjects().clear();
+	delete screen;
+}
+
+std::vector<int> JobSystemTest::getTargets(LevelScreen& screen) {
+	const std::vector<GameObject*>& enemies = *screen.getObjects(_Enemy);
+	std::vector<int> targets;
+	for (auto go : enemies) {
+		const LevelMovableGameObject* target = dynamic_cast<Enemy*>(go)->getCurrentTarget();
+		if (target == nullptr) {
+			targets.push_back(-1);
+		}
+		else if (target == screen.getMainCharacter()) {
+			targets.push_back(-2);
+		}
+		else {
+			targets.push_back(static_cast<int>(std::find(enemies.begin(), enemies.end(), target) - enemies.begin()));
+		}
+	}
+	return targets;
+}
+
+std::vector<sf::Vector2f> JobSystemTest::getPositions(LevelScreen& screen) {
+	std::vector<sf::Vector2f> positions;
+	for (auto go : *screen.getObjects(_Enemy)) {
+		positions.push_back(go->getPosition());
+	}
+	return positions;
+}
+
+bool JobSystemTest::testAllJobs() {
+	JobSystem jobSystem(3);
+	for (int count : { 0, 1, 2, 7, 64, 1000 }) {
+		// run it a few times, the workers must pick up every new range
+		for (int run = 0; run < 3; ++run) {
+			std::vector<std::atomic<int>> calls(count);
+			for (auto& call : calls) {
+				call = 0;
+			}
+			jobSystem.parallelFor(count, [&calls](int i) { ++calls[i]; });
+			for (auto& call : calls) {
+				if (call != 1) return false;
+			}
+		}
+	}
+	return jobSystem.getWorkerCount() == 3;
+}
+
+bool JobSystemTest::testDeterministic() {
+	CharacterCore* serialCore = new CharacterCore();
+	serialCore->loadNew();
+	CharacterCore* parallelCore = new CharacterCore();
+	parallelCore->loadNew();
+
+	LevelScreen* serial = loadLevel(serialCore, 0);
+	LevelScreen* parallel = loadLevel(parallelCore, 3);
+
+	bool isSame = g_resourceManager->pollError()->first == ErrorID::VOID;
+	bool isFighting = false;
+	for (int frame = 0; isSame && frame < FRAME_COUNT; ++frame) {
+		// the updates after thinking draw from rand(), both levels get the same numbers
+		std::srand(frame);
+		serial->updateEnemies(FRAME_TIME);
+		std::srand(frame);
+		parallel->updateEnemies(FRAME_TIME);
+
+		std::vector<int> targets = getTargets(*serial);
+		isSame = targets == getTargets(*parallel) && getPositions(*serial) == getPositions(*parallel);
+		for (int target : targets) {
+			isFighting = isFighting || target != -1;
+		}
+		if (!isSame) {
+			g_logger->logError("JobSystemTest", "The enemies differ on the workers in frame " + std::to_string(frame));
+		}
+	}
+
+	unloadLevel(serial);
+	unloadLevel(parallel);
+	delete serialCore;
+	delete parallelCore;
+
+	// the enemies must actually find targets
+	return isSame && isFighting;
+}
\ No newline at end of file
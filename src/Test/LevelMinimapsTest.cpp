@@ -0,0 +1,153 @@
+#include "Test/LevelMinimapsTest.h"
+#include "Structs/WorldData.h"
+#include "CharacterCore.h"
+
+#include <sstream>
+
+TestResult LevelMinimapsTest::runTest() {
+	TestResult result;
+	result.testName = "LevelMinimapsTest";
+
+	check(result, testRender(), "render");
+	check(result, testChecksums(), "checksums");
+	check(result, testReadWrite(), "read write");
+	check(result, testChangedLevel(), "changed level");
+	check(result, testBakedTable(), "baked table");
+
+	return result;
+}
+
+WorldData LevelMinimapsTest::createLevel() {
+	const std::vector<std::string> rows = {
+		"####",
+		"#..#",
+		"#.##"
+	};
+
+	WorldData data;
+	data.id = "res/level/test/test.tmx";
+	data.mapSize = sf::Vector2i(4, 3);
+	for (auto& row : rows) {
+		std::vector<bool> line;
+		for (char c : row) {
+			line.push_back(c == '#');
+		}
+		data.collidableTilePositions.push_back(line);
+	}
+	return data;
+}
+
+bool LevelMinimapsTest::testRender() {
+	WorldData data = createLevel();
+	std::vector<sf::Uint8> pixels;
+
+	// a scale of a tenth makes tiles of 5 pixels
+	sf::Vector2u size = LevelMinimaps::render(data, 0.1f, pixels);
+	if (size != sf::Vector2u(20, 15) || pixels.size() != 4 * 20 * 15) return false;
+
+	for (unsigned int y = 0; y < size.y; ++y) {
+		for (unsigned int x = 0; x < size.x; ++x) {
+			const sf::Uint8* pixel = &pixels[4 * (y * size.x + x)];
+			sf::Color color = data.collidableTilePositions[y / 5][x / 5] ? COLOR_BLACK : COLOR_TWILIGHT_INACTIVE;
+			if (pixel[0] != color.r || pixel[1] != color.g || pixel[2] != color.b || pixel[3] != color.a) return false;
+		}
+	}
+	return true;
+}
+
+bool LevelMinimapsTest::testChecksums() {
+	WorldData data = createLevel();
+	std::vector<sf::Uint8> pixels;
+	LevelMinimaps::render(data, 0.1f, pixels);
+	sf::Uint32 tilesChecksum = LevelMinimaps::getTilesChecksum(data);
+	sf::Uint32 imageChecksum = LevelMinimaps::getChecksum(pixels.data(), pixels.size());
+
+	// the same level gives the same checksums
+	std::vector<sf::Uint8> pixels2;
+	LevelMinimaps::render(createLevel(), 0.1f, pixels2);
+	if (LevelMinimaps::getTilesChecksum(createLevel()) != tilesChecksum) return false;
+	if (LevelMinimaps::getChecksum(pixels2.data(), pixels2.size()) != imageChecksum) return false;
+
+	// a single tile changes both of them
+	data.collidableTilePositions[2][2] = false;
+	LevelMinimaps::render(data, 0.1f, pixels2);
+	if (LevelMinimaps::getTilesChecksum(data) == tilesChecksum) return false;
+	if (LevelMinimaps::getChecksum(pixels2.data(), pixels2.size()) == imageChecksum) return false;
+
+	// and so does the size of the level
+	WorldData wider = createLevel();
+	wider.mapSize.x = 3;
+	return LevelMinimaps::getTilesChecksum(wider) != tilesChecksum;
+}
+
+bool LevelMinimapsTest::testReadWrite() {
+	WorldData data = createLevel();
+	LevelMinimap minimap;
+	minimap.imagePath = LevelMinimaps::getImagePath(data.id);
+	minimap.size = sf::Vector2u(20, 15);
+	minimap.tilesChecksum = LevelMinimaps::getTilesChecksum(data);
+	minimap.imageChecksum = 4000000000u;
+	if (minimap.imagePath != "res/level/test/test_minimap.png") return false;
+
+	LevelMinimaps minimaps;
+	minimaps.addMinimap(data.id, minimap);
+	std::stringstream stream;
+	minimaps.write(stream);
+
+	LevelMinimaps read;
+	if (!read.read(stream)) return false;
+	const LevelMinimap* readMinimap = read.getMinimap(data);
+	if (readMinimap == nullptr || readMinimap->imagePath != minimap.imagePath || readMinimap->size != minimap.size ||
+		readMinimap->tilesChecksum != minimap.tilesChecksum || readMinimap->imageChecksum != minimap.imageChecksum) return false;
+
+	// a broken table is not used at all
+	std::stringstream broken(stream.str() + "minimap,res/level/a/a.tmx,res/level/a/a_minimap.png,20,x,1,2\n");
+	return !read.read(broken) && read.getMinimaps().empty();
+}
+
+bool LevelMinimapsTest::testChangedLevel() {
+	WorldData data = createLevel();
+	LevelMinimap minimap;
+	minimap.imagePath = LevelMinimaps::getImagePath(data.id);
+	minimap.tilesChecksum = LevelMinimaps::getTilesChecksum(data);
+
+	LevelMinimaps minimaps;
+	minimaps.addMinimap(data.id, minimap);
+	if (minimaps.getMinimap(data) == nullptr) return false;
+
+	// a door opened by the game state or an edited level are rendered at runtime
+	data.collidableTilePositions[1][0] = false;
+	if (minimaps.getMinimap(data) != nullptr) return false;
+
+	// and so are levels that were never baked
+	WorldData other = createLevel();
+	other.id = "res/level/other/other.tmx";
+	return minimaps.getMinimap(other) == nullptr;
+}
+
+bool LevelMinimapsTest::testBakedTable() {
+	LevelMinimaps table;
+	if (!table.load(getResourcePath(LevelMinimaps::MINIMAPS_PATH))) return false;
+
+	// the minimap baker reads the levels on a new game, too
+	CharacterCore* core = new CharacterCore();
+	core->loadNew();
+
+	bool isValid = true;
+	size_t levelCount = 0;
+	for (auto& levelID : LevelMinimaps::getLevelIDs()) {
+		LevelMinimap minimap;
+		std::vector<sf::Uint8> pixels;
+		if (!LevelMinimaps::bake(levelID, core, minimap, pixels)) {
+			isValid = false;
+			continue;
+		}
+		if (minimap.imagePath.empty()) continue;
+		levelCount++;
+		if (!table.checkMinimap(levelID, minimap)) isValid = false;
+	}
+
+	delete core;
+	// the minimaps of removed levels are removed from the table, too
+	return isValid && levelCount == table.getMinimaps().size();
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "Test/LoadingPipelineTest.h"
+#include "World/LoadingPipeline.h"
+
+#include <thread>
+
+TestResult LoadingPipelineTest::runTest() {
+	TestResult result;
+	result.testName = "LoadingPipelineTest";
+
+	for (int workerCount : { 0, 3 }) {
+		const std::string workers = " (" + std::to_string(workerCount) + " workers)";
+		check(result, testStageOrder(workerCount), "stage order" + workers);
+		check(result, testFailedStage(workerCount), "failed stage" + workers);
+		check(result, testLoaderThread(workerCount), "loader thread" + workers);
+	}
+
+	return result;
+}
+
+bool LoadingPipelineTest::testStageOrder(int workerCount) {
+	LoadingPipeline pipeline("LoadingPipelineTest");
+	std::vector<std::vector<int>> dependencies;
+	std::vector<int> finishedStages;
+	std::mutex mutex;
+	bool isOrdered = true;
+
+	auto addStage = [&](const std::vector<int>& stageDependencies) {
+		int stage = static_cast<int>(dependencies.size());
+		dependencies.push_back(stageDependencies);
+		return pipeline.addStage("stage " + std::to_string(stage), [&, stage]() {
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				for (int dependency : dependencies[stage]) {
+					if (!contains(finishedStages, dependency)) isOrdered = false;
+				}
+			}
+			// give the other workers a chance to start stages too early
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			std::lock_guard<std::mutex> lock(mutex);
+			finishedStages.push_back(stage);
+			return true;
+		}, stageDependencies);
+	};
+
+	int read = addStage({});
+	int layers = addStage({ read });
+	int decode = addStage({ read });
+	int upload = addStage({ layers, decode });
+	int scripts = addStage({});
+	addStage({ scripts, upload });
+
+	if (!pipeline.run(workerCount)) return false;
+	for (int stage = 0; stage < static_cast<int>(dependencies.size()); ++stage) {
+		if (pipeline.getStageState(stage) != LoadingStageState::Done) return false;
+	}
+	return isOrdered && finishedStages.size() == dependencies.size();
+}
+
+bool LoadingPipelineTest::testFailedStage(int workerCount) {
+	LoadingPipeline pipeline("LoadingPipelineTest");
+	int read = pipeline.addStage("read", []() { return false; });
+	int layers = pipeline.addStage("layers", []() { return true; }, { read });
+	int upload = pipeline.addStage("upload", []() { return true; }, { layers });
+	int scripts = pipeline.addStage("scripts", []() { return true; });
+
+	if (pipeline.run(workerCount)) return false;
+	return pipeline.getStageState(read) == LoadingStageState::Failed
+		&& pipeline.getStageState(layers) == LoadingStageState::Skipped
+		&& pipeline.getStageState(upload) == LoadingStageState::Skipped
+		&& pipeline.getStageState(scripts) == LoadingStageState::Done;
+}
+
+bool LoadingPipelineTest::testLoaderThread(int workerCount) {
+	LoadingPipeline pipeline("LoadingPipelineTest");
+	const std::thread::id loaderThread = std::this_thread::get_id();
+	std::vector<std::thread::id> threads(8);
+
+	std::vector<int> decodeStages;
+	for (int i = 0; i < 4; ++i) {
+		decodeStages.push_back(pipeline.addStage("decode", [&threads, i]() {
+			threads[i] = std::this_thread::get_id();
+			return true;
+		}));
+	}
+	for (int i = 0; i < 4; ++i) {
+		pipeline.addStage("upload", [&threads, i]() {
+			threads[4 + i] = std::this_thread::get_id();
+			return true;
+		}, { decodeStages[i] }, true);
+	}
+
+	if (!pipeline.run(workerCount)) return false;
+	for (int i = 4; i < 8; ++i) {
+		if (threads[i] != loaderThread) return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "Test/MousePickerTest.h"
+#include "World/MousePicker.h"
+#include "World/GameObject.h"
+
+// the picker only looks at the bounding box and the flags of its objects
+class PickTestObject final : public GameObject {
+public:
+	PickTestObject(float x, float y, float size, bool isPickable = true) {
+		setBoundingBox(sf::FloatRect(0.f, 0.f, size, size));
+		setPosition(sf::Vector2f(x, y));
+		setMousePickable(isPickable);
+	}
+
+	GameObjectType getConfiguredType() const override { return _DynamicTile; }
+};
+
+TestResult MousePickerTest::runTest() {
+	TestResult result;
+	result.testName = "MousePickerTest";
+
+	check(result, testTopmost(), "topmost");
+	check(result, testNotPickable(), "not pickable");
+	check(result, testSkipped(), "skipped");
+	check(result, testMovedObject(), "moved object");
+	check(result, testMovedUnderMouse(), "moved under mouse");
+	check(result, testClicked(), "clicked");
+	check(result, testRemoved(), "removed");
+
+	return result;
+}
+
+bool MousePickerTest::testTopmost() {
+	PickTestObject tile1(0.f, 0.f, 100.f);
+	PickTestObject tile2(50.f, 50.f, 100.f);
+	PickTestObject enemy(80.f, 80.f, 50.f);
+	std::vector<GameObject*> tiles = { &tile1, &tile2 };
+	std::vector<GameObject*> enemies = { &enemy };
+
+	MousePicker picker;
+	picker.addLayer(_Enemy, &enemies);
+	picker.addLayer(_DynamicTile, &tiles);
+
+	// the upper layer wins, inside a layer the object rendered last
+	picker.update(sf::Vector2f(90.f, 90.f), true, false);
+	if (!picker.isPicked(&enemy) || picker.isPicked(&tile1) || picker.isPicked(&tile2)) return false;
+	picker.update(sf::Vector2f(60.f, 60.f), true, false);
+	if (!picker.isPicked(&tile2)) return false;
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&tile1)) return false;
+	picker.update(sf::Vector2f(300.f, 300.f), true, false);
+	if (picker.getPicked() != nullptr) return false;
+
+	// nothing is picked while the mouse is outside of the window
+	picker.update(sf::Vector2f(90.f, 90.f), false, false);
+	return picker.getPicked() == nullptr;
+}
+
+bool MousePickerTest::testNotPickable() {
+	PickTestObject chest(0.f, 0.f, 50.f);
+	PickTestObject torch(0.f, 0.f, 50.f, false);
+	PickTestObject sign(100.f, 0.f, 50.f);
+	std::vector<GameObject*> tiles = { &chest, &torch, &sign };
+	sign.setViewable(false);
+
+	MousePicker picker;
+	picker.addLayer(_DynamicTile, &tiles);
+
+	// objects that don't react to the mouse don't cover the ones behind them
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&chest)) return false;
+	picker.update(sf::Vector2f(110.f, 10.f), true, false);
+	if (picker.getPicked() != nullptr) return false;
+
+	chest.setDisposed();
+	picker.setDirty();
+	picker.update(sf::Vector2f(110.f, 10.f), true, false);
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	return picker.getPicked() == nullptr;
+}
+
+bool MousePickerTest::testSkipped() {
+	PickTestObject tile(0.f, 0.f, 100.f);
+	std::vector<GameObject*> tiles = { &tile };
+
+	MousePicker picker;
+	picker.addLayer(_DynamicTile, &tiles);
+
+	for (int i = 0; i < 10; ++i) {
+		picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	}
+	if (picker.getPassCount() != 1 || !picker.isPicked(&tile)) return false;
+
+	// a moved cursor or view moves the mouse in world coordinates
+	picker.update(sf::Vector2f(20.f, 10.f), true, false);
+	if (picker.getPassCount() != 2) return false;
+
+	// an added object could be under the resting mouse
+	PickTestObject enemy(0.f, 0.f, 50.f);
+	tiles.push_back(&enemy);
+	picker.setDirty();
+	picker.update(sf::Vector2f(20.f, 10.f), true, false);
+	picker.update(sf::Vector2f(20.f, 10.f), true, false);
+	return picker.getPassCount() == 3 && picker.isPicked(&enemy);
+}
+
+bool MousePickerTest::testMovedObject() {
+	PickTestObject tile(0.f, 0.f, 100.f);
+	PickTestObject enemy(0.f, 0.f, 50.f);
+	std::vector<GameObject*> tiles = { &tile };
+	std::vector<GameObject*> enemies = { &enemy };
+
+	MousePicker picker;
+	picker.addLayer(_Enemy, &enemies);
+	picker.addLayer(_DynamicTile, &tiles);
+
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&enemy)) return false;
+
+	// the picked enemy walks away from the resting mouse, the tile behind it is picked now
+	enemy.setPosition(sf::Vector2f(200.f, 0.f));
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	return picker.isPicked(&tile) && picker.getPassCount() == 2;
+}
+
+bool MousePickerTest::testMovedUnderMouse() {
+	PickTestObject tile(0.f, 0.f, 100.f);
+	PickTestObject enemy(200.f, 0.f, 50.f);
+	std::vector<GameObject*> tiles = { &tile };
+	std::vector<GameObject*> enemies = { &enemy };
+
+	MousePicker picker;
+	picker.addLayer(_Enemy, &enemies);
+	picker.addLayer(_DynamicTile, &tiles);
+	tile.setMousePicker(&picker);
+	enemy.setMousePicker(&picker);
+
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&tile)) return false;
+
+	// moves away from the mouse don't run a pass
+	enemy.setPosition(sf::Vector2f(300.f, 0.f));
+	tile.setPosition(sf::Vector2f(5.f, 0.f));
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (picker.getPassCount() != 1) return false;
+
+	// the enemy walks under the resting mouse and covers the tile
+	enemy.setPosition(sf::Vector2f(0.f, 0.f));
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	return picker.isPicked(&enemy) && picker.getPassCount() == 2;
+}
+
+bool MousePickerTest::testClicked() {
+	PickTestObject tile(0.f, 0.f, 100.f);
+	PickTestObject enemy(200.f, 0.f, 50.f);
+	std::vector<GameObject*> tiles = { &tile };
+	std::vector<GameObject*> enemies = { &enemy };
+
+	MousePicker picker;
+	picker.addLayer(_Enemy, &enemies);
+	picker.addLayer(_DynamicTile, &tiles);
+
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&tile)) return false;
+
+	// the enemy is moved without telling the picker, a click still finds it
+	enemy.setPosition(sf::Vector2f(0.f, 0.f));
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(&tile)) return false;
+	picker.update(sf::Vector2f(10.f, 10.f), true, true);
+	return picker.isPicked(&enemy) && picker.getPassCount() == 2;
+}
+
+bool MousePickerTest::testRemoved() {
+	PickTestObject tile(0.f, 0.f, 100.f);
+	PickTestObject* item = new PickTestObject(0.f, 0.f, 50.f);
+	std::vector<GameObject*> tiles = { &tile };
+	std::vector<GameObject*> items = { item };
+
+	MousePicker picker;
+	picker.addLayer(_LevelItem, &items);
+	picker.addLayer(_DynamicTile, &tiles);
+	if (!picker.hasLayer(_LevelItem) || picker.hasLayer(_Enemy)) return false;
+
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	if (!picker.isPicked(item)) return false;
+
+	// the picked item is looted and deleted by the screen
+	picker.removeObject(item);
+	items.clear();
+	delete item;
+	if (picker.getPicked() != nullptr) return false;
+
+	picker.update(sf::Vector2f(10.f, 10.f), true, false);
+	return picker.isPicked(&tile);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "Test/PathFinderTest.h"
+#include "Map/PathFinder.h"
+#include "FileIO/MapReader.h"
+#include "FileIO/ResourceFolder.h"
+#include "CharacterCore.h"
+
+#include <random>
+#include <queue>
+
+TestResult PathFinderTest::runTest() {
+	TestResult result;
+	result.testName = "PathFinderTest";
+
+	benchmarkMapFiles(result);
+
+	return result;
+}
+
+void PathFinderTest::benchmarkMapFiles(TestResult& result) {
+	CharacterCore* core = new CharacterCore();
+	core->loadNew();
+
+	for (auto& mapPath : ResourceFolder::findFiles("res/map", ".tmx")) {
+		MapReader reader;
+		MapData data;
+		if (!reader.readWorld(mapPath, data, core)) continue;
+
+		result.testsTotal++;
+		if (benchmarkMap(data, mapPath)) {
+			result.testsSucceeded++;
+		}
+	}
+
+	delete core;
+}
+
+bool PathFinderTest::benchmarkMap(const MapData& data, const std::string& mapPath) {
+	PathFinder pathFinder;
+	pathFinder.load(data, nullptr);
+
+	std::vector<sf::Vector2i> freeTiles;
+	for (int y = 0; y < data.mapSize.y; ++y) {
+		for (int x = 0; x < data.mapSize.x; ++x) {
+			if (!pathFinder.isBlocked(sf::Vector2i(x, y))) {
+				freeTiles.push_back(sf::Vector2i(x, y));
+			}
+		}
+	}
+	if (freeTiles.empty()) return true;
+
+	// deterministic queries, so the benchmark is comparable between runs
+	std::mt19937 random(42);
+	std::uniform_int_distribution<size_t> randomTile(0, freeTiles.size() - 1);
+	std::vector<uint64_t> keys;
+	std::vector<std::pair<sf::Vector2i, sf::Vector2i>> queries;
+	for (int i = 0; i < QUERY_COUNT; ++i) {
+		const sf::Vector2i& start = freeTiles[randomTile(random)];
+		const sf::Vector2i& goal = freeTiles[randomTile(random)];
+		keys.push_back(pathFinder.requestPath(PathFinder::toPosition(start), PathFinder::toPosition(goal)));
+		queries.push_back(std::make_pair(start, goal));
+	}
+
+	int maxFrameWork = 0;
+	int totalWork = 0;
+	int frames = 0;
+	while (pathFinder.getPendingSearchCount() > 0) {
+		pathFinder.update();
+		maxFrameWork = std::max(maxFrameWork, pathFinder.getLastUpdateWork());
+		totalWork += pathFinder.getLastUpdateWork();
+		frames++;
+	}
+
+	int found = 0;
+	bool isCorrect = true;
+	for (size_t i = 0; i < keys.size(); ++i) {
+		const sf::Vector2i& start = queries[i].first;
+		const sf::Vector2i& goal = queries[i].second;
+		const std::string query = mapPath + " (" + std::to_string(start.x) + "," + std::to_string(start.y) + ") -> (" +
+			std::to_string(goal.x) + "," + std::to_string(goal.y) + ")";
+
+		bool isFound = pathFinder.getPathState(keys[i]) == PathState::Found;
+		if (isFound) found++;
+		if (isFound != isReachable(pathFinder, start, goal)) {
+			g_logger->logError("[PathFinderTest]", "Path finder and breadth first search disagree on reachability: " + query);
+			isCorrect = false;
+		}
+		else if (isFound && !isValidPath(pathFinder, pathFinder.getWaypoints(keys[i]), start, goal)) {
+			g_logger->logError("[PathFinderTest]", "Invalid path: " + query);
+			isCorrect = false;
+		}
+	}
+
+	g_logger->logInfo("[PathFinderTest]", mapPath + ": " + std::to_string(found) + " / " + std::to_string(QUERY_COUNT) +
+		" paths found in " + std::to_string(frames) + " frames, " + std::to_string(totalWork) + " steps total, max " +
+		std::to_string(maxFrameWork) + " steps per frame.");
+
+	// an update stops after the node that uses up its budget, whose jumps cross the map at most twice per direction
+	const int maxWork = PathFinder::SEARCH_BUDGET + 4 * (data.mapSize.x + data.mapSize.y);
+	if (maxFrameWork > maxWork) {
+		g_logger->logError("[PathFinderTest]", "Search budget exceeded: " + mapPath + " (" + std::to_string(maxFrameWork) +
+			" > " + std::to_string(maxWork) + " steps)");
+		return false;
+	}
+	return isCorrect;
+}
+
+bool PathFinderTest::isValidPath(const PathFinder& pathFinder, const std::vector<sf::Vector2i>* waypoints,
+	const sf::Vector2i& start, const sf::Vector2i& goal) {
+	if (waypoints == nullptr || waypoints->empty()) return false;
+	if (waypoints->front() != start || waypoints->back() != goal) return false;
+	if (pathFinder.isBlocked(start)) return false;
+
+	// the path finder moves along the axes only, so consecutive waypoints share a row or a column
+	// and a step can never cut a blocked corner.
+	for (size_t i = 1; i < waypoints->size(); ++i) {
+		sf::Vector2i tile = (*waypoints)[i - 1];
+		const sf::Vector2i& next = (*waypoints)[i];
+		if (tile.x != next.x && tile.y != next.y) return false;
+
+		sf::Vector2i step((next.x > tile.x) - (next.x < tile.x), (next.y > tile.y) - (next.y < tile.y));
+		while (tile != next) {
+			tile += step;
+			if (pathFinder.isBlocked(tile)) return false;
+		}
+	}
+	return true;
+}
+
+bool PathFinderTest::isReachable(const PathFinder& pathFinder, const sf::Vector2i& start, const sf::Vector2i& goal) {
+	if (pathFinder.isBlocked(start) || pathFinder.isBlocked(goal)) return false;
+
+	std::set<std::pair<int, int>> visited;
+	std::queue<sf::Vector2i> open;
+	visited.insert(std::make_pair(start.x, start.y));
+	open.push(start);
+
+	const sf::Vector2i directions[] = { sf::Vector2i(1, 0), sf::Vector2i(-1, 0), sf::Vector2i(0, 1), sf::Vector2i(0, -1) };
+	while (!open.empty()) {
+		sf::Vector2i tile = open.front();
+		open.pop();
+		if (tile == goal) return true;
+
+		for (auto& direction : directions) {
+			sf::Vector2i next = tile + direction;
+			if (pathFinder.isBlocked(next)) continue;
+			if (!visited.insert(std::make_pair(next.x, next.y)).second) continue;
+			open.push(next);
+		}
+	}
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include "Test/SaveGameIndexTest.h"
+#include "FileIO/CharacterCoreWriter.h"
+#include "Logger.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+const int SaveGameIndexTest::SAVE_COUNT = 100;
+
+inline std::string getIndexFilename() {
+	return getDocumentsPath("savegameindextest.index");
+}
+
+TestResult SaveGameIndexTest::runTest() {
+	TestResult result;
+	result.testName = "SaveGameIndexTest";
+
+	writeSaves();
+	check(result, testHeaders(), "headers");
+	check(result, testIndexed(), "indexed");
+	check(result, testChanged(), "changed");
+	check(result, testTampered(), "tampered");
+	check(result, testLegacy(), "legacy");
+	removeSaves();
+
+	return result;
+}
+
+CharacterCoreData SaveGameIndexTest::createData(int nr) {
+	CharacterCoreData data;
+	data.saveGameName = "Save, " + std::to_string(nr);
+	data.dateSaved = 1500000000 + nr;
+	// short enough to be stored exactly in float seconds
+	data.timePlayed = sf::milliseconds(1000 * (600 + nr));
+	data.hashValid = nr % 10 != 0;
+	data.isInLevel = nr % 2 == 0;
+	data.currentLevel = "res/level/testlevel" + std::to_string(nr) + "/testlevel.tmx";
+	data.currentMap = "res/map/testmap/testmap.tmx";
+	for (ItemType type = ItemType::Equipment_head; type <= ItemType::Equipment_back; type = static_cast<ItemType>((int)type + 1)) {
+		data.equippedItems.insert({ type, "" });
+	}
+
+	// a late game save, much larger than its header
+	for (int level = 0; level < 20; ++level) {
+		std::set<int>& enemies = data.enemiesKilled["res/level/level" + std::to_string(level) + "/level.tmx"];
+		for (int i = 0; i < 200; ++i) {
+			enemies.insert(i * 3 + nr);
+		}
+	}
+	return data;
+}
+
+std::string SaveGameIndexTest::getSaveFilename(int nr) {
+	return getDocumentsPath("savegameindextest_" + std::to_string(nr) + ".sav");
+}
+
+bool SaveGameIndexTest::isSameHeader(const SaveGameHeader& header, const CharacterCoreData& data) {
+	return header.saveGameName == data.saveGameName &&
+		header.location == (data.isInLevel ? data.currentLevel : data.currentMap) &&
+		header.dateSaved == data.dateSaved &&
+		// saves only keep whole seconds
+		std::lround(header.timePlayed.asSeconds()) == std::lround(data.timePlayed.asSeconds()) &&
+		header.hashValid == data.hashValid;
+}
+
+void SaveGameIndexTest::writeSaves() {
+	CharacterCoreWriter writer;
+	for (int nr = 0; nr < SAVE_COUNT; ++nr) {
+		std::string filename = getSaveFilename(nr);
+		writer.saveToFile(filename, createData(nr));
+		m_filenames.push_back(filename);
+
+		std::ifstream file(filename, std::ios::binary | std::ios::ate);
+		m_totalSize += static_cast<long long>(file.tellg());
+	}
+	std::remove(getIndexFilename().c_str());
+}
+
+void SaveGameIndexTest::removeSaves() {
+	for (auto& filename : m_filenames) {
+		std::remove(filename.c_str());
+	}
+	std::remove(getIndexFilename().c_str());
+}
+
+bool SaveGameIndexTest::testHeaders() {
+	SaveGameIndex index(getIndexFilename());
+	std::vector<SaveGameHeader> headers;
+	sf::Clock clock;
+	index.listSaves(m_filenames, headers);
+	g_logger->logInfo("SaveGameIndexTest", "Listed " + std::to_string(SAVE_COUNT) + " saves with " +
+		std::to_string(m_totalSize) + " bytes by reading " + std::to_string(index.getBytesRead()) + " bytes in " +
+		std::to_string(clock.getElapsedTime().asMicroseconds()) + " us.");
+
+	// new saves are read once to check their hashes, but they are not parsed
+	if (static_cast<int>(headers.size()) != SAVE_COUNT) return false;
+	if (index.getHeaderCount() != SAVE_COUNT || index.getParsedCount() != 0) return false;
+
+	for (int nr = 0; nr < SAVE_COUNT; ++nr) {
+		if (headers[nr].filename != m_filenames[nr]) return false;
+		if (!isSameHeader(headers[nr], createData(nr))) return false;
+	}
+	return true;
+}
+
+bool SaveGameIndexTest::testIndexed() {
+	SaveGameIndex index(getIndexFilename());
+	std::vector<SaveGameHeader> headers;
+	index.listSaves(m_filenames, headers);
+
+	if (static_cast<int>(headers.size()) != SAVE_COUNT) return false;
+	if (index.getCachedCount() != SAVE_COUNT) return false;
+	// only the first lines holding the hash are read, the cost doesn't depend on the size of the saves
+	if (index.getBytesRead() > SAVE_COUNT * SaveGameIndex::HEADER_BLOCK_SIZE) return false;
+	if (index.getBytesRead() * 10 > m_totalSize) return false;
+	for (int nr = 0; nr < SAVE_COUNT; ++nr) {
+		if (!isSameHeader(headers[nr], createData(nr))) return false;
+	}
+	return true;
+}
+
+bool SaveGameIndexTest::testChanged() {
+	// a quicksave within the same second with the same size, only the hash tells it apart
+	CharacterCoreData data = createData(7);
+	data.saveGameName = "Evas, 7";
+	CharacterCoreWriter writer;
+	writer.saveToFile(m_filenames[7], data);
+
+	SaveGameIndex index(getIndexFilename());
+	std::vector<SaveGameHeader> headers;
+	index.listSaves(m_filenames, headers);
+
+	if (static_cast<int>(headers.size()) != SAVE_COUNT) return false;
+	if (index.getCachedCount() != SAVE_COUNT - 1 || index.getHeaderCount() != 1) return false;
+	return isSameHeader(headers[7], data);
+}
+
+bool SaveGameIndexTest::testTampered() {
+	// a save edited by hand keeps its header and hash line
+	const std::string& filename = m_filenames[3];
+	std::string text;
+	{
+		std::ifstream file(filename);
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		text = buffer.str();
+	}
+	const std::string name = "savegame.name:Save, 3";
+	size_t namePos = text.find(name);
+	if (namePos == std::string::npos) return false;
+	text.replace(namePos, name.size(), "savegame.name:Evil, 3");
+	std::ofstream(filename, std::ios::trunc) << text;
+
+	SaveGameIndex index(getIndexFilename());
+	SaveGameHeader header;
+	return index.readHeader(filename, header) && header.saveGameName == "Save, 3" && !header.hashValid;
+}
+
+bool SaveGameIndexTest::testLegacy() {
+	// a save written before the header existed
+	CharacterCoreData data = createData(SAVE_COUNT);
+	std::string filename = getSaveFilename(SAVE_COUNT);
+	CharacterCoreWriter writer;
+	writer.saveToFile(filename, data);
+	m_filenames.push_back(filename);
+
+	std::stringstream legacy;
+	{
+		std::ifstream file(filename);
+		std::string line;
+		while (std::getline(file, line)) {
+			if (line.compare(0, 17, "# savegame.header") == 0) continue;
+			legacy << line << "\n";
+		}
+	}
+	std::ofstream(filename, std::ios::trunc) << legacy.str();
+
+	SaveGameIndex index(getIndexFilename());
+	SaveGameHeader header;
+	if (index.readHeader(filename, header)) return false;
+
+	std::vector<SaveGameHeader> headers;
+	index.listSaves(m_filenames, headers);
+	if (static_cast<int>(headers.size()) != SAVE_COUNT + 1 || index.getParsedCount() != 1) return false;
+
+	// the body doesn't match its hash anymore and the location is stored after the attributes that are parsed
+	data.hashValid = false;
+	data.currentLevel.clear();
+	data.currentMap.clear();
+	return isSameHeader(headers[SAVE_COUNT], data);
+}
\ No newline at end of file
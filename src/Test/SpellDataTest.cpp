@@ -0,0 +1,84 @@
+#include "Test/SpellDataTest.h"
+#include "Structs/SpellData.h"
+#include "Logger.h"
+
+TestResult SpellDataTest::runTest() {
+	TestResult result;
+	result.testName = "SpellDataTest";
+
+	checkSpellTable(result);
+	checkUnknownIds(result);
+
+	return result;
+}
+
+void SpellDataTest::checkSpellTable(TestResult& result) {
+	for (int i = static_cast<int>(SpellID::VOID) + 1; i < static_cast<int>(SpellID::MAX); ++i) {
+		SpellID id = static_cast<SpellID>(i);
+		const SpellData& data = SpellData::getSpellData(id);
+
+		// spells without a definition (e.g. transform beam) are configured by their users.
+		if (data.id == SpellID::VOID) continue;
+
+		result.testsTotal++;
+		if (checkSpellData(data, id) && checkAllowedModifiers(id)) {
+			result.testsSucceeded++;
+		}
+	}
+}
+
+bool SpellDataTest::checkSpellData(const SpellData& data, SpellID id) {
+	std::string name = "spell " + std::to_string(static_cast<int>(id));
+	if (data.id != id) {
+		g_logger->logError("[SpellDataTest]", name + " is stored at the index of spell " + std::to_string(static_cast<int>(data.id)));
+		return false;
+	}
+	if (&SpellData::getSpellData(id) != &data) {
+		g_logger->logError("[SpellDataTest]", name + " does not return a stable reference into the spell table");
+		return false;
+	}
+	if (data.cooldown <= sf::Time::Zero) {
+		g_logger->logError("[SpellDataTest]", name + " has no cooldown");
+		return false;
+	}
+	if (data.boundingBox.width < 0.f || data.boundingBox.height < 0.f) {
+		g_logger->logError("[SpellDataTest]", name + " has a negative bounding box");
+		return false;
+	}
+	if (data.range < 0.f || data.speed < 0.f || data.count < 1) {
+		g_logger->logError("[SpellDataTest]", name + " has a negative range, speed or count");
+		return false;
+	}
+	if (data.activeDuration < sf::Time::Zero || data.duration < sf::Time::Zero || data.castingTime < sf::Time::Zero) {
+		g_logger->logError("[SpellDataTest]", name + " has a negative duration");
+		return false;
+	}
+	if (data.damageType < DamageType::VOID || data.damageType >= DamageType::MAX) {
+		g_logger->logError("[SpellDataTest]", name + " has an invalid damage type");
+		return false;
+	}
+	return true;
+}
+
+bool SpellDataTest::checkAllowedModifiers(SpellID id) {
+	const std::vector<SpellModifierType>& types = SpellData::getAllowedModifiers(id);
+	for (size_t i = 0; i < types.size(); ++i) {
+		if (types[i] <= SpellModifierType::VOID || types[i] >= SpellModifierType::MAX ||
+			std::count(types.begin(), types.end(), types[i]) > 1) {
+			g_logger->logError("[SpellDataTest]", "spell " + std::to_string(static_cast<int>(id)) + " has an invalid or duplicate allowed modifier");
+			return false;
+		}
+	}
+	return true;
+}
+
+void SpellDataTest::checkUnknownIds(TestResult& result) {
+	result.testsTotal++;
+	if (SpellData::getSpellData(SpellID::VOID).id == SpellID::VOID &&
+		SpellData::getSpellData(SpellID::MAX).id == SpellID::VOID &&
+		SpellData::getAllowedModifiers(SpellID::MAX).empty()) {
+		result.testsSucceeded++;
+		return;
+	}
+	g_logger->logError("[SpellDataTest]", "unknown spell ids do not return the default spell data");
+}
\ No newline at end of file
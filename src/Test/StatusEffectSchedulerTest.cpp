@@ -0,0 +1,108 @@
+#include "Test/StatusEffectSchedulerTest.h"
+
+TestResult StatusEffectSchedulerTest::runTest() {
+	TestResult result;
+	result.testName = "StatusEffectSchedulerTest";
+
+	check(result, testExact(), "exact");
+	check(result, testOrder(), "order");
+	check(result, testFarEvents(), "far events");
+	check(result, testTicks(), "ticks");
+
+	return result;
+}
+
+std::vector<StatusEffectEvent> StatusEffectSchedulerTest::run(StatusEffectScheduler& scheduler, const sf::Time& time, int tickID, int& touched) {
+	std::vector<StatusEffectEvent> events;
+	touched = 0;
+	sf::Time frameTime = sf::microseconds(16667);
+	for (sf::Time t = sf::Time::Zero; t < time; t += frameTime) {
+		scheduler.update(frameTime);
+		touched += scheduler.getTouchedCount();
+		StatusEffectEvent event;
+		while (scheduler.popDue(event)) {
+			// an event can only come due after its time
+			if (event.due > scheduler.getTime()) return std::vector<StatusEffectEvent>();
+			events.push_back(event);
+			if (event.id == tickID) {
+				scheduler.schedule(tickID, event.due + sf::seconds(1.f));
+			}
+		}
+	}
+	return events;
+}
+
+bool StatusEffectSchedulerTest::testExact() {
+	StatusEffectScheduler scheduler;
+	scheduler.schedule(0, sf::milliseconds(2500));
+	scheduler.schedule(1, sf::milliseconds(500));
+
+	int touched;
+	std::vector<StatusEffectEvent> events = run(scheduler, sf::seconds(1.f), -1, touched);
+	if (events.size() != 1 || events[0].id != 1 || events[0].due != sf::milliseconds(500)) return false;
+
+	// the remaining event doesn't come due early, and only once
+	events = run(scheduler, sf::seconds(1.f), -1, touched);
+	if (!events.empty() || scheduler.getEventCount() != 1) return false;
+	events = run(scheduler, sf::seconds(2.f), -1, touched);
+	return events.size() == 1 && events[0].id == 0 && scheduler.isEmpty();
+}
+
+bool StatusEffectSchedulerTest::testOrder() {
+	StatusEffectScheduler scheduler;
+	scheduler.schedule(0, sf::milliseconds(300));
+	scheduler.schedule(1, sf::milliseconds(100));
+	scheduler.schedule(2, sf::milliseconds(300));
+	scheduler.schedule(3, sf::milliseconds(200));
+
+	// one long frame, the events are popped by due time and then by the order they were scheduled
+	scheduler.update(sf::seconds(1.f));
+	std::vector<int> ids;
+	StatusEffectEvent event;
+	while (scheduler.popDue(event)) {
+		ids.push_back(event.id);
+		// events scheduled in the past are due in the same frame
+		if (event.id == 1) scheduler.schedule(4, event.due + sf::milliseconds(150));
+	}
+	return ids == std::vector<int>({ 1, 3, 4, 0, 2 });
+}
+
+bool StatusEffectSchedulerTest::testFarEvents() {
+	StatusEffectScheduler scheduler;
+	// more than one turn of the wheel away
+	for (int i = 0; i < 100; ++i) {
+		scheduler.schedule(i, sf::seconds(10.f));
+	}
+
+	int touched;
+	std::vector<StatusEffectEvent> events = run(scheduler, sf::seconds(9.9f), -1, touched);
+	if (!events.empty()) return false;
+	// looking at every event in every frame would have touched them 600 times
+	if (touched > 4 * 100) return false;
+
+	events = run(scheduler, sf::milliseconds(200), -1, touched);
+	if (events.size() != 100) return false;
+	for (int i = 0; i < 100; ++i) {
+		if (events[i].id != i || events[i].due != sf::seconds(10.f)) return false;
+	}
+	return scheduler.isEmpty();
+}
+
+bool StatusEffectSchedulerTest::testTicks() {
+	StatusEffectScheduler scheduler;
+	scheduler.schedule(7, sf::seconds(1.f));
+	scheduler.schedule(8, sf::milliseconds(3500));
+
+	// a dot ticking every second, rescheduled from its due time, never drifts
+	int touched;
+	std::vector<StatusEffectEvent> events = run(scheduler, sf::milliseconds(4500), 7, touched);
+	std::vector<sf::Time> ticks;
+	for (auto& event : events) {
+		if (event.id == 7) ticks.push_back(event.due);
+	}
+	if (ticks.size() != 4) return false;
+	for (size_t i = 0; i < ticks.size(); ++i) {
+		if (ticks[i] != sf::seconds(static_cast<float>(i + 1))) return false;
+	}
+	return events.size() == 5 && events[3].id == 8;
+}
\ No newline at end of file
@@ -1 +1,12 @@
 #include "Test/Test.h"
+
+#include "Logger.h"
+
+void Test::check(TestResult& result, bool success, const std::string& name) {
+	result.testsTotal++;
+	if (success) {
+		result.testsSucceeded++;
+		return;
+	}
+	g_logger->logError("[" + result.testName + "]", "Test failed: " + name);
+}
@@ -0,0 +1,111 @@
+#include "Test/TileSimulationTest.h"
+
+TestResult TileSimulationTest::runTest() {
+	TestResult result;
+	result.testName = "TileSimulationTest";
+
+	check(result, testClock(), "clock");
+	check(result, testBackAndForth(), "back and forth");
+	check(result, testPendulum(), "pendulum");
+	check(result, testCatchUp(), "catch up");
+
+	return result;
+}
+
+std::vector<sf::Time> TileSimulationTest::getFrameTimes(int count) {
+	std::vector<sf::Time> frameTimes;
+	for (int i = 0; i < count; ++i) {
+		frameTimes.push_back(sf::microseconds(10000 + (i * 7919) % 30000));
+	}
+	return frameTimes;
+}
+
+bool TileSimulationTest::testClock() {
+	SimulationClock clock;
+	sf::Time total;
+	sf::Time advanced;
+	int ticks = 0;
+
+	// far from the main character, the time is only handed out every tick time, but none of it is lost
+	for (auto& frameTime : getFrameTimes(100)) {
+		total += frameTime;
+		sf::Time time = clock.tick(frameTime, true);
+		if (time == sf::Time::Zero) continue;
+		if (time < SimulationClock::OFFSCREEN_TICK_TIME) return false;
+		advanced += time;
+		ticks++;
+	}
+	if (ticks == 0 || ticks > static_cast<int>(total / SimulationClock::OFFSCREEN_TICK_TIME)) return false;
+
+	// and near it, the tile catches up at once and is advanced every frame from then on
+	advanced += clock.tick(sf::milliseconds(16), false);
+	total += sf::milliseconds(16);
+	if (advanced != total) return false;
+	return clock.tick(sf::milliseconds(16), false) == sf::milliseconds(16);
+}
+
+bool TileSimulationTest::testBackAndForth() {
+	BackAndForthMotion motion;
+	motion.setDistanceTime(sf::seconds(2.f));
+
+	// forth for two seconds, then back
+	float offset = motion.advance(sf::seconds(1.5f));
+	if (std::abs(offset - 1.5f) > 0.001f || motion.isBack()) return false;
+	offset += motion.advance(sf::seconds(1.f));
+	if (std::abs(offset - 1.5f) > 0.001f || !motion.isBack()) return false;
+
+	// a full round trip ends where it started
+	offset += motion.advance(sf::seconds(4.f));
+	if (std::abs(offset - 1.5f) > 0.001f || !motion.isBack()) return false;
+
+	// the moving tile is placed at the offset, so it has to be where the steps add up to
+	if (std::abs(motion.getOffset() - offset) > 0.001f) return false;
+	offset += motion.advance(sf::seconds(1.5f));
+	return std::abs(offset) < 0.001f && !motion.isBack();
+}
+
+bool TileSimulationTest::testPendulum() {
+	PendulumMotion everyFrame;
+	PendulumMotion once;
+	everyFrame.init(60.f, 2.f);
+	once.init(60.f, 2.f);
+
+	sf::Time total;
+	float rotation = 0.f;
+	for (auto& frameTime : getFrameTimes(500)) {
+		total += frameTime;
+		rotation = everyFrame.advance(frameTime);
+	}
+
+	// the same fixed steps are integrated, so the rotations are the same to the bit
+	return rotation == once.advance(total) && rotation != 60.f;
+}
+
+bool TileSimulationTest::testCatchUp() {
+	// a moving tile that is updated every frame, and one that is far from the main character for most of the frames
+	BackAndForthMotion fullMotion;
+	BackAndForthMotion lodMotion;
+	fullMotion.setDistanceTime(sf::milliseconds(1700));
+	lodMotion.setDistanceTime(sf::milliseconds(1700));
+	SimulationClock clock;
+
+	float fullOffset = 0.f;
+	float lodOffset = 0.f;
+	int lodUpdates = 0;
+	std::vector<sf::Time> frameTimes = getFrameTimes(1000);
+	for (size_t i = 0; i < frameTimes.size(); ++i) {
+		fullOffset += fullMotion.advance(frameTimes[i]);
+
+		bool isFar = i % 400 < 300;
+		sf::Time time = clock.tick(frameTimes[i], isFar);
+		if (time == sf::Time::Zero) continue;
+		lodOffset += lodMotion.advance(time);
+		lodUpdates++;
+
+		// whenever the tile near the main character is advanced, it is where the other one is
+		if (!isFar && (std::abs(lodOffset - fullOffset) > 0.001f || lodMotion.isBack() != fullMotion.isBack())) return false;
+	}
+
+	// and it was advanced far less often
+	return lodUpdates < static_cast<int>(frameTimes.size()) / 2;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "Test/TriggerIndexTest.h"
+#include "World/TriggerIndex.h"
+
+inline Condition condition(const std::string& type, const std::string& name, bool negative = false) {
+	Condition c;
+	c.type = type;
+	c.name = name;
+	c.negative = negative;
+	return c;
+}
+
+inline bool isEvent(const std::vector<TriggerEvent>& events, size_t index, TriggerEventType type, int trigger) {
+	return index < events.size() && events[index].type == type && events[index].trigger == trigger;
+}
+
+// updates the index with a character box of 20x50 at this position and returns the events
+inline std::vector<TriggerEvent> moveTo(TriggerIndex& index, float x, float y) {
+	std::vector<TriggerEvent> events;
+	index.update(sf::FloatRect(x, y, 20.f, 50.f), events);
+	return events;
+}
+
+TestResult TriggerIndexTest::runTest() {
+	TestResult result;
+	result.testName = "TriggerIndexTest";
+
+	check(result, testEnterStayExit(), "enter, stay and exit");
+	check(result, testSpawnOnTrigger(), "spawn on trigger");
+	check(result, testLargeTrigger(), "large trigger");
+	check(result, testRemove(), "remove");
+	check(result, testConditions(), "conditions");
+
+	return result;
+}
+
+bool TriggerIndexTest::testEnterStayExit() {
+	TriggerIndex index;
+	int a = index.addTrigger(sf::FloatRect(100.f, 0.f, 50.f, 100.f), std::vector<Condition>());
+	int b = index.addTrigger(sf::FloatRect(140.f, 0.f, 50.f, 100.f), std::vector<Condition>());
+
+	if (!moveTo(index, 0.f, 0.f).empty()) return false;
+
+	auto events = moveTo(index, 90.f, 0.f);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Enter, a)) return false;
+
+	events = moveTo(index, 125.f, 0.f);
+	if (events.size() != 2 || !isEvent(events, 0, TriggerEventType::Stay, a) || !isEvent(events, 1, TriggerEventType::Enter, b)) return false;
+	if (!index.isOverlapped(a) || !index.isOverlapped(b)) return false;
+
+	// touching edges don't overlap
+	events = moveTo(index, 150.f, 0.f);
+	if (events.size() != 2 || !isEvent(events, 0, TriggerEventType::Exit, a) || !isEvent(events, 1, TriggerEventType::Stay, b)) return false;
+
+	events = moveTo(index, 500.f, 0.f);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Exit, b)) return false;
+	return moveTo(index, 500.f, 0.f).empty();
+}
+
+bool TriggerIndexTest::testSpawnOnTrigger() {
+	TriggerIndex index;
+	int a = index.addTrigger(sf::FloatRect(0.f, 0.f, 50.f, 50.f), std::vector<Condition>());
+
+	auto events = moveTo(index, 10.f, 10.f);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Stay, a)) return false;
+
+	events = moveTo(index, 100.f, 10.f);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Exit, a)) return false;
+
+	events = moveTo(index, 10.f, 10.f);
+	return events.size() == 1 && isEvent(events, 0, TriggerEventType::Enter, a);
+}
+
+bool TriggerIndexTest::testLargeTrigger() {
+	TriggerIndex index;
+	// spans many cells and negative coordinates, but must only be reported once
+	float size = 10.f * TriggerIndex::CELL_SIZE;
+	int a = index.addTrigger(sf::FloatRect(-size, -size, 2.f * size, 2.f * size), std::vector<Condition>());
+	int b = index.addTrigger(sf::FloatRect(3.f * size, 0.f, 10.f, 10.f), std::vector<Condition>());
+
+	sf::FloatRect box(-TriggerIndex::CELL_SIZE, -10.f, 2.f * TriggerIndex::CELL_SIZE, 20.f);
+	std::vector<TriggerEvent> events;
+	index.update(box, events);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Stay, a)) return false;
+
+	events.clear();
+	index.update(box, events);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Stay, a)) return false;
+
+	events = moveTo(index, 3.f * size - 5.f, -5.f);
+	return events.size() == 2 && isEvent(events, 0, TriggerEventType::Exit, a) && isEvent(events, 1, TriggerEventType::Enter, b);
+}
+
+bool TriggerIndexTest::testRemove() {
+	TriggerIndex index;
+	int a = index.addTrigger(sf::FloatRect(100.f, 0.f, 50.f, 100.f), std::vector<Condition>());
+	int b = index.addTrigger(sf::FloatRect(100.f, 0.f, 50.f, 100.f), std::vector<Condition>());
+
+	moveTo(index, 0.f, 0.f);
+	auto events = moveTo(index, 110.f, 0.f);
+	if (events.size() != 2) return false;
+
+	// a removed trigger doesn't even get an exit event
+	index.removeTrigger(a);
+	if (index.isOverlapped(a)) return false;
+	events = moveTo(index, 110.f, 0.f);
+	if (events.size() != 1 || !isEvent(events, 0, TriggerEventType::Stay, b)) return false;
+
+	events = moveTo(index, 0.f, 0.f);
+	return events.size() == 1 && isEvent(events, 0, TriggerEventType::Exit, b);
+}
+
+bool TriggerIndexTest::testConditions() {
+	TriggerIndex index;
+	int a = index.addTrigger(sf::FloatRect(), { condition("default", "door_open"), condition("boss", "BossVelius") });
+	int b = index.addTrigger(sf::FloatRect(), { condition("default", "door_open", true) });
+	index.addTrigger(sf::FloatRect(), { condition("default", "door_closed") });
+
+	const std::vector<int>& doorOpen = index.getTriggers("default", "door_open");
+	if (doorOpen.size() != 2 || doorOpen[0] != a || doorOpen[1] != b) return false;
+
+	const std::vector<int>& boss = index.getTriggers("boss", "BossVelius");
+	if (boss.size() != 1 || boss[0] != a) return false;
+
+	return index.getTriggers("boss", "door_open").empty() && index.getTriggers("quest", "BossVelius").empty();
+}
\ No newline at end of file
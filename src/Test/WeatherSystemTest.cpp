@@ -0,0 +1,89 @@
+#include "Test/WeatherSystemTest.h"
+
+TestResult WeatherSystemTest::runTest() {
+	TestResult result;
+	result.testName = "WeatherSystemTest";
+
+	check(result, testTypes(), "types");
+	check(result, testCount(), "count");
+	check(result, testWrapping(), "wrapping");
+	check(result, testCamera(), "camera");
+
+	return result;
+}
+
+WeatherData WeatherSystemTest::createData(const std::string& weather) {
+	WeatherData data;
+	data.weather = weather;
+	return data;
+}
+
+bool WeatherSystemTest::isInField(const WeatherSystem& weather) {
+	const sf::Vector2f& fieldSize = weather.getFieldSize();
+	for (auto& particle : weather.getParticles()) {
+		if (particle.position.x < 0.f || particle.position.x >= fieldSize.x) return false;
+		if (particle.position.y < 0.f || particle.position.y >= fieldSize.y) return false;
+		if (particle.time < sf::Time::Zero || particle.time > WeatherSystem::CYCLE_TIME) return false;
+	}
+	return true;
+}
+
+bool WeatherSystemTest::testTypes() {
+	if (WeatherSystem::getWeatherType("rain") != WeatherType::Rain) return false;
+	if (WeatherSystem::getWeatherType("snow") != WeatherType::Snow) return false;
+	if (WeatherSystem::getWeatherType("wind") != WeatherType::Wind) return false;
+
+	WeatherSystem weather;
+	WeatherData data = createData("hail");
+	weather.load(&data, true);
+	return weather.getWeatherType() == WeatherType::VOID && weather.getParticles().empty();
+}
+
+bool WeatherSystemTest::testCount() {
+	for (auto& name : { "rain", "snow", "wind" }) {
+		WeatherSystem weather;
+		WeatherData data = createData(name);
+		weather.load(&data, true);
+
+		// the old weather kept 1000 particles alive around the camera
+		size_t count = weather.getParticles().size();
+		if (count == 0 || count > 250) return false;
+		if (weather.getFieldSize().x < WINDOW_WIDTH || weather.getFieldSize().y < WINDOW_HEIGHT) return false;
+		if (!isInField(weather)) return false;
+	}
+	return true;
+}
+
+bool WeatherSystemTest::testWrapping() {
+	WeatherSystem weather;
+	WeatherData data = createData("rain");
+	weather.load(&data, true);
+	size_t count = weather.getParticles().size();
+
+	// a minute of rain, no particle leaves the field or is lost
+	for (int i = 0; i < 3600; ++i) {
+		weather.update(sf::milliseconds(16));
+	}
+	return weather.getParticles().size() == count && isInField(weather);
+}
+
+bool WeatherSystemTest::testCamera() {
+	WeatherSystem weather;
+	WeatherData data = createData("snow");
+	weather.load(&data, false);
+
+	weather.moveCamera(sf::Vector2f(500.f, 300.f));
+	std::vector<WeatherParticle> before = weather.getParticles();
+	weather.moveCamera(sf::Vector2f(530.f, 290.f));
+
+	// the particles move against the camera by their parallax, wrapping around the field
+	const sf::Vector2f& fieldSize = weather.getFieldSize();
+	for (size_t i = 0; i < before.size(); ++i) {
+		const WeatherParticle& particle = weather.getParticles()[i];
+		float x = std::fmod(before[i].position.x - 30.f * particle.parallax + fieldSize.x, fieldSize.x);
+		float y = std::fmod(before[i].position.y + 10.f * particle.parallax, fieldSize.y);
+		if (std::abs(particle.position.x - x) > 0.01f || std::abs(particle.position.y - y) > 0.01f) return false;
+		if (particle.parallax < 0.f || particle.parallax > 1.f) return false;
+	}
+	return isInField(weather);
+}
\ No newline at end of file
@@ -1,10 +1,10 @@
 #include "World/AnimatedGameObject.h"
 #include "ResourceManager.h"
 
+#include <algorithm>
+
 AnimatedGameObject::~AnimatedGameObject() {
-	for (auto& it : m_animations) {
-		delete it.second;
-	}
+	CLEAR_VECTOR(m_ownedAnimations);
 	m_animations.clear();
 }
 
@@ -26,12 +26,29 @@ void AnimatedGameObject::addAnimation(GameObjectState state, Animation* animatio
 		g_logger->logError("AnimatedGameObject", "Can't add an animation with no frames or 0 duration!");
 		return;
 	}
-	if (contains(m_animations, state)) {
-		delete m_animations.at(state);
-		m_animations[state] = animation;
+	deleteAnimation(state);
+	m_animations[state] = animation;
+	m_ownedAnimations.push_back(animation);
+}
+
+void AnimatedGameObject::addSharedAnimation(GameObjectState state, const Animation* animation) {
+	if (animation == nullptr || animation->getAnimationTime() == sf::Time::Zero) {
+		g_logger->logError("AnimatedGameObject", "Can't add an animation with no frames or 0 duration!");
 		return;
 	}
-	m_animations.insert({ state, animation });
+	deleteAnimation(state);
+	m_animations[state] = animation;
+}
+
+void AnimatedGameObject::deleteAnimation(GameObjectState state) {
+	auto it = m_animations.find(state);
+	if (it == m_animations.end()) return;
+	auto owned = std::find(m_ownedAnimations.begin(), m_ownedAnimations.end(), it->second);
+	if (owned != m_ownedAnimations.end()) {
+		delete *owned;
+		m_ownedAnimations.erase(owned);
+	}
+	m_animations.erase(it);
 }
 
 const Animation* AnimatedGameObject::getAnimation(GameObjectState state) const {
@@ -40,6 +57,10 @@ const Animation* AnimatedGameObject::getAnimation(GameObjectState state) const {
 	return m_animations.at(state);
 }
 
+const std::map<GameObjectState, const Animation*>& AnimatedGameObject::getAnimations() const {
+	return m_animations;
+}
+
 bool AnimatedGameObject::isAnimationLocked() const {
 	return m_isAnimationLocked;
 }
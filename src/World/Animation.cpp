@@ -1,15 +1,26 @@
 #include "World/Animation.h"
+#include "ResourceManager.h"
 
 void Animation::addFrame(const sf::IntRect& rect) {
-	m_frames.push_back(rect);
+	m_sourceFrames.push_back(rect);
+	m_isResolved = false;
 }
 
 void Animation::clearFrames() {
-	m_frames.clear();
+	m_sourceFrames.clear();
+	m_isResolved = false;
 }
 
 void Animation::setSpriteSheet(const sf::Texture* texture) {
-	m_texture = texture;
+	m_sourceTexture = texture;
+	m_isResolved = false;
+}
+
+void Animation::resolveFrames() const {
+	if (m_isResolved) return;
+	m_frames = m_sourceFrames;
+	m_texture = g_resourceManager->resolveAtlasFrames(m_sourceTexture, m_frames);
+	m_isResolved = true;
 }
 
 void Animation::setFrameTime(const sf::Time& frameTime) {
@@ -21,10 +32,12 @@ void Animation::setLooped(bool isLooped) {
 }
 
 const sf::Texture* Animation::getSpriteSheet() const {
+	resolveFrames();
 	return m_texture;
 }
 
 size_t Animation::getSize() const {
+	resolveFrames();
 	return m_frames.size();
 }
 
@@ -37,9 +50,11 @@ const sf::Time& Animation::getFrameTime() const {
 }
 
 const sf::Time Animation::getAnimationTime() const {
+	resolveFrames();
 	return sf::milliseconds(static_cast<int>(m_frames.size()) * m_frameTime.asMilliseconds());
 }
 
 const sf::IntRect& Animation::getFrame(size_t n) const {
+	resolveFrames();
 	return m_frames[n];
 }
\ No newline at end of file
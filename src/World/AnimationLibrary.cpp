@@ -0,0 +1,47 @@
+#include "World/AnimationLibrary.h"
+
+AnimationLibrary::~AnimationLibrary() {
+	clear();
+}
+
+const Animation* AnimationLibrary::getAnimation(const sf::Texture* spriteSheet, const std::string& spriteSheetPath,
+	const std::string& name, int skinNr, const AnimationBuilder& builder) {
+	auto& animations = m_animations[spriteSheetPath];
+	auto it = animations.find({ name, skinNr });
+	if (it != animations.end()) return it->second;
+
+	Animation* animation = new Animation();
+	animation->setSpriteSheet(spriteSheet);
+	builder(*animation);
+	// resolved once here, the shared animation is only read afterwards
+	animation->resolveFrames();
+	animations.insert({ { name, skinNr }, animation });
+	++m_buildCount;
+	return animation;
+}
+
+void AnimationLibrary::deleteAnimations(const std::string& spriteSheetPath) {
+	auto it = m_animations.find(spriteSheetPath);
+	if (it == m_animations.end()) return;
+	CLEAR_MAP(it->second);
+	m_animations.erase(it);
+}
+
+void AnimationLibrary::clear() {
+	for (auto& it : m_animations) {
+		CLEAR_MAP(it.second);
+	}
+	m_animations.clear();
+}
+
+int AnimationLibrary::getAnimationCount() const {
+	int count = 0;
+	for (auto& it : m_animations) {
+		count += static_cast<int>(it.second.size());
+	}
+	return count;
+}
+
+int AnimationLibrary::getBuildCount() const {
+	return m_buildCount;
+}
\ No newline at end of file
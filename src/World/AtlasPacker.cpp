@@ -0,0 +1,139 @@
+#include "World/AtlasPacker.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <tuple>
+
+const int AtlasPacker::PADDING = 2;
+const int AtlasPacker::DEFAULT_PAGE_SIZE = 2048;
+
+AtlasPacker::AtlasPacker(int pageSize) {
+	m_pageSize = pageSize;
+}
+
+bool AtlasPacker::pack(const std::map<std::string, std::vector<sf::IntRect>>& sprites,
+	const std::map<std::string, sf::Image>& spriteSheets, const std::string& pagePrefix) {
+	m_atlas.clear();
+	m_pages.clear();
+	bool isComplete = true;
+
+	// first decide where the frames go, then copy them
+	std::vector<Page> pages;
+	std::vector<std::vector<std::pair<std::string, TextureAtlasSprite>>> placedSprites;
+	for (auto& source : sprites) {
+		auto spriteSheet = spriteSheets.find(source.first);
+		if (spriteSheet == spriteSheets.end()) {
+			g_logger->logError("AtlasPacker", "Sprite sheet not loaded, skipping: " + source.first);
+			isComplete = false;
+			continue;
+		}
+
+		std::vector<sf::IntRect> frames = prepareFrames(source.first, source.second, spriteSheet->second, isComplete);
+		if (frames.empty()) continue;
+
+		// try the last page first, then a new one
+		bool isPlaced = false;
+		for (int attempt = 0; attempt < 2 && !isPlaced; ++attempt) {
+			if (attempt == 0 && pages.empty()) continue;
+			if (attempt == 1) {
+				pages.push_back(Page());
+				placedSprites.push_back({});
+			}
+
+			Page page = pages.back();
+			std::vector<std::pair<std::string, TextureAtlasSprite>> placed;
+			isPlaced = true;
+			for (auto& frame : frames) {
+				TextureAtlasSprite sprite;
+				sprite.sourceRect = frame;
+				if (!place(page, sf::Vector2i(frame.width, frame.height), sprite.position)) {
+					isPlaced = false;
+					break;
+				}
+				placed.push_back({ source.first, sprite });
+			}
+
+			if (isPlaced) {
+				pages.back() = page;
+				placedSprites.back().insert(placedSprites.back().end(), placed.begin(), placed.end());
+			}
+		}
+
+		if (!isPlaced) {
+			g_logger->logError("AtlasPacker", "The frames of this sprite sheet don't fit on one page, skipping: " + source.first);
+			isComplete = false;
+			// the new page stayed empty
+			pages.pop_back();
+			placedSprites.pop_back();
+		}
+	}
+
+	for (size_t i = 0; i < pages.size(); ++i) {
+		int index = m_atlas.addPage(pagePrefix + std::to_string(m_pages.size()) + ".png");
+		m_pages.push_back(sf::Image());
+		sf::Image& image = m_pages.back();
+		image.create(pages[i].size.x, pages[i].size.y, sf::Color::Transparent);
+
+		for (auto& placed : placedSprites[i]) {
+			const TextureAtlasSprite& sprite = placed.second;
+			image.copy(spriteSheets.at(placed.first), sprite.position.x, sprite.position.y, sprite.sourceRect);
+			m_atlas.addSprite(placed.first, index, sprite);
+		}
+	}
+
+	return isComplete;
+}
+
+bool AtlasPacker::place(Page& page, const sf::Vector2i& size, sf::Vector2i& position) const {
+	for (auto& shelf : page.shelves) {
+		if (size.y > shelf.height || shelf.width + size.x + PADDING > m_pageSize) continue;
+		position = sf::Vector2i(shelf.width, shelf.y);
+		shelf.width += size.x + PADDING;
+		page.size.x = std::max(page.size.x, shelf.width);
+		return true;
+	}
+
+	// open a new shelf below the others
+	if (page.size.y + size.y + PADDING > m_pageSize || PADDING + size.x + PADDING > m_pageSize) return false;
+	Shelf shelf;
+	shelf.y = page.size.y;
+	shelf.height = size.y;
+	shelf.width = PADDING + size.x + PADDING;
+	page.shelves.push_back(shelf);
+
+	position = sf::Vector2i(PADDING, shelf.y);
+	page.size.x = std::max(page.size.x, shelf.width);
+	page.size.y += size.y + PADDING;
+	return true;
+}
+
+std::vector<sf::IntRect> AtlasPacker::prepareFrames(const std::string& source, const std::vector<sf::IntRect>& frames,
+	const sf::Image& spriteSheet, bool& isValid) {
+	sf::IntRect bounds(0, 0, static_cast<int>(spriteSheet.getSize().x), static_cast<int>(spriteSheet.getSize().y));
+
+	std::vector<sf::IntRect> prepared;
+	for (auto& frame : frames) {
+		sf::IntRect intersection;
+		if (frame.width <= 0 || frame.height <= 0 || !bounds.intersects(frame, intersection) || intersection != frame) {
+			g_logger->logError("AtlasPacker", "Frame outside of the sprite sheet, skipping it: " + source);
+			isValid = false;
+			continue;
+		}
+		prepared.push_back(frame);
+	}
+
+	// animations often show a frame more than once
+	std::sort(prepared.begin(), prepared.end(), [](const sf::IntRect& a, const sf::IntRect& b) {
+		return std::tie(b.height, b.width, a.top, a.left) < std::tie(a.height, a.width, b.top, b.left);
+	});
+	prepared.erase(std::unique(prepared.begin(), prepared.end()), prepared.end());
+	return prepared;
+}
+
+const TextureAtlas& AtlasPacker::getAtlas() const {
+	return m_atlas;
+}
+
+const std::vector<sf::Image>& AtlasPacker::getPages() const {
+	return m_pages;
+}
\ No newline at end of file
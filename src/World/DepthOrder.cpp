@@ -0,0 +1,81 @@
+#include "World/DepthOrder.h"
+#include "World/GameObject.h"
+
+const float DepthOrder::DEPTH_THRESHOLD = 1.f;
+
+void DepthOrder::sort(std::vector<GameObject*>& objects, bool asc) {
+	bool isSortNeeded = syncEntries(objects) || asc != m_isAsc;
+	m_isAsc = asc;
+	if (!isSortNeeded) return;
+
+	// insertion sort, stable by sequence for equal depths
+	for (size_t i = 1; i < m_entries.size(); ++i) {
+		Entry entry = m_entries[i];
+		size_t j = i;
+		while (j > 0) {
+			const Entry& previous = m_entries[j - 1];
+			bool isBefore = previous.depth == entry.depth ?
+				entry.sequence < previous.sequence :
+				(asc ? entry.depth < previous.depth : entry.depth > previous.depth);
+			if (!isBefore) break;
+			m_entries[j] = previous;
+			--j;
+		}
+		m_entries[j] = entry;
+	}
+
+	for (size_t i = 0; i < m_entries.size(); ++i) {
+		objects[i] = m_entries[i].object;
+	}
+}
+
+bool DepthOrder::syncEntries(const std::vector<GameObject*>& objects) {
+	// the objects vector usually keeps our order from the last frame with new objects appended,
+	// so we walk both in parallel. If an object is not the next cached entry, objects have been removed or reordered
+	// and we look up its entry, so it keeps its sequence and the order of equal depths stays stable.
+	bool isChanged = objects.size() != m_entries.size();
+	m_syncedEntries.clear();
+	m_entryIndices.clear();
+	bool isIndexed = false;
+	size_t e = 0;
+	for (GameObject* object : objects) {
+		const Entry* cached = nullptr;
+		if (e < m_entries.size() && m_entries[e].object == object) {
+			cached = &m_entries[e++];
+		}
+		else {
+			if (!isIndexed) {
+				for (size_t i = e; i < m_entries.size(); ++i) {
+					m_entryIndices[m_entries[i].object] = i;
+				}
+				isIndexed = true;
+			}
+			auto it = m_entryIndices.find(object);
+			if (it != m_entryIndices.end()) {
+				cached = &m_entries[it->second];
+			}
+			isChanged = true;
+		}
+
+		if (cached != nullptr) {
+			Entry entry = *cached;
+			float depth = getDepth(object);
+			if (std::abs(depth - entry.depth) > DEPTH_THRESHOLD) {
+				entry.depth = depth;
+				isChanged = true;
+			}
+			m_syncedEntries.push_back(entry);
+		}
+		else {
+			m_syncedEntries.push_back({ object, getDepth(object), m_nextSequence++ });
+			isChanged = true;
+		}
+	}
+
+	m_entries.swap(m_syncedEntries);
+	return isChanged;
+}
+
+float DepthOrder::getDepth(const GameObject* object) {
+	return object->getPosition().y + object->getBoundingBox()->height;
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "World/GameObject.h"
+#include "World/MousePicker.h"
 #include "ResourceManager.h"
 #include "GameObjectComponents/GameObjectComponent.h"
 
@@ -34,21 +35,26 @@ void GameObject::setDebugBoundingBox(const sf::Color& debugColor) {
 void GameObject::update(const sf::Time& frameTime) {
 	m_isDebugRendering = g_resourceManager->getConfiguration().isDebugRenderingOn;
 	
-	if (g_inputController->isMouseOver(&m_boundingBox, m_isInputInDefaultView)) {
+	bool isMouseOver = m_mousePicker != nullptr ?
+		m_mousePicker->isPicked(this) :
+		g_inputController->isMouseOver(&m_boundingBox, m_isInputInDefaultView);
+
+	if (isMouseOver) {
 		onMouseOver();
 		// if the inputcontroller has locked actions, skip these methods.
 		if (g_inputController->isActionLocked()) return;
 
-		if (g_inputController->isRightClicked(&m_boundingBox, m_isInputInDefaultView)) {
+		// the mouse is already known to be over the bounding box, only the buttons are left to check
+		if (g_inputController->isMouseClickedRight()) {
 			onRightClick();
 		}
-		else if (g_inputController->isRightJustPressed(&m_boundingBox, m_isInputInDefaultView)) {
+		else if (g_inputController->isMouseJustPressedRight()) {
 			onRightJustPressed();
 		}
-		else if (g_inputController->isLeftClicked(&m_boundingBox, m_isInputInDefaultView)) {
+		else if (g_inputController->isMouseClickedLeft()) {
 			onLeftClick();
 		}
-		else if (g_inputController->isLeftJustPressed(&m_boundingBox, m_isInputInDefaultView)) {
+		else if (g_inputController->isMouseJustPressedLeft()) {
 			onLeftJustPressed();
 		}
 	}
@@ -66,6 +72,9 @@ void GameObject::setPosition(const sf::Vector2f& position) {
 	for (auto component : m_components) {
 		component->setPosition(position);
 	}
+	if (m_mousePicker != nullptr) {
+		m_mousePicker->notifyMoved(this);
+	}
 }
 
 void GameObject::setPositionX(const float posX) {
@@ -157,6 +166,22 @@ void GameObject::setInputInDefaultView(bool value) {
 	m_isInputInDefaultView = value;
 }
 
+void GameObject::setMousePickable(bool value) {
+	m_isMousePickable = value;
+}
+
+void GameObject::setMousePicker(MousePicker* mousePicker) {
+	m_mousePicker = mousePicker;
+}
+
+bool GameObject::isInputInDefaultView() const {
+	return m_isInputInDefaultView;
+}
+
+bool GameObject::isMousePickable() const {
+	return m_isMousePickable;
+}
+
 bool GameObject::isDisposed() const {
 	return m_isDisposed;
 }
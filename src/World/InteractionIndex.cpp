@@ -0,0 +1,108 @@
+#include "World/InteractionIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+// the interact ranges are 100 at most, so a query covers the 3x3 cells around the character
+const float InteractionIndex::CELL_SIZE = 2 * TILE_SIZE_F;
+const float InteractionIndex::HYSTERESIS = 8.f;
+
+InteractionIndex::InteractionIndex() : m_grid(CELL_SIZE) {
+}
+
+int InteractionIndex::addObject(const sf::Vector2f& position, float range) {
+	int object = static_cast<int>(m_entries.size());
+	Entry entry;
+	entry.position = position;
+	entry.range = range;
+	entry.cell = m_grid.insert(object, position);
+	m_entries.push_back(entry);
+
+	m_maxRange = std::max(m_maxRange, range);
+	return object;
+}
+
+void InteractionIndex::moveObject(int object, const sf::Vector2f& position) {
+	if (!isValid(object)) return;
+	Entry& entry = m_entries[object];
+	entry.position = position;
+
+	if (m_grid.getKey(position) == entry.cell) return;
+
+	m_grid.remove(object, entry.cell);
+	entry.cell = m_grid.insert(object, position);
+}
+
+void InteractionIndex::setRange(int object, float range) {
+	if (!isValid(object)) return;
+	m_entries[object].range = range;
+	m_maxRange = std::max(m_maxRange, range);
+}
+
+void InteractionIndex::setEnabled(int object, bool isEnabled) {
+	if (!isValid(object)) return;
+	m_entries[object].isEnabled = isEnabled;
+}
+
+void InteractionIndex::removeObject(int object) {
+	if (!isValid(object)) return;
+	Entry& entry = m_entries[object];
+	entry.isRemoved = true;
+	m_grid.remove(object, entry.cell);
+}
+
+void InteractionIndex::clear() {
+	m_entries.clear();
+	m_grid.clear();
+	m_maxRange = 0.f;
+	m_testedCount = 0;
+}
+
+int InteractionIndex::getNearest(const sf::Vector2f& position, int focused) {
+	m_testedCount = 0;
+	int nearest = -1;
+	float nearestDistance = 0.f;
+
+	// every object is in a single cell, so none is collected twice
+	m_candidates.clear();
+	m_grid.collect(sf::FloatRect(position.x - m_maxRange, position.y - m_maxRange, 2 * m_maxRange, 2 * m_maxRange), m_candidates);
+	for (int object : m_candidates) {
+		float distance = getSquaredDistance(object, position);
+		if (distance < 0.f) continue;
+		// equidistant objects are decided by their id, not by the order of the cells
+		if (nearest == -1 || distance < nearestDistance || (distance == nearestDistance && object < nearest)) {
+			nearest = object;
+			nearestDistance = distance;
+		}
+	}
+
+	if (nearest == -1 || nearest == focused || !isValid(focused)) return nearest;
+
+	// the focused object only loses the focus to an object that is clearly nearer
+	float focusedDistance = getSquaredDistance(focused, position);
+	if (focusedDistance < 0.f) return nearest;
+	float threshold = std::sqrt(focusedDistance) - HYSTERESIS;
+	return threshold > 0.f && nearestDistance < threshold * threshold ? nearest : focused;
+}
+
+float InteractionIndex::getSquaredDistance(int object, const sf::Vector2f& position) {
+	const Entry& entry = m_entries[object];
+	if (!entry.isEnabled) return -1.f;
+
+	m_testedCount++;
+	sf::Vector2f delta = entry.position - position;
+	float distance = delta.x * delta.x + delta.y * delta.y;
+	return distance <= entry.range * entry.range ? distance : -1.f;
+}
+
+bool InteractionIndex::isValid(int object) const {
+	return object >= 0 && object < static_cast<int>(m_entries.size()) && !m_entries[object].isRemoved;
+}
+
+int InteractionIndex::getTestedCount() const {
+	return m_testedCount;
+}
+
+int InteractionIndex::getObjectCount() const {
+	return static_cast<int>(std::count_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) { return !entry.isRemoved; }));
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "World/JobSystem.h"
+
+JobSystem::JobSystem(int workerCount) : m_next(0) {
+	for (int i = 0; i < workerCount; ++i) {
+		m_workers.push_back(std::thread(&JobSystem::work, this));
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isRunning = false;
+	}
+	m_condition.notify_all();
+	for (auto& worker : m_workers) {
+		worker.join();
+	}
+}
+
+void JobSystem::parallelFor(int count, const std::function<void(int)>& job) {
+	if (count <= 0) return;
+	if (m_workers.empty() || count == 1) {
+		for (int i = 0; i < count; ++i) {
+			job(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_job = &job;
+		m_count = count;
+		// a few chunks per thread, so a slow chunk doesn't keep the others waiting
+		m_chunkSize = std::max(1, count / (4 * (getWorkerCount() + 1)));
+		m_next = 0;
+		m_activeWorkers = getWorkerCount();
+		++m_generation;
+	}
+	m_condition.notify_all();
+
+	runChunks();
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCondition.wait(lock, [this] { return m_activeWorkers == 0; });
+	m_job = nullptr;
+}
+
+void JobSystem::work() {
+	unsigned int generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this, generation] { return !m_isRunning || m_generation != generation; });
+			if (!m_isRunning) return;
+			generation = m_generation;
+		}
+
+		runChunks();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_activeWorkers == 0) {
+			m_doneCondition.notify_one();
+		}
+	}
+}
+
+void JobSystem::runChunks() {
+	while (true) {
+		int first = m_next.fetch_add(m_chunkSize);
+		if (first >= m_count) return;
+		int last = std::min(first + m_chunkSize, m_count);
+		for (int i = first; i < last; ++i) {
+			(*m_job)(i);
+		}
+	}
+}
+
+int JobSystem::getWorkerCount() const {
+	return static_cast<int>(m_workers.size());
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "World/LoadingPipeline.h"
+#include "ResourceManager.h"
+#include "Logger.h"
+
+#include <thread>
+
+const int LoadingPipeline::MAX_WORKERS = 3;
+
+LoadingPipeline::LoadingPipeline(const std::string& name) {
+	m_name = name;
+}
+
+int LoadingPipeline::addStage(const std::string& name, const std::function<bool()>& job, const std::vector<int>& dependencies, bool isOnLoaderThread) {
+	Stage stage;
+	stage.name = name;
+	stage.job = job;
+	stage.isOnLoaderThread = isOnLoaderThread;
+	for (int dependency : dependencies) {
+		// only earlier stages are allowed, so there can't be any cycles
+		if (dependency < 0 || dependency >= static_cast<int>(m_stages.size())) {
+			g_logger->logError("LoadingPipeline", "Stage " + name + " depends on an unknown stage, ignoring that dependency.");
+			continue;
+		}
+		stage.dependencies.push_back(dependency);
+	}
+
+	m_stages.push_back(stage);
+	return static_cast<int>(m_stages.size()) - 1;
+}
+
+bool LoadingPipeline::run(int workerCount) {
+	sf::Clock clock;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_remainingStages = static_cast<int>(m_stages.size());
+	}
+
+	std::vector<std::thread> workers;
+	for (int i = 0; i < workerCount; ++i) {
+		workers.push_back(std::thread(&LoadingPipeline::work, this, false));
+	}
+	work(true);
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	m_totalTime = clock.getElapsedTime();
+
+	for (auto& stage : m_stages) {
+		if (stage.state != LoadingStageState::Done) return false;
+	}
+	return true;
+}
+
+void LoadingPipeline::work(bool isLoaderThread) {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (m_remainingStages > 0) {
+		int index = takeStage(isLoaderThread);
+		if (index < 0) {
+			// skipping stages may have finished the pipeline
+			if (m_remainingStages > 0) {
+				m_condition.wait(lock);
+			}
+			continue;
+		}
+
+		m_stages[index].state = LoadingStageState::Running;
+		std::function<bool()> job = m_stages[index].job;
+		lock.unlock();
+
+		sf::Clock clock;
+		bool success = job();
+		sf::Time time = clock.getElapsedTime();
+
+		lock.lock();
+		m_stages[index].time = time;
+		m_stages[index].state = success ? LoadingStageState::Done : LoadingStageState::Failed;
+		if (!success) {
+			g_logger->logError("LoadingPipeline", m_name + ": stage " + m_stages[index].name + " failed.");
+		}
+		--m_remainingStages;
+		m_condition.notify_all();
+	}
+}
+
+int LoadingPipeline::takeStage(bool isLoaderThread) {
+	int readyStage = -1;
+	for (int i = 0; i < static_cast<int>(m_stages.size()); ++i) {
+		Stage& stage = m_stages[i];
+		if (stage.state != LoadingStageState::Waiting) continue;
+
+		bool isReady = true;
+		bool isBlocked = false;
+		for (int dependency : stage.dependencies) {
+			LoadingStageState state = m_stages[dependency].state;
+			if (state == LoadingStageState::Failed || state == LoadingStageState::Skipped) {
+				isBlocked = true;
+				break;
+			}
+			if (state != LoadingStageState::Done) {
+				isReady = false;
+			}
+		}
+
+		if (isBlocked) {
+			stage.state = LoadingStageState::Skipped;
+			--m_remainingStages;
+			m_condition.notify_all();
+			continue;
+		}
+		if (!isReady || (stage.isOnLoaderThread && !isLoaderThread)) continue;
+
+		// the loader thread prefers its own stages, nobody else can run them
+		if (!isLoaderThread || stage.isOnLoaderThread) return i;
+		if (readyStage < 0) readyStage = i;
+	}
+
+	return readyStage;
+}
+
+LoadingStageState LoadingPipeline::getStageState(int stage) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (stage < 0 || stage >= static_cast<int>(m_stages.size())) return LoadingStageState::Skipped;
+	return m_stages[stage].state;
+}
+
+sf::Time LoadingPipeline::getStageTime(int stage) const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (stage < 0 || stage >= static_cast<int>(m_stages.size())) return sf::Time::Zero;
+	return m_stages[stage].time;
+}
+
+sf::Time LoadingPipeline::getTotalTime() const {
+	return m_totalTime;
+}
+
+void LoadingPipeline::logTimes() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	sf::Time sum = sf::Time::Zero;
+	for (auto& stage : m_stages) {
+		sum += stage.time;
+		std::string state = stage.state == LoadingStageState::Done ? "" :
+			stage.state == LoadingStageState::Skipped ? " (skipped)" : " (failed)";
+		g_logger->logInfo("LoadingPipeline", m_name + " - " + stage.name + ": " + std::to_string(stage.time.asMilliseconds()) + " ms" + state);
+	}
+	g_logger->logInfo("LoadingPipeline", m_name + " loaded in " + std::to_string(m_totalTime.asMilliseconds()) +
+		" ms, the stages took " + std::to_string(sum.asMilliseconds()) + " ms in total.");
+}
+
+int LoadingPipeline::getWorkerCount() {
+	if (!g_resourceManager->getConfiguration().isMultithreading) return 0;
+	// the loader thread works as well
+	int cores = static_cast<int>(std::thread::hardware_concurrency());
+	return std::max(1, std::min(MAX_WORKERS, cores - 1));
+}
\ No newline at end of file
@@ -2,43 +2,49 @@
 #include "GameObjectComponents/InteractComponent.h"
 
 void MainCharacter::handleInteraction() {
-	if (m_nearestInteractive == nullptr && m_interactiveObjects.empty()) return;
-	if (m_nearestInteractive != nullptr) {
-		m_nearestInteractive->setFocused(false);
-		m_nearestInteractive = nullptr;
-	}
+	int focused = m_nearestInteractive == nullptr ? -1 : m_nearestInteractive->getInteractionID();
+	int nearest = m_interactionIndex.getNearest(getCenter(), focused);
 
-	float nearest = 100000;
-
-	for (auto& obj : m_interactiveObjects) {
-		float newNearest = obj->getDistanceToMainChar();
-		if (obj->getDistanceToMainChar() < nearest) {
-			nearest = newNearest;
-			m_nearestInteractive = obj;
+	if (nearest != focused) {
+		if (m_nearestInteractive != nullptr) {
+			m_nearestInteractive->setFocused(false);
+		}
+		m_nearestInteractive = nearest == -1 ? nullptr : m_interactiveObjects[nearest];
+		if (m_nearestInteractive != nullptr) {
+			m_nearestInteractive->setFocused(true);
 		}
 	}
 
-	if (m_nearestInteractive != nullptr) {
-		m_nearestInteractive->setFocused(true);
-		if (g_inputController->isKeyJustPressed(Key::Interact)) {
-			m_nearestInteractive->interact();
-			if (m_nearestInteractive != nullptr) {
-				m_nearestInteractive->setFocused(false);
-				m_nearestInteractive = nullptr;
-			} 
+	if (m_nearestInteractive != nullptr && g_inputController->isKeyJustPressed(Key::Interact)) {
+		m_nearestInteractive->interact();
+		if (m_nearestInteractive != nullptr) {
+			m_nearestInteractive->setFocused(false);
+			m_nearestInteractive = nullptr;
 		}
 	}
-
-	m_interactiveObjects.clear();
 }
 
-void MainCharacter::registerInteractiveObject(InteractComponent* component) {
-	m_interactiveObjects.push_back(component);
+void MainCharacter::updateInteractiveObject(InteractComponent* component) {
+	int id = component->getInteractionID();
+	if (id == -1) {
+		id = m_interactionIndex.addObject(component->getInteractPosition(), component->getInteractRange());
+		component->setInteractionID(id);
+		m_interactiveObjects.resize(id + 1, nullptr);
+		m_interactiveObjects[id] = component;
+	}
+	else {
+		m_interactionIndex.moveObject(id, component->getInteractPosition());
+		m_interactionIndex.setRange(id, component->getInteractRange());
+	}
+	m_interactionIndex.setEnabled(id, component->isInteractable());
 }
 
 void MainCharacter::notifyDisposed(InteractComponent* component) {
 	if (m_nearestInteractive == component)
 		m_nearestInteractive = nullptr;
 
-	m_interactiveObjects.erase(std::remove(m_interactiveObjects.begin(), m_interactiveObjects.end(), component), m_interactiveObjects.end());
+	int id = component->getInteractionID();
+	if (id == -1) return;
+	m_interactionIndex.removeObject(id);
+	m_interactiveObjects[id] = nullptr;
 }
@@ -0,0 +1,77 @@
+#include "World/MousePicker.h"
+#include "World/GameObject.h"
+
+void MousePicker::addLayer(GameObjectType type, const std::vector<GameObject*>* objects) {
+	m_types.push_back(type);
+	m_layers.push_back(objects);
+	m_isDirty = true;
+}
+
+bool MousePicker::hasLayer(GameObjectType type) const {
+	return contains(m_types, type);
+}
+
+void MousePicker::clear() {
+	m_types.clear();
+	m_layers.clear();
+	m_picked = nullptr;
+	m_isDirty = true;
+}
+
+void MousePicker::update(const sf::Vector2f& mousePosition, bool isMouseInsideView, bool isMouseButtonDown) {
+	bool isMouseMoved = mousePosition != m_mousePosition || isMouseInsideView != m_isMouseInsideView;
+	m_mousePosition = mousePosition;
+	m_isMouseInsideView = isMouseInsideView;
+
+	// objects that moved under the resting mouse have set the dirty flag, the picked object can only have moved away from it.
+	if (!isMouseMoved && !isMouseButtonDown && !m_isDirty && (m_picked == nullptr || isHit(m_picked, mousePosition))) return;
+
+	m_isDirty = false;
+	m_picked = nullptr;
+	if (!isMouseInsideView) return;
+
+	m_passCount++;
+	for (auto layer : m_layers) {
+		for (auto it = layer->rbegin(); it != layer->rend(); ++it) {
+			if (isHit(*it, mousePosition)) {
+				m_picked = *it;
+				return;
+			}
+		}
+	}
+}
+
+void MousePicker::setDirty() {
+	m_isDirty = true;
+}
+
+void MousePicker::notifyMoved(const GameObject* object) {
+	if (m_isDirty || object == m_picked || !m_isMouseInsideView) return;
+	if (isHit(object, m_mousePosition)) {
+		m_isDirty = true;
+	}
+}
+
+void MousePicker::removeObject(const GameObject* object) {
+	if (m_picked != object) return;
+	m_picked = nullptr;
+	m_isDirty = true;
+}
+
+bool MousePicker::isHit(const GameObject* object, const sf::Vector2f& mousePosition) {
+	// objects outside of the view can't be under the mouse, the flag is cheaper than the bounding box.
+	if (!object->isMousePickable() || object->isDisposed() || !object->isViewable() || object->isInputInDefaultView()) return false;
+	return object->getBoundingBox()->contains(mousePosition);
+}
+
+bool MousePicker::isPicked(const GameObject* object) const {
+	return object == m_picked;
+}
+
+const GameObject* MousePicker::getPicked() const {
+	return m_picked;
+}
+
+int MousePicker::getPassCount() const {
+	return m_passCount;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "World/RenderPass.h"
+
+RenderPass::RenderPass(const std::string& name, const sf::BlendMode& blendMode, const sf::Color& clearColor) {
+	m_name = name;
+	m_blendMode = blendMode;
+	m_clearColor = clearColor;
+	m_target = std::make_shared<Target>();
+}
+
+void RenderPass::create(unsigned int width, unsigned int height) {
+	m_target->ownedTexture.reset(new sf::RenderTexture());
+	m_target->ownedTexture->create(width, height);
+	setTexture(m_target->ownedTexture.get());
+}
+
+void RenderPass::setTexture(sf::RenderTexture* texture) {
+	m_target->texture = texture;
+	m_target->isDirty = false;
+	if (texture != nullptr) {
+		texture->clear(m_clearColor);
+	}
+}
+
+void RenderPass::share(RenderPass& other) {
+	m_target = other.m_target;
+}
+
+sf::RenderTarget& RenderPass::getTarget(const sf::View& view) {
+	m_stats.draws++;
+	m_target->isDirty = true;
+	m_target->texture->setView(view);
+	return *m_target->texture;
+}
+
+void RenderPass::flush(sf::RenderTarget& renderTarget, sf::Sprite& sprite, const sf::Shader* shader) {
+	if (!m_target->isDirty || m_target->texture == nullptr) {
+		m_stats.skipped++;
+		return;
+	}
+
+	sf::RenderTexture& texture = *m_target->texture;
+	texture.display();
+
+	sf::RenderStates renderStates = sf::RenderStates::Default;
+	renderStates.blendMode = m_blendMode;
+	renderStates.shader = shader;
+
+	sf::View oldView = renderTarget.getView();
+	sprite.setTexture(texture.getTexture());
+	renderTarget.setView(renderTarget.getDefaultView());
+	renderTarget.draw(sprite, renderStates);
+	renderTarget.setView(oldView);
+
+	texture.clear(m_clearColor);
+	m_target->isDirty = false;
+
+	m_stats.composites++;
+	m_stats.filledPixels += 2 * static_cast<sf::Uint64>(texture.getSize().x) * texture.getSize().y;
+}
+
+bool RenderPass::isEmpty() const {
+	return !m_target->isDirty;
+}
+
+const std::string& RenderPass::getName() const {
+	return m_name;
+}
+
+const RenderPassStats& RenderPass::getStats() const {
+	return m_stats;
+}
+
+void RenderPass::resetStats() {
+	m_stats = RenderPassStats();
+}
\ No newline at end of file
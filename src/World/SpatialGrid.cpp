@@ -0,0 +1,70 @@
+#include "World/SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize) {
+	m_cellSize = cellSize;
+}
+
+void SpatialGrid::insert(int id, const sf::FloatRect& rect) {
+	sf::Vector2i topLeft = toCell(sf::Vector2f(rect.left, rect.top));
+	sf::Vector2i bottomRight = toCell(sf::Vector2f(rect.left + rect.width, rect.top + rect.height));
+	for (int y = topLeft.y; y <= bottomRight.y; ++y) {
+		for (int x = topLeft.x; x <= bottomRight.x; ++x) {
+			m_cells[getKey(x, y)].push_back(id);
+		}
+	}
+}
+
+uint64_t SpatialGrid::insert(int id, const sf::Vector2f& position) {
+	uint64_t key = getKey(position);
+	m_cells[key].push_back(id);
+	return key;
+}
+
+void SpatialGrid::remove(int id, uint64_t key) {
+	auto cell = m_cells.find(key);
+	if (cell == m_cells.end()) return;
+
+	std::vector<int>& ids = cell->second;
+	ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+	if (ids.empty()) {
+		m_cells.erase(cell);
+	}
+}
+
+void SpatialGrid::clear() {
+	m_cells.clear();
+}
+
+void SpatialGrid::collect(const sf::FloatRect& rect, std::vector<int>& ids) const {
+	sf::Vector2i topLeft = toCell(sf::Vector2f(rect.left, rect.top));
+	sf::Vector2i bottomRight = toCell(sf::Vector2f(rect.left + rect.width, rect.top + rect.height));
+	for (int y = topLeft.y; y <= bottomRight.y; ++y) {
+		for (int x = topLeft.x; x <= bottomRight.x; ++x) {
+			auto cell = m_cells.find(getKey(x, y));
+			if (cell == m_cells.end()) continue;
+			ids.insert(ids.end(), cell->second.begin(), cell->second.end());
+		}
+	}
+}
+
+uint64_t SpatialGrid::getKey(const sf::Vector2f& position) const {
+	sf::Vector2i cell = toCell(position);
+	return getKey(cell.x, cell.y);
+}
+
+float SpatialGrid::getCellSize() const {
+	return m_cellSize;
+}
+
+sf::Vector2i SpatialGrid::toCell(const sf::Vector2f& position) const {
+	return sf::Vector2i(
+		static_cast<int>(std::floor(position.x / m_cellSize)),
+		static_cast<int>(std::floor(position.y / m_cellSize)));
+}
+
+uint64_t SpatialGrid::getKey(int x, int y) {
+	return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | static_cast<uint32_t>(x);
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include "World/TextureAtlas.h"
+#include "Logger.h"
+
+#include <fstream>
+#include <sstream>
+
+const std::string TextureAtlas::ATLAS_PATH = "res/texture/atlas/atlas.txt";
+const std::string TextureAtlas::SPRITE_LIST_PATH = "res/texture/atlas/sprites.txt";
+
+// splits a line at commas
+inline std::vector<std::string> splitLine(const std::string& line) {
+	std::vector<std::string> fields;
+	std::stringstream stream(line);
+	std::string field;
+	while (std::getline(stream, field, ',')) {
+		fields.push_back(field);
+	}
+	return fields;
+}
+
+// parses the integers from this field on, returns false if one of them is not a number
+inline bool parseInts(const std::vector<std::string>& fields, size_t first, std::vector<int>& values) {
+	values.clear();
+	for (size_t i = first; i < fields.size(); ++i) {
+		char* end = nullptr;
+		long value = std::strtol(fields[i].c_str(), &end, 10);
+		if (fields[i].empty() || *end != '\0') return false;
+		values.push_back(static_cast<int>(value));
+	}
+	return true;
+}
+
+bool TextureAtlas::read(std::istream& stream) {
+	clear();
+	std::string line;
+	std::vector<int> values;
+	int lineNr = 0;
+	while (std::getline(stream, line)) {
+		++lineNr;
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty() || line[0] == '#') continue;
+
+		std::vector<std::string> fields = splitLine(line);
+		if (fields.size() == 2 && fields[0] == "page") {
+			addPage(fields[1]);
+			continue;
+		}
+		if (fields.size() == 9 && fields[0] == "sprite" && parseInts(fields, 2, values)
+			&& values[4] >= 0 && values[4] < getPageCount()) {
+			TextureAtlasSprite sprite;
+			sprite.sourceRect = sf::IntRect(values[0], values[1], values[2], values[3]);
+			sprite.position = sf::Vector2i(values[5], values[6]);
+			addSprite(fields[1], values[4], sprite);
+			continue;
+		}
+
+		g_logger->logError("TextureAtlas", "Invalid line " + std::to_string(lineNr) + " in the texture atlas: " + line);
+		clear();
+		return false;
+	}
+	return true;
+}
+
+void TextureAtlas::write(std::ostream& stream) const {
+	stream << "# written by the atlas packer, do not edit\n";
+	for (auto& page : m_pages) {
+		stream << "page," << page << "\n";
+	}
+	for (auto& source : m_sources) {
+		for (auto& sprite : source.second.sprites) {
+			const sf::IntRect& rect = sprite.sourceRect;
+			stream << "sprite," << source.first << ","
+				<< rect.left << "," << rect.top << "," << rect.width << "," << rect.height << ","
+				<< source.second.page << "," << sprite.position.x << "," << sprite.position.y << "\n";
+		}
+	}
+}
+
+bool TextureAtlas::load(const std::string& filename) {
+	std::ifstream file(filename);
+	if (!file.is_open()) return false;
+	return read(file);
+}
+
+bool TextureAtlas::save(const std::string& filename) const {
+	std::ofstream file(filename);
+	if (!file.is_open()) {
+		g_logger->logError("TextureAtlas", "Could not write the texture atlas to: " + filename);
+		return false;
+	}
+	write(file);
+	return true;
+}
+
+int TextureAtlas::addPage(const std::string& path) {
+	m_pages.push_back(path);
+	return static_cast<int>(m_pages.size()) - 1;
+}
+
+void TextureAtlas::addSprite(const std::string& source, int page, const TextureAtlasSprite& sprite) {
+	auto it = m_sources.find(source);
+	if (it == m_sources.end()) {
+		it = m_sources.insert({ source, Source() }).first;
+		it->second.page = page;
+	}
+	else if (it->second.page != page) {
+		g_logger->logError("TextureAtlas", "All sprites of a source must be on the same page, ignoring a sprite of: " + source);
+		return;
+	}
+	it->second.sprites.push_back(sprite);
+}
+
+void TextureAtlas::clear() {
+	m_pages.clear();
+	m_sources.clear();
+}
+
+const TextureAtlasSprite* TextureAtlas::getSprite(const std::string& source, const sf::IntRect& rect) const {
+	auto it = m_sources.find(source);
+	if (it == m_sources.end()) return nullptr;
+	for (auto& sprite : it->second.sprites) {
+		if (sprite.sourceRect == rect) return &sprite;
+	}
+	return nullptr;
+}
+
+int TextureAtlas::getPage(const std::string& source) const {
+	auto it = m_sources.find(source);
+	if (it == m_sources.end()) return -1;
+	return it->second.page;
+}
+
+const std::string& TextureAtlas::getPagePath(int page) const {
+	return m_pages[page];
+}
+
+int TextureAtlas::getPageCount() const {
+	return static_cast<int>(m_pages.size());
+}
+
+int TextureAtlas::getSpriteCount() const {
+	int count = 0;
+	for (auto& source : m_sources) {
+		count += static_cast<int>(source.second.sprites.size());
+	}
+	return count;
+}
+
+bool TextureAtlas::isPacked(const std::string& source) const {
+	return contains(m_sources, source);
+}
+
+bool TextureAtlas::readSpriteList(std::istream& stream, std::map<std::string, std::vector<sf::IntRect>>& sprites) {
+	std::string line;
+	std::vector<int> values;
+	while (std::getline(stream, line)) {
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty() || line[0] == '#') continue;
+
+		std::vector<std::string> fields = splitLine(line);
+		if (fields.size() != 5 || !parseInts(fields, 1, values)) {
+			g_logger->logError("TextureAtlas", "Invalid line in the sprite list: " + line);
+			return false;
+		}
+		sprites[fields[0]].push_back(sf::IntRect(values[0], values[1], values[2], values[3]));
+	}
+	return true;
+}
+
+void TextureAtlas::writeSpriteList(std::ostream& stream, const std::map<std::string, std::vector<sf::IntRect>>& sprites) {
+	stream << "# frames of animations, collected by running the game with --collect-sprites. Input of the atlas packer.\n";
+	for (auto& source : sprites) {
+		for (auto& rect : source.second) {
+			stream << source.first << "," << rect.left << "," << rect.top << "," << rect.width << "," << rect.height << "\n";
+		}
+	}
+}
\ No newline at end of file
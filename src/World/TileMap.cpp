@@ -75,33 +75,95 @@ void TileMap::initFogOfWar(const sf::Vector2i& mapSize) {
 	sf::VertexArray layer;
 	layer.setPrimitiveType(sf::Quads);
 	layer.resize(m_size.x * m_size.y * 4);
+
+	for (int j = 0; j < m_size.y; ++j) {
+		for (int i = 0; i < m_size.x; ++i) {
+			sf::Vertex* quad = &layer[(i + j * m_size.x) * 4];
+
+			quad[0].position = sf::Vector2f(i * TILE_SIZE_F, j * TILE_SIZE_F);
+			quad[1].position = sf::Vector2f((i + 1) * TILE_SIZE_F, j * TILE_SIZE_F);
+			quad[2].position = sf::Vector2f((i + 1) * TILE_SIZE_F, (j + 1) * TILE_SIZE_F);
+			quad[3].position = sf::Vector2f(i * TILE_SIZE_F, (j + 1) * TILE_SIZE_F);
+
+			for (int k = 0; k < 4; ++k) {
+				quad[k].color = sf::Color::Black;
+			}
+		}
+	}
+
 	m_layers.push_back(layer);
 
 	m_animatedTiles.insert({ 0, std::vector<AnimatedTile*>() });	
 }
 
 void TileMap::updateFogOfWar(const std::vector<bool>& tilesExplored) {
-	for (int k = 0; k < m_size.x * m_size.y; ++k) {
-		int i = k % m_size.x;
-		int j = k / m_size.x;
-		
-		bool discovered = tilesExplored[i + j * m_size.x];
-
-		sf::Vertex *quad = &m_layers[0][(i + j * m_size.x) * 4];
-		sf::Color color = discovered ? sf::Color::Transparent : sf::Color::Black;
-
-		quad[0].position = sf::Vector2f(i * TILE_SIZE_F, j * TILE_SIZE_F);
-		quad[1].position = sf::Vector2f((i + 1) * TILE_SIZE_F, j * TILE_SIZE_F);
-		quad[2].position = sf::Vector2f((i + 1) * TILE_SIZE_F, (j + 1) * TILE_SIZE_F);
-		quad[3].position = sf::Vector2f(i * TILE_SIZE_F, (j + 1) * TILE_SIZE_F);
-
-		quad[0].color = color;
-		quad[1].color = color;
-		quad[2].color = color;
-		quad[3].color = color;
+	updateFogOfWar(tilesExplored, sf::IntRect(0, 0, m_size.x, m_size.y));
+}
+
+void TileMap::updateFogOfWar(const std::vector<bool>& tilesExplored, const sf::IntRect& dirtyRect) {
+	if (m_layers.empty() || static_cast<int>(tilesExplored.size()) < m_size.x * m_size.y) return;
+	const std::vector<sf::Uint8>& lookup = getFogOfWarLookup();
+
+	// the corners of the neighbouring quads are blended with the changed tiles, so they are updated as well
+	int left = std::max(0, dirtyRect.left - 1);
+	int top = std::max(0, dirtyRect.top - 1);
+	int right = std::min(m_size.x - 1, dirtyRect.left + dirtyRect.width);
+	int bottom = std::min(m_size.y - 1, dirtyRect.top + dirtyRect.height);
+
+	for (int j = top; j <= bottom; ++j) {
+		for (int i = left; i <= right; ++i) {
+			bool isFogged = !tilesExplored[i + j * m_size.x];
+			int mask = 0;
+			for (int dy = -1; dy <= 1; ++dy) {
+				for (int dx = -1; dx <= 1; ++dx) {
+					int x = i + dx;
+					int y = j + dy;
+					// tiles outside the map count as the tile itself, so the map border is not blended
+					bool isNeighbourFogged = (x < 0 || y < 0 || x >= m_size.x || y >= m_size.y) ?
+						isFogged :
+						!tilesExplored[x + y * m_size.x];
+					if (isNeighbourFogged) {
+						mask |= 1 << ((dy + 1) * 3 + (dx + 1));
+					}
+				}
+			}
+
+			sf::Vertex* quad = &m_layers[0][(i + j * m_size.x) * 4];
+			for (int k = 0; k < 4; ++k) {
+				quad[k].color = sf::Color(0, 0, 0, lookup[mask * 4 + k]);
+			}
+		}
 	}
 }
 
+const std::vector<sf::Uint8>& TileMap::getFogOfWarLookup() {
+	static const std::vector<sf::Uint8> lookup = []() {
+		// the neighbours (dx, dy) that share the quad corners top left, top right, bottom right, bottom left
+		const int corners[4][4][2] = {
+			{ { -1, -1 }, { 0, -1 }, { -1, 0 }, { 0, 0 } },
+			{ { 0, -1 }, { 1, -1 }, { 0, 0 }, { 1, 0 } },
+			{ { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } },
+			{ { -1, 0 }, { 0, 0 }, { -1, 1 }, { 0, 1 } }
+		};
+
+		std::vector<sf::Uint8> table(512 * 4);
+		for (int mask = 0; mask < 512; ++mask) {
+			for (int k = 0; k < 4; ++k) {
+				int fogged = 0;
+				for (auto& neighbour : corners[k]) {
+					if (mask & (1 << ((neighbour[1] + 1) * 3 + (neighbour[0] + 1)))) {
+						fogged++;
+					}
+				}
+				table[mask * 4 + k] = static_cast<sf::Uint8>(fogged * 255 / 4);
+			}
+		}
+		return table;
+	}();
+
+	return lookup;
+}
+
 void TileMap::readAnimatedTile(int tileNumber, int layerNr, int i, int j, const WorldData& data) {
 	for (auto& tile : data.animatedTiles) {
 		if (tile.tileID == tileNumber) {
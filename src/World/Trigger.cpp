@@ -29,39 +29,42 @@ Trigger::Trigger(WorldScreen* screen, const TriggerData& data) {
 
 void Trigger::update(const sf::Time& frameTime) {
 	GameObject::update(frameTime);
-	m_time += frameTime;
-	m_showSprite = false;
-
-	if (!m_data.isTriggerable) return;
-
-	bool intersects = fastIntersect(*m_mainChar->getBoundingBox(), m_data.triggerRect);
-	if (m_data.isKeyGuarded && intersects) {
-		m_showSprite = intersects;
+	if (!m_showSprite) return;
 
-		sf::Vector2f pos = m_sprite.getPosition();
-		float variance = 4.f;
-		float speed = 6.f;
-		float offset = variance * std::cos(speed * m_time.asSeconds());
-		float y = m_data.triggerRect.top + m_data.triggerRect.height - 2.f * m_mainChar->getSize().y - 0.5f * variance + offset;
-		m_sprite.setPosition(pos.x, y);
-	}
+	m_time += frameTime;
+	sf::Vector2f pos = m_sprite.getPosition();
+	float variance = 4.f;
+	float speed = 6.f;
+	float offset = variance * std::cos(speed * m_time.asSeconds());
+	float y = m_data.triggerRect.top + m_data.triggerRect.height - 2.f * m_mainChar->getSize().y - 0.5f * variance + offset;
+	m_sprite.setPosition(pos.x, y);
+}
 
-	if (m_isOnTrigger && !intersects) {
+void Trigger::notifyTriggerEvent(TriggerEventType type) {
+	if (isDisposed()) return;
+	// only a triggerable trigger is armed by entering or leaving it. One whose conditions become true
+	// while the main character stands on it fires after leaving and entering it again.
+	if (type != TriggerEventType::Stay && m_data.isTriggerable) {
 		m_isOnTrigger = false;
 	}
-	if (m_isOnTrigger) return;
+	if (type == TriggerEventType::Exit) {
+		m_showSprite = false;
+		return;
+	}
+
+	m_showSprite = m_data.isKeyGuarded && m_data.isTriggerable;
+	if (!m_data.isTriggerable || m_isOnTrigger) return;
 	if (m_data.isKeyGuarded && !g_inputController->isJustUp()) {
 		return;
 	}
-	if (intersects) {
-		for (auto& content : m_data.content) {
-			TriggerContent::executeTrigger(content, m_worldScreen);
-		}
-		if (!m_data.isPersistent) {
-			m_worldScreen->getCharacterCore()->setTriggerTriggered(m_data.worldID, m_data.objectID);
-		}
-		setDisposed();
+
+	for (auto& content : m_data.content) {
+		TriggerContent::executeTrigger(content, m_worldScreen);
+	}
+	if (!m_data.isPersistent) {
+		m_worldScreen->getCharacterCore()->setTriggerTriggered(m_data.worldID, m_data.objectID);
 	}
+	setDisposed();
 }
 
 void Trigger::render(sf::RenderTarget& renderTarget) {
@@ -77,4 +80,12 @@ GameObjectType Trigger::getConfiguredType() const {
 
 TriggerData& Trigger::getData() {
 	return m_data;
+}
+
+void Trigger::setIndexID(int id) {
+	m_indexID = id;
+}
+
+int Trigger::getIndexID() const {
+	return m_indexID;
 }
\ No newline at end of file
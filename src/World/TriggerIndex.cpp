@@ -0,0 +1,115 @@
+#include "World/TriggerIndex.h"
+
+#include <algorithm>
+
+const float TriggerIndex::CELL_SIZE = 5 * TILE_SIZE_F;
+
+TriggerIndex::TriggerIndex() : m_grid(CELL_SIZE) {
+}
+
+int TriggerIndex::addTrigger(const sf::FloatRect& rect, const std::vector<Condition>& conditions) {
+	int trigger = static_cast<int>(m_entries.size());
+	Entry entry;
+	entry.rect = rect;
+	m_entries.push_back(entry);
+	m_grid.insert(trigger, rect);
+
+	for (auto& condition : conditions) {
+		std::vector<int>& triggers = m_conditionTriggers[condition.type][condition.name];
+		if (triggers.empty() || triggers.back() != trigger) {
+			triggers.push_back(trigger);
+		}
+	}
+
+	return trigger;
+}
+
+void TriggerIndex::removeTrigger(int trigger) {
+	if (trigger < 0 || trigger >= getTriggerCount() || m_entries[trigger].isRemoved) return;
+	m_entries[trigger].isRemoved = true;
+
+	// the cells are static, removed entries are skipped there
+	auto it = std::lower_bound(m_overlapped.begin(), m_overlapped.end(), trigger);
+	if (it != m_overlapped.end() && *it == trigger) {
+		m_overlapped.erase(it);
+	}
+}
+
+void TriggerIndex::clear() {
+	m_entries.clear();
+	m_grid.clear();
+	m_conditionTriggers.clear();
+	m_overlapped.clear();
+	m_currentStamp = 0;
+	m_isFirstUpdate = true;
+}
+
+void TriggerIndex::update(const sf::FloatRect& boundingBox, std::vector<TriggerEvent>& events) {
+	collectCandidates(boundingBox);
+
+	m_nowOverlapped.clear();
+	for (int trigger : m_candidates) {
+		if (fastIntersect(m_entries[trigger].rect, boundingBox)) {
+			m_nowOverlapped.push_back(trigger);
+		}
+	}
+	std::sort(m_nowOverlapped.begin(), m_nowOverlapped.end());
+
+	// merge the sorted lists of the last and this update
+	size_t last = 0;
+	size_t now = 0;
+	while (last < m_overlapped.size() || now < m_nowOverlapped.size()) {
+		if (now == m_nowOverlapped.size() || (last < m_overlapped.size() && m_overlapped[last] < m_nowOverlapped[now])) {
+			events.push_back({ TriggerEventType::Exit, m_overlapped[last++] });
+		}
+		else if (last == m_overlapped.size() || m_nowOverlapped[now] < m_overlapped[last]) {
+			TriggerEventType type = m_isFirstUpdate ? TriggerEventType::Stay : TriggerEventType::Enter;
+			events.push_back({ type, m_nowOverlapped[now++] });
+		}
+		else {
+			events.push_back({ TriggerEventType::Stay, m_nowOverlapped[now++] });
+			++last;
+		}
+	}
+
+	m_overlapped.swap(m_nowOverlapped);
+	m_isFirstUpdate = false;
+}
+
+void TriggerIndex::collectCandidates(const sf::FloatRect& rect) {
+	m_candidates.clear();
+	if (++m_currentStamp == 0) {
+		// the stamp wrapped around, reset all stamps
+		for (auto& entry : m_entries) {
+			entry.stamp = 0;
+		}
+		m_currentStamp = 1;
+	}
+
+	// the grid appends a trigger once for every overlapped cell, keep the first one
+	m_grid.collect(rect, m_candidates);
+	auto last = std::remove_if(m_candidates.begin(), m_candidates.end(), [this](int trigger) {
+		Entry& entry = m_entries[trigger];
+		if (entry.isRemoved || entry.stamp == m_currentStamp) return true;
+		entry.stamp = m_currentStamp;
+		return false;
+	});
+	m_candidates.erase(last, m_candidates.end());
+}
+
+const std::vector<int>& TriggerIndex::getTriggers(const std::string& conditionType, const std::string& conditionName) const {
+	static const std::vector<int> NO_TRIGGERS;
+	auto type = m_conditionTriggers.find(conditionType);
+	if (type == m_conditionTriggers.end()) return NO_TRIGGERS;
+	auto name = type->second.find(conditionName);
+	if (name == type->second.end()) return NO_TRIGGERS;
+	return name->second;
+}
+
+bool TriggerIndex::isOverlapped(int trigger) const {
+	return std::binary_search(m_overlapped.begin(), m_overlapped.end(), trigger);
+}
+
+int TriggerIndex::getTriggerCount() const {
+	return static_cast<int>(m_entries.size());
+}
\ No newline at end of file
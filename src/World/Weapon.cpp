@@ -84,7 +84,7 @@ bool Weapon::addModifier(int slotNr, int modifierNr, const SpellModifier& modifi
 
 	// check if this spell allows a modifier of this type
 	if (modifier.type != SpellModifierType::VOID) {
-		std::vector<SpellModifierType> allowedModifiers = SpellData::getAllowedModifiers(m_weaponSlots.at(slotNr).spellSlot.spellID);
+		const std::vector<SpellModifierType>& allowedModifiers = SpellData::getAllowedModifiers(m_weaponSlots.at(slotNr).spellSlot.spellID);
 		if (!contains(allowedModifiers, modifier.type)) {
 			g_logger->logWarning("Weapon::addModifier", "This modifier is not allowed for the spell!");
 			return false;
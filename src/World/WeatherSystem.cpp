@@ -1,110 +1,174 @@
 #include "World/WeatherSystem.h"
 
 #include "ResourceManager.h"
-#include "Particles/ParticleGenerator.h"
-#include "Particles/ParticleUpdater.h"
+#include "Particles/ParticleHelpers.h"
 #include "GlobalResource.h"
 
+const sf::Time WeatherSystem::CYCLE_TIME = sf::seconds(5.f);
+
+// the nearest particles move with the world, the farthest lag behind the camera a bit
+static const float MIN_PARALLAX = 0.8f;
+
 void WeatherSystem::load(const WeatherData* data, bool isLevel) {
 	if (data == nullptr) return;
 
-	if (m_ps != nullptr) {
-		delete m_ps;
+	m_type = getWeatherType(data->weather);
+	m_particles.clear();
+	m_isCenterSet = false;
+
+	// the particles per window area, sizes are in pixels, angles in degrees with 0 pointing up
+	float density;
+	float minStartSize, maxStartSize, minEndSize, maxEndSize;
+	float minAngle, maxAngle;
+	float minSpeed, maxSpeed;
+	bool isRotated = false;
+
+	switch (m_type) {
+	case WeatherType::Rain:
+		m_texture = g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_RAIN);
+		density = 125.f;
+		minStartSize = minEndSize = isLevel ? 16.f : 10.f;
+		maxStartSize = maxEndSize = isLevel ? 40.f : 30.f;
+		minAngle = maxAngle = 160.f;
+		minSpeed = 400.f;
+		maxSpeed = 500.f;
+		break;
+	case WeatherType::Snow:
+		m_texture = g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_SNOW);
+		density = 62.5f;
+		minStartSize = minEndSize = 4.f;
+		maxStartSize = maxEndSize = 16.f;
+		minAngle = 160.f;
+		maxAngle = 200.f;
+		minSpeed = 100.f;
+		maxSpeed = 250.f;
+		break;
+	case WeatherType::Wind:
+		m_texture = g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_WIND);
+		density = 62.5f;
+		minStartSize = maxStartSize = 0.f;
+		minEndSize = 100.f;
+		maxEndSize = 200.f;
+		minAngle = maxAngle = 90.f;
+		minSpeed = 100.f;
+		maxSpeed = 250.f;
+		isRotated = true;
+		break;
+	default:
+		m_texture = nullptr;
+		return;
 	}
 
-	if (data->weather == "rain") {
-		m_ps = new particles::TextureParticleSystem(1000, g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_RAIN));
-
-		m_ps->emitRate = 200.f;
-
-		float minSize = isLevel ? 16.f : 10.f;
-		float maxSize = isLevel ? 40.f : 30.f;
-
-		auto sizeGen = m_ps->addGenerator<particles::SizeGenerator>();
-		sizeGen->minStartSize = minSize;
-		sizeGen->maxStartSize = maxSize;
-		sizeGen->minEndSize = minSize;
-		sizeGen->maxEndSize = maxSize;
-
-		auto velGen = m_ps->addGenerator<particles::AngledVelocityGenerator>();
-		velGen->minAngle = 160.f;
-		velGen->maxAngle = 160.f;
-		velGen->minStartSpeed = 400.f;
-		velGen->maxStartSpeed = 500.f;
-	}
-	else if (data->weather == "snow") {
-		m_ps = new particles::TextureParticleSystem(1000, g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_SNOW));
-
-		m_ps->emitRate = 100.f;
-
-		auto sizeGen = m_ps->addGenerator<particles::SizeGenerator>();
-		sizeGen->minStartSize = 4.f;
-		sizeGen->maxStartSize = 16.f;
-		sizeGen->minEndSize = 4.f;
-		sizeGen->maxEndSize = 16.f;
-
-		auto velGen = m_ps->addGenerator<particles::AngledVelocityGenerator>();
-		velGen->minAngle = 160.f;
-		velGen->maxAngle = 200.f;
-		velGen->minStartSpeed = 100.f;
-		velGen->maxStartSpeed = 250.f;
+	// particles only wrap once they are completely out of view
+	float margin = 0.5f * std::max(maxStartSize, maxEndSize);
+	m_fieldSize = sf::Vector2f(WINDOW_WIDTH + 2.f * margin, WINDOW_HEIGHT + 2.f * margin);
+	int count = static_cast<int>(std::round(density * m_fieldSize.x * m_fieldSize.y / (WINDOW_WIDTH * WINDOW_HEIGHT)));
+
+	for (int i = 0; i < count; ++i) {
+		WeatherParticle particle;
+		particle.position = particles::randomVector2f(sf::Vector2f(), m_fieldSize);
+		wrap(particle.position);
+		float phi = degToRad(particles::randomFloat(minAngle, maxAngle) - 90.f);
+		particle.velocity = sf::Vector2f(std::cos(phi), std::sin(phi)) * particles::randomFloat(minSpeed, maxSpeed);
+		particle.startSize = particles::randomFloat(minStartSize, maxStartSize);
+		particle.endSize = particles::randomFloat(minEndSize, maxEndSize);
+		particle.angle = isRotated ? 0.5f * M_PI - std::atan2(-particle.velocity.y, particle.velocity.x) : 0.f;
+		particle.parallax = particles::randomFloat(MIN_PARALLAX, 1.f);
+		// the fading cycles start at random, as if the particles had been there before
+		particle.time = sf::seconds(particles::randomFloat(0.f, CYCLE_TIME.asSeconds()));
+		m_particles.push_back(particle);
 	}
-	else if (data->weather == "wind") {
-		m_ps = new particles::TextureParticleSystem(1000, g_resourceManager->getTexture(GlobalResource::TEX_PARTICLE_WIND));
-
-		m_ps->emitRate = 100.f;
 
-		auto sizeGen = m_ps->addGenerator<particles::SizeGenerator>();
-		sizeGen->minStartSize = 0.f;
-		sizeGen->maxStartSize = 0.f;
-		sizeGen->minEndSize = 100.f;
-		sizeGen->maxEndSize = 200.f;
-
-		auto velGen = m_ps->addGenerator<particles::AngledVelocityGenerator>();
-		velGen->minAngle = 90.f;
-		velGen->maxAngle = 90.f;
-		velGen->minStartSpeed = 100.f;
-		velGen->maxStartSpeed = 250.f;
-
-		m_ps->addGenerator<particles::DirectionDefinedRotationGenerator>();
+	m_vertices = sf::VertexArray(sf::Quads, 4 * m_particles.size());
+	if (m_texture == nullptr) return;
+	float x = static_cast<float>(m_texture->getSize().x);
+	float y = static_cast<float>(m_texture->getSize().y);
+	for (size_t i = 0; i < m_particles.size(); ++i) {
+		m_vertices[4 * i + 0].texCoords = sf::Vector2f(0.f, 0.f);
+		m_vertices[4 * i + 1].texCoords = sf::Vector2f(x, 0.f);
+		m_vertices[4 * i + 2].texCoords = sf::Vector2f(x, y);
+		m_vertices[4 * i + 3].texCoords = sf::Vector2f(0.f, y);
 	}
-	else {
-		return;
+}
+
+void WeatherSystem::update(const sf::Time& frameTime) {
+	float seconds = frameTime.asSeconds();
+	for (auto& particle : m_particles) {
+		particle.time += frameTime;
+		if (particle.time >= CYCLE_TIME) {
+			// a faded particle reappears somewhere else in the field
+			particle.time -= CYCLE_TIME;
+			particle.position = particles::randomVector2f(sf::Vector2f(), m_fieldSize);
+		}
+		particle.position += particle.velocity * seconds;
+		wrap(particle.position);
 	}
+}
 
-	auto spawner = m_ps->addSpawner<particles::BoxSpawner>();
-	spawner->size = sf::Vector2f(4.f * WINDOW_WIDTH, 2.f * WINDOW_HEIGHT);
-	m_center = &spawner->center;
+void WeatherSystem::moveCamera(const sf::Vector2f& center) {
+	if (m_isCenterSet) {
+		sf::Vector2f delta = center - m_center;
+		for (auto& particle : m_particles) {
+			particle.position -= delta * particle.parallax;
+			wrap(particle.position);
+		}
+	}
+	m_center = center;
+	m_isCenterSet = true;
+}
 
-	auto timeGen = m_ps->addGenerator<particles::TimeGenerator>();
-	timeGen->minTime = 5.f;
-	timeGen->maxTime = 5.f;
+void WeatherSystem::wrap(sf::Vector2f& position) const {
+	position.x = std::fmod(position.x, m_fieldSize.x);
+	if (position.x < 0.f) position.x += m_fieldSize.x;
+	position.y = std::fmod(position.y, m_fieldSize.y);
+	if (position.y < 0.f) position.y += m_fieldSize.y;
+}
 
-	auto colGen = m_ps->addGenerator<particles::ColorGenerator>();
-	colGen->minStartCol = sf::Color(255, 255, 255, 255);
-	colGen->maxStartCol = sf::Color(255, 255, 255, 255);
-	colGen->minEndCol = sf::Color(255, 255, 255, 0);
-	colGen->maxEndCol = sf::Color(255, 255, 255, 0);
+void WeatherSystem::render(sf::RenderTarget& renderTarget) {
+	if (m_particles.empty() || m_texture == nullptr) return;
+
+	moveCamera(renderTarget.getView().getCenter());
+	sf::Vector2f origin = m_center - 0.5f * m_fieldSize;
+
+	for (size_t i = 0; i < m_particles.size(); ++i) {
+		const WeatherParticle& particle = m_particles[i];
+		float t = particle.time / CYCLE_TIME;
+		float size = 0.5f * lerp(t, particle.startSize, particle.endSize);
+		sf::Vector2f corners[4] = { { -size, -size }, { size, -size }, { size, size }, { -size, size } };
+
+		if (particle.angle != 0.f) {
+			float sin = std::sin(particle.angle);
+			float cos = std::cos(particle.angle);
+			for (auto& corner : corners) {
+				corner = sf::Vector2f(cos * corner.x - sin * corner.y, sin * corner.x + cos * corner.y);
+			}
+		}
+
+		sf::Color color(255, 255, 255, static_cast<sf::Uint8>(255.f * (1.f - t)));
+		for (size_t j = 0; j < 4; ++j) {
+			m_vertices[4 * i + j].position = origin + particle.position + corners[j];
+			m_vertices[4 * i + j].color = color;
+		}
+	}
 
-	m_ps->addUpdater<particles::SizeUpdater>();
-	m_ps->addUpdater<particles::TimeUpdater>();
-	m_ps->addUpdater<particles::ColorUpdater>();
-	m_ps->addUpdater<particles::EulerUpdater>();
+	renderTarget.draw(m_vertices, sf::RenderStates(m_texture));
 }
 
-WeatherSystem::~WeatherSystem() {
-	delete m_ps;
+WeatherType WeatherSystem::getWeatherType() const {
+	return m_type;
 }
 
-void WeatherSystem::update(const sf::Vector2f& center, const sf::Time& frameTime) {
-	if (!m_ps) return;
-
-	*m_center = center;
-	m_ps->update(frameTime);
+const std::vector<WeatherParticle>& WeatherSystem::getParticles() const {
+	return m_particles;
 }
 
-void WeatherSystem::render(sf::RenderTarget& renderTarget) {
-	if (!m_ps) return;
+const sf::Vector2f& WeatherSystem::getFieldSize() const {
+	return m_fieldSize;
+}
 
-	m_ps->render(renderTarget);
+WeatherType WeatherSystem::getWeatherType(const std::string& name) {
+	if (name == "rain") return WeatherType::Rain;
+	if (name == "snow") return WeatherType::Snow;
+	if (name == "wind") return WeatherType::Wind;
+	return WeatherType::VOID;
 }
\ No newline at end of file
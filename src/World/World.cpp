@@ -1,4 +1,5 @@
 #include "World/World.h"
+#include "World/LoadingPipeline.h"
 
 World::World() {
 }
@@ -13,6 +14,32 @@ void World::dispose() {
 	m_lightedForegroundTileMap.dispose();
 }
 
+void World::addTileMapStages(LoadingPipeline& pipeline, const WorldData& data, int readStage) {
+	int decodeStage = pipeline.addStage("decode tileset", [&data]() {
+		g_resourceManager->decodeTexture(data.tileSetPath);
+		return true;
+	}, { readStage });
+
+	// the tile maps are disposed together, so the background tile map can own the tileset for all of them.
+	int uploadStage = pipeline.addStage("upload tileset", [this, &data]() {
+		g_resourceManager->loadTexture(data.tileSetPath, ResourceType::Unique, &m_backgroundTileMap);
+		return true;
+	}, { decodeStage }, true);
+
+	pipeline.addStage("background tiles", [this, &data]() {
+		m_backgroundTileMap.load(data, data.backgroundTileLayers);
+		return true;
+	}, { uploadStage });
+	pipeline.addStage("lighted foreground tiles", [this, &data]() {
+		m_lightedForegroundTileMap.load(data, data.lightedForegroundTileLayers);
+		return true;
+	}, { uploadStage });
+	pipeline.addStage("foreground tiles", [this, &data]() {
+		m_foregroundTileMap.load(data, data.foregroundTileLayers);
+		return true;
+	}, { uploadStage });
+}
+
 void World::update(const sf::Time& frameTime) {
 	m_backgroundTileMap.update(frameTime);
 	m_foregroundTileMap.update(frameTime);
@@ -4,6 +4,7 @@
 #include "ResourceManager.h"
 #include "Controller/InputController.h"
 #include "Steam/AchievementManager.h"
+#include "GameplayEventBus.h"
 #include "Logger.h"
 #include "TextProvider.h"
 
@@ -50,17 +51,29 @@ int main(int argc, char* argv[]) {
 	#endif
 #endif
 
+#ifdef DEBUG
+	g_logger->setLogFile(g_documentsPath + "cendric.log");
+#endif
+
 	g_databaseManager = new DatabaseManager();
 	g_resourceManager = new ResourceManager();
 	g_inputController = new InputController();
 	g_textProvider = new TextProvider();
+	g_gameplayEventBus = new GameplayEventBus();
 	g_achievementManager = new AchievementManager();
 
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "--collect-sprites") {
+			g_resourceManager->setCollectingSprites(true);
+		}
+	}
+
 	Game* game = new Game();
 	game->run();
 	delete game;
 
 	delete g_achievementManager;
+	delete g_gameplayEventBus;
 	delete g_resourceManager;
 	delete g_inputController;
 	delete g_textProvider;
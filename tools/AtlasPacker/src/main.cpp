@@ -0,0 +1,77 @@
+#include "World/AtlasPacker.h"
+#include "Logger.h"
+
+#include <fstream>
+
+// Packs the frames of the sprite list into the texture atlas. Run it from the game folder:
+// AtlasPacker [sprite list] [atlas folder]
+// Only sprite sheets in these folders are packed, they are drawn through animations only.
+
+std::string g_resourcePath = "";
+std::string g_documentsPath = "";
+
+static const std::vector<std::string> PACKED_FOLDERS = {
+	"res/texture/enemies/",
+	"res/texture/bosses/",
+	"res/texture/spells/",
+	"res/texture/equipment/"
+};
+
+inline bool isPackedFolder(const std::string& path) {
+	for (auto& folder : PACKED_FOLDERS) {
+		if (path.compare(0, folder.size(), folder) == 0) return true;
+	}
+	return false;
+}
+
+int main(int argc, char* argv[]) {
+	g_logger = new Logger();
+	g_logger->setLogLevel(LogLevel::Info);
+	std::string spriteListPath = argc > 1 ? argv[1] : TextureAtlas::SPRITE_LIST_PATH;
+	std::string atlasFolder = argc > 2 ? argv[2] : "res/texture/atlas/";
+	if (atlasFolder.back() != '/') atlasFolder += "/";
+
+	std::map<std::string, std::vector<sf::IntRect>> sprites;
+	std::ifstream spriteList(spriteListPath);
+	if (!spriteList.is_open() || !TextureAtlas::readSpriteList(spriteList, sprites)) {
+		g_logger->logError("AtlasPacker", "Could not read the sprite list: " + spriteListPath);
+		delete g_logger;
+		return 1;
+	}
+
+	std::map<std::string, sf::Image> spriteSheets;
+	size_t sheetArea = 0;
+	for (auto it = sprites.begin(); it != sprites.end();) {
+		if (!isPackedFolder(it->first) || !spriteSheets[it->first].loadFromFile(it->first)) {
+			spriteSheets.erase(it->first);
+			it = sprites.erase(it);
+			continue;
+		}
+		sheetArea += spriteSheets[it->first].getSize().x * spriteSheets[it->first].getSize().y;
+		++it;
+	}
+
+	AtlasPacker packer;
+	bool isComplete = packer.pack(sprites, spriteSheets, atlasFolder + "atlas_");
+
+	size_t pageArea = 0;
+	const TextureAtlas& atlas = packer.getAtlas();
+	for (int i = 0; i < atlas.getPageCount(); ++i) {
+		const sf::Image& page = packer.getPages()[i];
+		pageArea += page.getSize().x * page.getSize().y;
+		if (!page.saveToFile(atlas.getPagePath(i))) {
+			g_logger->logError("AtlasPacker", "Could not save the atlas page: " + atlas.getPagePath(i));
+			isComplete = false;
+		}
+	}
+	if (!atlas.save(atlasFolder + "atlas.txt")) {
+		isComplete = false;
+	}
+
+	g_logger->logInfo("AtlasPacker", "Packed " + std::to_string(atlas.getSpriteCount()) + " frames of " + std::to_string(sprites.size()) +
+		" sprite sheets into " + std::to_string(atlas.getPageCount()) + " pages, " + std::to_string(pageArea) +
+		" pixels instead of " + std::to_string(sheetArea) + ".");
+
+	delete g_logger;
+	return isComplete ? 0 : 1;
+}
\ No newline at end of file
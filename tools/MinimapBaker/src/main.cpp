@@ -0,0 +1,91 @@
+#include "Level/LevelMinimaps.h"
+#include "CharacterCore.h"
+#include "DatabaseManager.h"
+#include "ResourceManager.h"
+#include "Steam/AchievementManager.h"
+#include "GameplayEventBus.h"
+#include "Logger.h"
+
+// Bakes the minimaps of all levels and writes the minimap table. Run it from the game folder:
+// MinimapBaker         bakes the minimaps
+// MinimapBaker --check compares the levels and the baked minimaps with the table, returns 1 if one of them has changed
+// The levels are read with a new character core, levels whose collidable tiles differ in a save game are rendered at runtime.
+// The tests check the table in the same way, so bake the minimaps again after a level has changed.
+
+std::string g_resourcePath = "";
+std::string g_documentsPath = "";
+
+int main(int argc, char* argv[]) {
+	g_logger = new Logger();
+	g_logger->setLogLevel(LogLevel::Info);
+	bool isCheck = argc > 1 && std::string(argv[1]) == "--check";
+
+	g_databaseManager = new DatabaseManager();
+	g_resourceManager = new ResourceManager();
+	g_gameplayEventBus = new GameplayEventBus();
+	g_achievementManager = new AchievementManager();
+
+	CharacterCore* core = new CharacterCore();
+	core->loadNew();
+
+	LevelMinimaps table;
+	if (isCheck && !table.load(LevelMinimaps::MINIMAPS_PATH)) {
+		g_logger->logError("MinimapBaker", "Could not read the minimap table: " + LevelMinimaps::MINIMAPS_PATH);
+	}
+
+	LevelMinimaps minimaps;
+	bool isComplete = true;
+	int levelCount = 0;
+	std::vector<std::string> levelIDs = LevelMinimaps::getLevelIDs();
+	for (auto& levelID : levelIDs) {
+		LevelMinimap minimap;
+		std::vector<sf::Uint8> pixels;
+		if (!LevelMinimaps::bake(levelID, core, minimap, pixels)) {
+			isComplete = false;
+			continue;
+		}
+		// the map overlay does not show boss levels
+		if (minimap.imagePath.empty()) continue;
+		levelCount++;
+
+		if (isCheck) {
+			if (!table.checkMinimap(levelID, minimap)) isComplete = false;
+			continue;
+		}
+
+		sf::Image image;
+		image.create(minimap.size.x, minimap.size.y, pixels.data());
+		if (!image.saveToFile(minimap.imagePath)) {
+			g_logger->logError("MinimapBaker", "Could not save the minimap: " + minimap.imagePath);
+			isComplete = false;
+			continue;
+		}
+		minimaps.addMinimap(levelID, minimap);
+	}
+
+	for (auto& it : table.getMinimaps()) {
+		if (contains(levelIDs, it.first)) continue;
+		g_logger->logError("MinimapBaker", "The level of this minimap does not exist anymore: " + it.first);
+		isComplete = false;
+	}
+
+	if (isCheck) {
+		g_logger->logInfo("MinimapBaker", "Checked the minimaps of " + std::to_string(levelCount) + " levels, " +
+			(isComplete ? "all of them match the table." : "some of them have to be baked again."));
+	}
+	else {
+		if (!minimaps.save(LevelMinimaps::MINIMAPS_PATH)) {
+			isComplete = false;
+		}
+		g_logger->logInfo("MinimapBaker", "Baked the minimaps of " + std::to_string(minimaps.getMinimaps().size()) + " of " +
+			std::to_string(levelCount) + " levels.");
+	}
+
+	delete core;
+	delete g_achievementManager;
+	delete g_gameplayEventBus;
+	delete g_resourceManager;
+	delete g_databaseManager;
+	delete g_logger;
+	return isComplete ? 0 : 1;
+}
\ No newline at end of file